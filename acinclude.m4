@@ -6,6 +6,14 @@ dnl Function to detect if libfsxfs dependencies are available
 AC_DEFUN([AX_LIBFSXFS_CHECK_LOCAL],
   [dnl Check for internationalization functions in libfsxfs/libfsxfs_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Headers and functions included in libfsxfs/libfsxfs_memory_mapped_file.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+    AC_CHECK_FUNCS([mmap munmap])
+  ])
 ])
 
 dnl Function to detect if fsxfstools dependencies are available
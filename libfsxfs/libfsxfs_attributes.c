@@ -1069,17 +1069,18 @@ int libfsxfs_attributes_get_value_data_stream(
      libfdata_stream_t **data_stream,
      libcerror_error_t **error )
 {
-	libfdata_stream_t *safe_data_stream = NULL;
-	libfsxfs_extent_t *extent           = NULL;
-	static char *function               = "libfsxfs_attributes_get_value_data_stream";
-	size64_t data_segment_size          = 0;
-	off64_t data_segment_offset         = 0;
-	uint64_t relative_block_number      = 0;
-	uint32_t remaining_value_data_size  = 0;
-	int allocation_group_index          = 0;
-	int extent_index                    = 0;
-	int number_of_extents               = 0;
-	int segment_index                   = 0;
+	libfdata_stream_t *safe_data_stream       = NULL;
+	libfsxfs_block_data_handle_t *data_handle = NULL;
+	libfsxfs_extent_t *extent                 = NULL;
+	static char *function                     = "libfsxfs_attributes_get_value_data_stream";
+	size64_t data_segment_size                = 0;
+	off64_t data_segment_offset               = 0;
+	uint64_t relative_block_number            = 0;
+	uint32_t remaining_value_data_size        = 0;
+	int allocation_group_index                = 0;
+	int extent_index                          = 0;
+	int number_of_extents                     = 0;
+	int segment_index                         = 0;
 
 	if( io_handle == NULL )
 	{
@@ -1210,16 +1211,29 @@ int libfsxfs_attributes_get_value_data_stream(
 
 			return( -1 );
 		}
+		if( libfsxfs_block_data_handle_initialize(
+		     &data_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block data handle.",
+			 function );
+
+			goto on_error;
+		}
 		if( libfdata_stream_initialize(
 		     &safe_data_stream,
-		     NULL,
-		     NULL,
+		     (intptr_t *) data_handle,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_block_data_handle_free,
 		     NULL,
 		     NULL,
 		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsxfs_block_data_handle_read_segment_data,
 		     NULL,
 		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsxfs_block_data_handle_seek_segment_offset,
-		     0,
+		     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1231,6 +1245,8 @@ int libfsxfs_attributes_get_value_data_stream(
 
 			goto on_error;
 		}
+		data_handle = NULL;
+
 		remaining_value_data_size = attribute_values->value_data_size;
 
 		while( remaining_value_data_size > 0 )
@@ -1329,6 +1345,12 @@ on_error:
 		 &safe_data_stream,
 		 NULL );
 	}
+	if( data_handle != NULL )
+	{
+		libfsxfs_block_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
 	return( -1 );
 }
 
@@ -0,0 +1,1103 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_block_cache.h"
+#include "libfsxfs_data_block.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
+
+/* Creates a block cache
+ * Make sure the value block_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_cache_initialize(
+     libfsxfs_block_cache_t **block_cache,
+     int maximum_number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsxfs_block_cache_initialize";
+	int hash_bucket_index      = 0;
+	int number_of_hash_buckets = 0;
+	int value_index            = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_blocks <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of blocks value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_blocks > ( INT_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of blocks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*block_cache = memory_allocate_structure(
+	                libfsxfs_block_cache_t );
+
+	if( *block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_cache,
+	     0,
+	     sizeof( libfsxfs_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+
+		return( -1 );
+	}
+	/* The number of hash buckets is a power of 2 of at least 2 times the maximum number of blocks
+	 */
+	( *block_cache )->number_of_hash_bits = 1;
+
+	number_of_hash_buckets = 2;
+
+	while( number_of_hash_buckets < ( maximum_number_of_blocks * 2 ) )
+	{
+		( *block_cache )->number_of_hash_bits += 1;
+
+		number_of_hash_buckets *= 2;
+	}
+	( *block_cache )->values = (libfsxfs_block_cache_value_t *) memory_allocate(
+	                                                             sizeof( libfsxfs_block_cache_value_t ) * maximum_number_of_blocks );
+
+	if( ( *block_cache )->values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache values.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < maximum_number_of_blocks;
+	     value_index++ )
+	{
+		( *block_cache )->values[ value_index ].block_offset     = 0;
+		( *block_cache )->values[ value_index ].data_block       = NULL;
+		( *block_cache )->values[ value_index ].next_value_index = -1;
+	}
+	( *block_cache )->hash_buckets = (int *) memory_allocate(
+	                                          sizeof( int ) * number_of_hash_buckets );
+
+	if( ( *block_cache )->hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	for( hash_bucket_index = 0;
+	     hash_bucket_index < number_of_hash_buckets;
+	     hash_bucket_index++ )
+	{
+		( *block_cache )->hash_buckets[ hash_bucket_index ] = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *block_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *block_cache )->statistics_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize statistics mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *block_cache )->maximum_number_of_blocks = maximum_number_of_blocks;
+
+	return( 1 );
+
+on_error:
+	if( *block_cache != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( ( *block_cache )->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( ( *block_cache )->read_write_lock ),
+			 NULL );
+		}
+#endif
+		if( ( *block_cache )->hash_buckets != NULL )
+		{
+			memory_free(
+			 ( *block_cache )->hash_buckets );
+		}
+		if( ( *block_cache )->values != NULL )
+		{
+			memory_free(
+			 ( *block_cache )->values );
+		}
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_cache_free(
+     libfsxfs_block_cache_t **block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_cache_free";
+	int result            = 1;
+	int value_index       = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: number of cache hits\t\t: %" PRIu64 "\n",
+			 function,
+			 ( *block_cache )->number_of_hits );
+
+			libcnotify_printf(
+			 "%s: number of cache misses\t: %" PRIu64 "\n",
+			 function,
+			 ( *block_cache )->number_of_misses );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *block_cache )->statistics_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free statistics mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_read_write_lock_free(
+		     &( ( *block_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		for( value_index = 0;
+		     value_index < ( *block_cache )->maximum_number_of_blocks;
+		     value_index++ )
+		{
+			if( ( *block_cache )->values[ value_index ].data_block == NULL )
+			{
+				continue;
+			}
+			if( libfsxfs_data_block_free(
+			     &( ( *block_cache )->values[ value_index ].data_block ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data block: %d.",
+				 function,
+				 value_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *block_cache )->hash_buckets );
+
+		memory_free(
+		 ( *block_cache )->values );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties the block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_cache_empty(
+     libfsxfs_block_cache_t *block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_cache_empty";
+	int hash_bucket_index = 0;
+	int result            = 1;
+	int value_index       = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( value_index = 0;
+	     value_index < block_cache->maximum_number_of_blocks;
+	     value_index++ )
+	{
+		if( block_cache->values[ value_index ].data_block != NULL )
+		{
+			if( libfsxfs_data_block_free(
+			     &( block_cache->values[ value_index ].data_block ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data block: %d.",
+				 function,
+				 value_index );
+
+				result = -1;
+			}
+		}
+		block_cache->values[ value_index ].block_offset     = 0;
+		block_cache->values[ value_index ].next_value_index = -1;
+	}
+	for( hash_bucket_index = 0;
+	     hash_bucket_index < ( 1 << block_cache->number_of_hash_bits );
+	     hash_bucket_index++ )
+	{
+		block_cache->hash_buckets[ hash_bucket_index ] = -1;
+	}
+	block_cache->next_value_index = 0;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the index of the cache value of a specific block offset
+ * The caller must hold the read/write lock
+ * Returns 1 if successful, 0 if no such value is cached or -1 on error
+ */
+int libfsxfs_block_cache_get_value_index(
+     libfsxfs_block_cache_t *block_cache,
+     off64_t block_offset,
+     int *value_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_cache_get_value_index";
+	int hash_bucket_index = 0;
+	int safe_value_index  = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	hash_bucket_index = (int) ( ( (uint64_t) block_offset * 0x9e3779b97f4a7c15ULL ) >> ( 64 - block_cache->number_of_hash_bits ) );
+
+	safe_value_index = block_cache->hash_buckets[ hash_bucket_index ];
+
+	while( safe_value_index != -1 )
+	{
+		if( block_cache->values[ safe_value_index ].block_offset == block_offset )
+		{
+			*value_index = safe_value_index;
+
+			return( 1 );
+		}
+		safe_value_index = block_cache->values[ safe_value_index ].next_value_index;
+	}
+	return( 0 );
+}
+
+/* Sets the data block of a specific block offset in the cache
+ * If the block offset is not cached the least recently added cache value is replaced
+ * If the block offset is cached with a data block of the same size, for example
+ * because another thread read the same block, the data block is not set
+ * This function takes over management of the data block if it was set
+ * The caller must hold the read/write lock for writing
+ * Returns 1 if successful, 0 if the data block was not set or -1 on error
+ */
+int libfsxfs_block_cache_set_data_block(
+     libfsxfs_block_cache_t *block_cache,
+     off64_t block_offset,
+     libfsxfs_data_block_t *data_block,
+     libcerror_error_t **error )
+{
+	libfsxfs_block_cache_value_t *cache_value = NULL;
+	int *next_value_index                     = NULL;
+	static char *function                     = "libfsxfs_block_cache_set_data_block";
+	int hash_bucket_index                     = 0;
+	int result                                = 0;
+	int value_index                           = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_block_cache_get_value_index(
+	          block_cache,
+	          block_offset,
+	          &value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		cache_value = &( block_cache->values[ value_index ] );
+
+		if( cache_value->data_block->data_size == data_block->data_size )
+		{
+			return( 0 );
+		}
+		/* A block read at the same offset with a different size replaces the cached block
+		 */
+		if( libfsxfs_data_block_free(
+		     &( cache_value->data_block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data block: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		cache_value->data_block = data_block;
+
+		return( 1 );
+	}
+	value_index = block_cache->next_value_index;
+	cache_value = &( block_cache->values[ value_index ] );
+
+	if( cache_value->data_block != NULL )
+	{
+		/* Remove the replaced cache value from its hash bucket
+		 */
+		hash_bucket_index = (int) ( ( (uint64_t) cache_value->block_offset * 0x9e3779b97f4a7c15ULL ) >> ( 64 - block_cache->number_of_hash_bits ) );
+
+		next_value_index = &( block_cache->hash_buckets[ hash_bucket_index ] );
+
+		while( *next_value_index != value_index )
+		{
+			if( *next_value_index == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing cache value: %d in hash bucket: %d.",
+				 function,
+				 value_index,
+				 hash_bucket_index );
+
+				return( -1 );
+			}
+			next_value_index = &( block_cache->values[ *next_value_index ].next_value_index );
+		}
+		*next_value_index = cache_value->next_value_index;
+
+		if( libfsxfs_data_block_free(
+		     &( cache_value->data_block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data block: %d.",
+			 function,
+			 value_index );
+
+			cache_value->next_value_index = -1;
+
+			return( -1 );
+		}
+	}
+	hash_bucket_index = (int) ( ( (uint64_t) block_offset * 0x9e3779b97f4a7c15ULL ) >> ( 64 - block_cache->number_of_hash_bits ) );
+
+	cache_value->block_offset     = block_offset;
+	cache_value->data_block       = data_block;
+	cache_value->next_value_index = block_cache->hash_buckets[ hash_bucket_index ];
+
+	block_cache->hash_buckets[ hash_bucket_index ] = value_index;
+
+	block_cache->next_value_index += 1;
+
+	if( block_cache->next_value_index >= block_cache->maximum_number_of_blocks )
+	{
+		block_cache->next_value_index = 0;
+	}
+	return( 1 );
+}
+
+/* Reads a block at a specific offset, using the cached copy if available
+ * The block is identified by its offset and the buffer size must match the size of the cached block
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_block_cache_read_buffer_at_offset(
+         libfsxfs_block_cache_t *block_cache,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t file_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_cache_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	read_count = libfsxfs_block_cache_read_buffer_from_block(
+	              block_cache,
+	              file_io_handle,
+	              file_offset,
+	              buffer_size,
+	              0,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads part of a block at a specific offset, using the cached copy if available
+ * The block is identified by its offset and the block size must match the size of the cached block
+ * The buffer is filled with the block data starting at data offset
+ * The cache is only locked for the lookup and the insert, not while the block is read
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_block_cache_read_buffer_from_block(
+         libfsxfs_block_cache_t *block_cache,
+         libbfio_handle_t *file_io_handle,
+         off64_t block_offset,
+         size_t block_size,
+         size_t data_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfsxfs_data_block_t *data_block = NULL;
+	static char *function             = "libfsxfs_block_cache_read_buffer_from_block";
+	int result                        = 0;
+	int value_index                   = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset >= block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > ( block_size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsxfs_block_cache_get_value_index(
+	          block_cache,
+	          block_offset,
+	          &value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value index.",
+		 function );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_read(
+		 block_cache->read_write_lock,
+		 NULL );
+#endif
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* A block read at the same offset with a different size is treated as a cache miss
+		 */
+		if( block_cache->values[ value_index ].data_block->data_size != block_size )
+		{
+			result = 0;
+		}
+		else if( memory_copy(
+		          buffer,
+		          &( block_cache->values[ value_index ].data_block->data[ data_offset ] ),
+		          buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data block data.",
+			 function );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+			libcthreads_read_write_lock_release_for_read(
+			 block_cache->read_write_lock,
+			 NULL );
+#endif
+			return( -1 );
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     block_cache->statistics_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab statistics mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 0 )
+	{
+		block_cache->number_of_hits += 1;
+	}
+	else
+	{
+		block_cache->number_of_misses += 1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     block_cache->statistics_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release statistics mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 0 )
+	{
+		return( (ssize_t) buffer_size );
+	}
+	/* The block is read without holding the lock, so that reads of other blocks
+	 * are not blocked by the read
+	 */
+	if( libfsxfs_data_block_initialize(
+	     &data_block,
+	     block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_data_block_read_file_io_handle(
+	     data_block,
+	     file_io_handle,
+	     block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 block_offset,
+		 block_offset );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( data_block->data[ data_offset ] ),
+	     buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data block data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libfsxfs_block_cache_set_data_block(
+	          block_cache,
+	          block_offset,
+	          data_block,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data block in cache.",
+		 function );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_write(
+		 block_cache->read_write_lock,
+		 NULL );
+#endif
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* The cache took over management of the data block
+		 */
+		data_block = NULL;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* Another thread could have cached the same block while the lock was not held
+	 */
+	if( data_block != NULL )
+	{
+		if( libfsxfs_data_block_free(
+		     &data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( (ssize_t) buffer_size );
+
+on_error:
+	if( data_block != NULL )
+	{
+		libfsxfs_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the block cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_cache_get_statistics(
+     libfsxfs_block_cache_t *block_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_cache_get_statistics";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     block_cache->statistics_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab statistics mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_hits   = block_cache->number_of_hits;
+	*number_of_misses = block_cache->number_of_misses;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     block_cache->statistics_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release statistics mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,154 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_BLOCK_CACHE_H )
+#define _LIBFSXFS_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_data_block.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_block_cache_value libfsxfs_block_cache_value_t;
+
+struct libfsxfs_block_cache_value
+{
+	/* The block offset
+	 */
+	off64_t block_offset;
+
+	/* The data block
+	 * NULL if the cache value is not set
+	 */
+	libfsxfs_data_block_t *data_block;
+
+	/* The index of the next cache value in the same hash bucket
+	 * -1 if this is the last cache value in the hash bucket
+	 */
+	int next_value_index;
+};
+
+typedef struct libfsxfs_block_cache libfsxfs_block_cache_t;
+
+struct libfsxfs_block_cache
+{
+	/* The cache values
+	 */
+	libfsxfs_block_cache_value_t *values;
+
+	/* The maximum number of blocks
+	 */
+	int maximum_number_of_blocks;
+
+	/* The index of the cache value that is replaced next
+	 */
+	int next_value_index;
+
+	/* The hash buckets, which contain the index of the first cache value
+	 * in the hash bucket or -1 if the hash bucket is empty
+	 */
+	int *hash_buckets;
+
+	/* The number of bits of the hash bucket index
+	 */
+	uint8_t number_of_hash_bits;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The mutex that protects the statistics
+	 */
+	libcthreads_mutex_t *statistics_mutex;
+#endif
+};
+
+int libfsxfs_block_cache_initialize(
+     libfsxfs_block_cache_t **block_cache,
+     int maximum_number_of_blocks,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_free(
+     libfsxfs_block_cache_t **block_cache,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_empty(
+     libfsxfs_block_cache_t *block_cache,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_get_value_index(
+     libfsxfs_block_cache_t *block_cache,
+     off64_t block_offset,
+     int *value_index,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_set_data_block(
+     libfsxfs_block_cache_t *block_cache,
+     off64_t block_offset,
+     libfsxfs_data_block_t *data_block,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_block_cache_read_buffer_at_offset(
+         libfsxfs_block_cache_t *block_cache,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t file_offset,
+         libcerror_error_t **error );
+
+ssize_t libfsxfs_block_cache_read_buffer_from_block(
+         libfsxfs_block_cache_t *block_cache,
+         libbfio_handle_t *file_io_handle,
+         off64_t block_offset,
+         size_t block_size,
+         size_t data_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+int libfsxfs_block_cache_get_statistics(
+     libfsxfs_block_cache_t *block_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_BLOCK_CACHE_H ) */
+
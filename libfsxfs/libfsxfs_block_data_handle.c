@@ -29,12 +29,116 @@
 #include "libfsxfs_libfdata.h"
 #include "libfsxfs_unused.h"
 
+/* Creates a block data handle
+ * Make sure the value data_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_data_handle_initialize(
+     libfsxfs_block_data_handle_t **data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_data_handle_initialize";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*data_handle = memory_allocate_structure(
+	                libfsxfs_block_data_handle_t );
+
+	if( *data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_handle,
+	     0,
+	     sizeof( libfsxfs_block_data_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *data_handle != NULL )
+	{
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block data handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_data_handle_free(
+     libfsxfs_block_data_handle_t **data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_data_handle_free";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( 1 );
+}
+
 /* Reads data from the current offset into a buffer
  * Callback for the cluster block data stream
+ * The data is read with a positional read, hence the file IO handle can be shared by multiple data streams
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libfsxfs_block_data_handle_read_segment_data(
-         intptr_t *data_handle LIBFSXFS_ATTRIBUTE_UNUSED,
+         libfsxfs_block_data_handle_t *data_handle,
          libbfio_handle_t *file_io_handle,
          int segment_index LIBFSXFS_ATTRIBUTE_UNUSED,
          int segment_file_index LIBFSXFS_ATTRIBUTE_UNUSED,
@@ -47,11 +151,21 @@ ssize_t libfsxfs_block_data_handle_read_segment_data(
 	static char *function = "libfsxfs_block_data_handle_read_segment_data";
 	ssize_t read_count    = 0;
 
-	LIBFSXFS_UNREFERENCED_PARAMETER( data_handle )
 	LIBFSXFS_UNREFERENCED_PARAMETER( segment_index )
 	LIBFSXFS_UNREFERENCED_PARAMETER( segment_file_index )
 	LIBFSXFS_UNREFERENCED_PARAMETER( read_flags )
 
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( segment_data == NULL )
 	{
 		libcerror_error_set(
@@ -94,10 +208,11 @@ ssize_t libfsxfs_block_data_handle_read_segment_data(
 	}
 	else
 	{
-		read_count = libbfio_handle_read_buffer(
+		read_count = libbfio_handle_read_buffer_at_offset(
 		              file_io_handle,
 		              segment_data,
 		              segment_data_size,
+		              data_handle->current_offset,
 		              error );
 
 		if( read_count < 0 )
@@ -106,22 +221,27 @@ ssize_t libfsxfs_block_data_handle_read_segment_data(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read segment data.",
-			 function );
+			 "%s: unable to read segment data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_handle->current_offset,
+			 data_handle->current_offset );
 
 			return( -1 );
 		}
 	}
+	data_handle->current_offset += read_count;
+
 	return( read_count );
 }
 
 /* Seeks a certain offset of the data
  * Callback for the cluster block data stream
+ * Only the offset of the data handle is set, the file IO handle is not changed
  * Returns the offset if seek is successful or -1 on error
  */
 off64_t libfsxfs_block_data_handle_seek_segment_offset(
-         intptr_t *data_handle LIBFSXFS_ATTRIBUTE_UNUSED,
-         libbfio_handle_t *file_io_handle,
+         libfsxfs_block_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle LIBFSXFS_ATTRIBUTE_UNUSED,
          int segment_index LIBFSXFS_ATTRIBUTE_UNUSED,
          int segment_file_index LIBFSXFS_ATTRIBUTE_UNUSED,
          off64_t segment_offset,
@@ -129,38 +249,34 @@ off64_t libfsxfs_block_data_handle_seek_segment_offset(
 {
 	static char *function = "libfsxfs_block_data_handle_seek_segment_offset";
 
-	LIBFSXFS_UNREFERENCED_PARAMETER( data_handle )
+	LIBFSXFS_UNREFERENCED_PARAMETER( file_io_handle )
 	LIBFSXFS_UNREFERENCED_PARAMETER( segment_index )
 	LIBFSXFS_UNREFERENCED_PARAMETER( segment_file_index )
 
-	if( segment_offset < 0 )
+	if( data_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid segment offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     segment_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( segment_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek segment offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 segment_offset,
-		 segment_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
+	data_handle->current_offset = segment_offset;
+
 	return( segment_offset );
 }
 
@@ -34,8 +34,25 @@
 extern "C" {
 #endif
 
+typedef struct libfsxfs_block_data_handle libfsxfs_block_data_handle_t;
+
+struct libfsxfs_block_data_handle
+{
+	/* The current offset
+	 */
+	off64_t current_offset;
+};
+
+int libfsxfs_block_data_handle_initialize(
+     libfsxfs_block_data_handle_t **data_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_block_data_handle_free(
+     libfsxfs_block_data_handle_t **data_handle,
+     libcerror_error_t **error );
+
 ssize_t libfsxfs_block_data_handle_read_segment_data(
-         intptr_t *data_handle,
+         libfsxfs_block_data_handle_t *data_handle,
          libbfio_handle_t *file_io_handle,
          int segment_index,
          int segment_file_index,
@@ -46,7 +63,7 @@ ssize_t libfsxfs_block_data_handle_read_segment_data(
          libcerror_error_t **error );
 
 off64_t libfsxfs_block_data_handle_seek_segment_offset(
-         intptr_t *data_handle,
+         libfsxfs_block_data_handle_t *data_handle,
          libbfio_handle_t *file_io_handle,
          int segment_index,
          int segment_file_index,
@@ -24,17 +24,19 @@
 #include <memory.h>
 #include <types.h>
 
-#include "libfsxfs_debug.h"
-#include "libfsxfs_definitions.h"
-#include "libfsxfs_directory_entry.h"
+#include "libfsxfs_block_cache.h"
 #include "libfsxfs_block_directory.h"
 #include "libfsxfs_block_directory_footer.h"
 #include "libfsxfs_block_directory_header.h"
+#include "libfsxfs_debug.h"
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_directory_entry.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
+#include "libfsxfs_memory_mapped_file.h"
 
 #include "fsxfs_block_directory.h"
 
@@ -611,6 +613,10 @@ int libfsxfs_block_directory_read_data(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+			if( directory_entry != NULL )
+			{
+				directory_entry->file_type = data[ data_offset ];
+			}
 			data_offset++;
 		}
 		if( alignment_padding_size > 0 )
@@ -750,6 +756,17 @@ int libfsxfs_block_directory_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -760,12 +777,34 @@ int libfsxfs_block_directory_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              block_directory->data,
-	              block_directory->data_size,
-	              file_offset,
-	              error );
+	if( io_handle->memory_mapped_file != NULL )
+	{
+		read_count = libfsxfs_memory_mapped_file_read_buffer_at_offset(
+		              io_handle->memory_mapped_file,
+		              block_directory->data,
+		              block_directory->data_size,
+		              file_offset,
+		              error );
+	}
+	else if( io_handle->metadata_block_cache != NULL )
+	{
+		read_count = libfsxfs_block_cache_read_buffer_at_offset(
+		              io_handle->metadata_block_cache,
+		              file_io_handle,
+		              block_directory->data,
+		              block_directory->data_size,
+		              file_offset,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              block_directory->data,
+		              block_directory->data_size,
+		              file_offset,
+		              error );
+	}
 
 	if( read_count != (ssize_t) block_directory->data_size )
 	{
@@ -23,11 +23,13 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsxfs_block_cache.h"
 #include "libfsxfs_btree_block.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
+#include "libfsxfs_memory_mapped_file.h"
 
 #include "fsxfs_btree.h"
 
@@ -110,20 +112,8 @@ int libfsxfs_btree_block_initialize(
 
 		return( -1 );
 	}
-	( *btree_block )->data = (uint8_t *) memory_allocate(
-	                                      sizeof( uint8_t ) * block_size );
-
-	if( ( *btree_block )->data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create B+ tree block data.",
-		 function );
-
-		goto on_error;
-	}
+	/* The data is allocated when the B+ tree block is read from a file IO handle
+	 */
 	( *btree_block )->data_size              = block_size;
 	( *btree_block )->block_number_data_size = block_number_data_size;
 
@@ -179,9 +169,11 @@ int libfsxfs_btree_block_free(
 				result = -1;
 			}
 		}
-		memory_free(
-		 ( *btree_block )->data );
-
+		if( ( *btree_block )->data != NULL )
+		{
+			memory_free(
+			 ( *btree_block )->data );
+		}
 		memory_free(
 		 *btree_block );
 
@@ -349,6 +341,7 @@ int libfsxfs_btree_block_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error )
 {
+	const uint8_t *data   = NULL;
 	static char *function = "libfsxfs_btree_block_read_file_io_handle";
 	ssize_t read_count    = 0;
 
@@ -374,6 +367,17 @@ int libfsxfs_btree_block_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -384,30 +388,98 @@ int libfsxfs_btree_block_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              btree_block->data,
-	              btree_block->data_size,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) btree_block->data_size )
+	if( io_handle->memory_mapped_file != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read B+ tree block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		/* The B+ tree block is read directly from the mapped data
+		 */
+		if( libfsxfs_memory_mapped_file_get_data_at_offset(
+		     io_handle->memory_mapped_file,
+		     file_offset,
+		     btree_block->data_size,
+		     &data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to retrieve mapped B+ tree block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( btree_block->data == NULL )
+		{
+			if( ( btree_block->data_size == 0 )
+			 || ( btree_block->data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid B+ tree block - data size value out of bounds.",
+				 function );
 
-		return( -1 );
+				return( -1 );
+			}
+			btree_block->data = (uint8_t *) memory_allocate(
+			                                 sizeof( uint8_t ) * btree_block->data_size );
+
+			if( btree_block->data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create B+ tree block data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( io_handle->metadata_block_cache != NULL )
+		{
+			read_count = libfsxfs_block_cache_read_buffer_at_offset(
+			              io_handle->metadata_block_cache,
+			              file_io_handle,
+			              btree_block->data,
+			              btree_block->data_size,
+			              file_offset,
+			              error );
+		}
+		else
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              btree_block->data,
+			              btree_block->data_size,
+			              file_offset,
+			              error );
+		}
+		if( read_count != (ssize_t) btree_block->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read B+ tree block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		data = btree_block->data;
 	}
 	if( libfsxfs_btree_block_read_data(
 	     btree_block,
 	     io_handle,
-	     btree_block->data,
+	     data,
 	     btree_block->data_size,
 	     error ) != 1 )
 	{
@@ -22,11 +22,10 @@
 #include <common.h>
 #include <types.h>
 
-#include "libfsxfs_block_data_handle.h"
 #include "libfsxfs_buffer_data_handle.h"
 #include "libfsxfs_definitions.h"
-#include "libfsxfs_extent.h"
 #include "libfsxfs_inode.h"
+#include "libfsxfs_inode_data_handle.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
@@ -135,6 +134,9 @@ on_error:
 }
 
 /* Creates data data stream from extents
+ * The data stream consists of a single segment that is mapped onto the extents
+ * using the data extent map or B+ tree of the inode, hence a lookup does not
+ * depend on the number of extents
  * Make sure the value data_stream is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
@@ -145,16 +147,10 @@ int libfsxfs_data_stream_initialize_from_extents(
      size64_t data_size,
      libcerror_error_t **error )
 {
-	libfdata_stream_t *safe_data_stream = NULL;
-	libfsxfs_extent_t *extent           = NULL;
-	static char *function               = "libfsxfs_data_stream_initialize_from_extents";
-	size64_t data_segment_size          = 0;
-	off64_t data_segment_offset         = 0;
-	uint64_t relative_block_number      = 0;
-	int allocation_group_index          = 0;
-	int extent_index                    = 0;
-	int number_of_extents               = 0;
-	int segment_index                   = 0;
+	libfdata_stream_t *safe_data_stream       = NULL;
+	libfsxfs_inode_data_handle_t *data_handle = NULL;
+	static char *function                     = "libfsxfs_data_stream_initialize_from_extents";
+	int segment_index                         = 0;
 
 	if( data_stream == NULL )
 	{
@@ -200,129 +196,82 @@ int libfsxfs_data_stream_initialize_from_extents(
 
 		return( -1 );
 	}
-	if( libfdata_stream_initialize(
-	     &safe_data_stream,
-	     NULL,
-	     NULL,
-	     NULL,
-	     NULL,
-	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsxfs_block_data_handle_read_segment_data,
-	     NULL,
-	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsxfs_block_data_handle_seek_segment_offset,
-	     0,
-	     error ) != 1 )
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode->data_extent_map == NULL )
+	 && ( inode->data_extent_btree == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data stream.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode - missing data extent map and B+ tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsxfs_inode_get_number_of_data_extents(
+	if( libfsxfs_inode_data_handle_initialize(
+	     &data_handle,
+	     io_handle,
 	     inode,
-	     &number_of_extents,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of data extents.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode data handle.",
 		 function );
 
 		goto on_error;
 	}
-	for( extent_index = 0;
-	     extent_index < number_of_extents;
-	     extent_index++ )
+	if( libfdata_stream_initialize(
+	     &safe_data_stream,
+	     (intptr_t *) data_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_data_handle_free,
+	     NULL,
+	     NULL,
+	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsxfs_inode_data_handle_read_segment_data,
+	     NULL,
+	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsxfs_inode_data_handle_seek_segment_offset,
+	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+	     error ) != 1 )
 	{
-		if( libfsxfs_inode_get_data_extent_by_index(
-		     inode,
-		     extent_index,
-		     &extent,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data extent: %d.",
-			 function,
-			 extent_index );
-
-			goto on_error;
-		}
-		if( extent == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing extent: %d.",
-			 function,
-			 extent_index );
-
-			goto on_error;
-		}
-		allocation_group_index = (int) ( extent->physical_block_number >> io_handle->number_of_relative_block_number_bits );
-		relative_block_number  = extent->physical_block_number & ( ( 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: extent: %d allocation group index\t: %d\n",
-			 function,
-			 extent_index,
-			 allocation_group_index );
-
-			libcnotify_printf(
-			 "%s: extent: %d relative block number\t: %" PRIu64 "\n",
-			 function,
-			 extent_index,
-			 relative_block_number );
-
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-		data_segment_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
-		data_segment_size   = (size64_t) extent->number_of_blocks * io_handle->block_size;
-
-		if( libfdata_stream_append_segment(
-		     safe_data_stream,
-		     &segment_index,
-		     0,
-		     data_segment_offset,
-		     data_segment_size,
-		     extent->range_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append extent: %d data stream segment.",
-			 function,
-			 extent_index );
-
-			goto on_error;
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data stream.",
+		 function );
+
+		goto on_error;
 	}
-	if( libfdata_stream_set_mapped_size(
+	data_handle = NULL;
+
+	if( libfdata_stream_append_segment(
 	     safe_data_stream,
+	     &segment_index,
+	     0,
+	     0,
 	     data_size,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set mapped size of data stream.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data stream segment.",
 		 function );
 
 		goto on_error;
@@ -338,6 +287,12 @@ on_error:
 		 &safe_data_stream,
 		 NULL );
 	}
+	if( data_handle != NULL )
+	{
+		libfsxfs_inode_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
 	return( -1 );
 }
 
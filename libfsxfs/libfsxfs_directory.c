@@ -20,15 +20,18 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
+#include "libfsxfs_block_cache.h"
 #include "libfsxfs_block_directory.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_directory.h"
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_directory_table.h"
 #include "libfsxfs_extent.h"
+#include "libfsxfs_extent_map.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
@@ -36,6 +39,10 @@
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 #include "libfsxfs_libuna.h"
+#include "libfsxfs_memory_mapped_file.h"
+#include "libfsxfs_name_hash.h"
+
+#include "fsxfs_directory_leaf.h"
 
 /* Creates a directory
  * Make sure the value directory is referencing, is set to NULL
@@ -102,20 +109,6 @@ int libfsxfs_directory_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &( ( *directory )->entries_array ),
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create entries array.",
-		 function );
-
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
@@ -137,7 +130,6 @@ int libfsxfs_directory_free(
      libcerror_error_t **error )
 {
 	static char *function = "libfsxfs_directory_free";
-	int result            = 1;
 
 	if( directory == NULL )
 	{
@@ -152,49 +144,38 @@ int libfsxfs_directory_free(
 	}
 	if( *directory != NULL )
 	{
-		if( libcdata_array_free(
-		     &( ( *directory )->entries_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
-		     error ) != 1 )
+		if( ( *directory )->hash_index != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free entries array.",
-			 function );
-
-			result = -1;
+			memory_free(
+			 ( *directory )->hash_index );
+		}
+		if( ( *directory )->names_data != NULL )
+		{
+			memory_free(
+			 ( *directory )->names_data );
+		}
+		if( ( *directory )->records != NULL )
+		{
+			memory_free(
+			 ( *directory )->records );
 		}
 		memory_free(
 		 *directory );
 
 		*directory = NULL;
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Reads the directory entries
+/* Empties a directory
+ * The allocated records, names data and hash index are retained for reuse
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_directory_read_file_io_handle(
+int libfsxfs_directory_empty(
      libfsxfs_directory_t *directory,
-     libfsxfs_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     libfsxfs_inode_t *inode,
      libcerror_error_t **error )
 {
-	libfsxfs_block_directory_t *block_directory = NULL;
-	libfsxfs_directory_table_t *directory_table = NULL;
-	libfsxfs_extent_t *extent                   = NULL;
-	static char *function                       = "libfsxfs_directory_read_file_io_handle";
-	size64_t extent_size                        = 0;
-	off64_t block_directory_offset              = 0;
-	off64_t logical_offset                      = 0;
-	uint64_t relative_block_number              = 0;
-	int allocation_group_index                  = 0;
-	int extent_index                            = 0;
-	int number_of_extents                       = 0;
+	static char *function = "libfsxfs_directory_empty";
 
 	if( directory == NULL )
 	{
@@ -207,94 +188,542 @@ int libfsxfs_directory_read_file_io_handle(
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	directory->number_of_records   = 0;
+	directory->names_data_size     = 0;
+	directory->hash_index_is_valid = 0;
+
+	return( 1 );
+}
+
+/* Appends the values of an entry
+ * The name is stored in the names data of the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_append_entry_values(
+     libfsxfs_directory_t *directory,
+     uint64_t inode_number,
+     const uint8_t *name,
+     uint8_t name_size,
+     uint8_t file_type,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_record_t *record = NULL;
+	void *reallocation                  = NULL;
+	static char *function               = "libfsxfs_directory_append_entry_values";
+	size_t allocated_names_data_size    = 0;
+	int number_of_allocated_records     = 0;
+
+	if( directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid directory.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle->allocation_group_size == 0 )
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory->number_of_records >= directory->number_of_allocated_records )
+	{
+		if( directory->number_of_allocated_records == 0 )
+		{
+			number_of_allocated_records = 64;
+		}
+		else if( directory->number_of_allocated_records <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_records = directory->number_of_allocated_records * 2;
+		}
+		if( ( number_of_allocated_records == 0 )
+		 || ( (size_t) number_of_allocated_records > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_directory_record_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated records value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                directory->records,
+		                sizeof( libfsxfs_directory_record_t ) * number_of_allocated_records );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize records.",
+			 function );
+
+			return( -1 );
+		}
+		directory->records                     = (libfsxfs_directory_record_t *) reallocation;
+		directory->number_of_allocated_records = number_of_allocated_records;
+	}
+	if( (size_t) name_size > ( directory->allocated_names_data_size - directory->names_data_size ) )
+	{
+		if( directory->allocated_names_data_size == 0 )
+		{
+			allocated_names_data_size = 1024;
+		}
+		else
+		{
+			allocated_names_data_size = directory->allocated_names_data_size * 2;
+		}
+		if( ( allocated_names_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		 || ( allocated_names_data_size > (size_t) UINT32_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid allocated names data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                directory->names_data,
+		                sizeof( uint8_t ) * allocated_names_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize names data.",
+			 function );
+
+			return( -1 );
+		}
+		directory->names_data                = (uint8_t *) reallocation;
+		directory->allocated_names_data_size = allocated_names_data_size;
+	}
+	record = &( directory->records[ directory->number_of_records ] );
+
+	if( libfsxfs_name_hash_calculate_from_utf8_string(
+	     &( record->name_hash ),
+	     name,
+	     (size_t) name_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - allocation group size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle->block_size == 0 )
+	if( memory_copy(
+	     &( directory->names_data[ directory->names_data_size ] ),
+	     name,
+	     (size_t) name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	record->inode_number = inode_number;
+	record->name_offset  = (uint32_t) directory->names_data_size;
+	record->name_size    = name_size;
+	record->file_type    = file_type;
+
+	directory->names_data_size   += name_size;
+	directory->number_of_records += 1;
+
+	directory->hash_index_is_valid = 0;
+
+	return( 1 );
+}
+
+/* Appends the entries of an entries array and empties the entries array
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_append_entries(
+     libfsxfs_directory_t *directory,
+     libcdata_array_t *entries_array,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfsxfs_directory_append_entries";
+	int entry_index                             = 0;
+	int number_of_entries                       = 0;
+
+	if( libcdata_array_get_number_of_entries(
+	     entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - block size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
 		 function );
 
 		return( -1 );
 	}
-	if( inode == NULL )
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     entries_array,
+		     entry_index,
+		     (intptr_t **) &directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( directory_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfsxfs_directory_append_entry_values(
+		     directory,
+		     directory_entry->inode_number,
+		     directory_entry->name,
+		     directory_entry->name_size,
+		     directory_entry->file_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_empty(
+	     entries_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty entries array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the name hash index of the records
+ * The name hash index uses open addressing with linear probing and
+ * is sized to at least twice the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_build_hash_index(
+     libfsxfs_directory_t *directory,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_record_t *record = NULL;
+	void *reallocation                  = NULL;
+	static char *function               = "libfsxfs_directory_build_hash_index";
+	uint32_t hash_index_slot            = 0;
+	uint8_t hash_index_bits             = 4;
+	int number_of_hash_index_slots      = 0;
+	int record_index                    = 0;
+
+	if( directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid inode.",
+		 "%s: invalid directory.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( inode->file_mode & 0xf000 ) == LIBFSXFS_FILE_TYPE_DIRECTORY )
+	if( ( directory->number_of_records < 0 )
+	 || ( directory->number_of_records > ( INT_MAX / 4 ) ) )
 	{
-		if( ( inode->fork_type != LIBFSXFS_FORK_TYPE_INLINE_DATA )
-		 && ( inode->fork_type != LIBFSXFS_FORK_TYPE_EXTENTS )
-		 && ( inode->fork_type != LIBFSXFS_FORK_TYPE_BTREE ) )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory - number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load factor at or below 0.5 so that probe sequences remain short
+	 */
+	while( ( 1 << hash_index_bits ) < ( directory->number_of_records * 2 ) )
+	{
+		hash_index_bits++;
+	}
+	number_of_hash_index_slots = 1 << hash_index_bits;
+
+	if( number_of_hash_index_slots > directory->number_of_allocated_hash_index_slots )
+	{
+		if( (size_t) number_of_hash_index_slots > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported directory data fork type.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of hash index slots value exceeds maximum.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA )
-		{
-			if( libfsxfs_directory_table_initialize(
-			     &directory_table,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to initialize directory table.",
-				 function );
+		reallocation = memory_reallocate(
+		                directory->hash_index,
+		                sizeof( int ) * number_of_hash_index_slots );
 
-				goto on_error;
-			}
-			if( libfsxfs_directory_table_read_data(
-			     directory_table,
-			     io_handle,
-			     inode->inline_data,
-			     (size_t) inode->size,
-			     directory->entries_array,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read directory table.",
-				 function );
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize hash index.",
+			 function );
+
+			return( -1 );
+		}
+		directory->hash_index                           = (int *) reallocation;
+		directory->number_of_allocated_hash_index_slots = number_of_hash_index_slots;
+	}
+	if( memory_set(
+	     directory->hash_index,
+	     0,
+	     sizeof( int ) * number_of_hash_index_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash index.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < directory->number_of_records;
+	     record_index++ )
+	{
+		record = &( directory->records[ record_index ] );
+
+		/* The name hash is multiplied by the 32-bit golden ratio constant
+		 * so that the upper bits used as slot are well distributed
+		 */
+		hash_index_slot = (uint32_t) ( record->name_hash * (uint32_t) 0x9e3779b1UL ) >> ( 32 - hash_index_bits );
+
+		while( directory->hash_index[ hash_index_slot ] != 0 )
+		{
+			hash_index_slot = ( hash_index_slot + 1 ) & (uint32_t) ( number_of_hash_index_slots - 1 );
+		}
+		directory->hash_index[ hash_index_slot ] = record_index + 1;
+	}
+	directory->number_of_hash_index_slots = number_of_hash_index_slots;
+	directory->hash_index_bits            = hash_index_bits;
+	directory->hash_index_is_valid        = 1;
+
+	return( 1 );
+}
+
+/* Reads the directory entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_read_file_io_handle(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_block_directory_t *block_directory = NULL;
+	libfsxfs_directory_table_t *directory_table = NULL;
+	libfsxfs_extent_t *extent                   = NULL;
+	libcdata_array_t *entries_array             = NULL;
+	static char *function                       = "libfsxfs_directory_read_file_io_handle";
+	size64_t extent_size                        = 0;
+	off64_t block_directory_offset              = 0;
+	off64_t logical_offset                      = 0;
+	uint64_t relative_block_number              = 0;
+	int allocation_group_index                  = 0;
+	int extent_index                            = 0;
+	int number_of_extents                       = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->allocation_group_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - allocation group size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode->file_mode & 0xf000 ) == LIBFSXFS_FILE_TYPE_DIRECTORY )
+	{
+		/* The directory entries are parsed into a temporary entries array
+		 * and then appended to the records and names data of the directory
+		 */
+		if( libcdata_array_initialize(
+		     &entries_array,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create entries array.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( inode->fork_type != LIBFSXFS_FORK_TYPE_INLINE_DATA )
+		 && ( inode->fork_type != LIBFSXFS_FORK_TYPE_EXTENTS )
+		 && ( inode->fork_type != LIBFSXFS_FORK_TYPE_BTREE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported directory data fork type.",
+			 function );
+
+			goto on_error;
+		}
+		if( inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA )
+		{
+			if( libfsxfs_directory_table_initialize(
+			     &directory_table,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize directory table.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_directory_table_read_data(
+			     directory_table,
+			     io_handle,
+			     inode->inline_data,
+			     (size_t) inode->size,
+			     entries_array,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory table.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_directory_append_entries(
+			     directory,
+			     entries_array,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory table entries.",
+				 function );
 
 				goto on_error;
 			}
@@ -402,90 +831,1194 @@ int libfsxfs_directory_read_file_io_handle(
 					 extent_index,
 					 relative_block_number );
 
-					libcnotify_printf(
-					 "\n" );
+					libcnotify_printf(
+					 "\n" );
+				}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+				block_directory_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
+				extent_size            = (size64_t) extent->number_of_blocks * io_handle->block_size;
+
+				while( extent_size > 0 )
+				{
+					if( libfsxfs_block_directory_initialize(
+					     &block_directory,
+					     io_handle->block_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to initialize block directory.",
+						 function );
+
+						goto on_error;
+					}
+					if( libfsxfs_block_directory_read_file_io_handle(
+					     block_directory,
+					     io_handle,
+					     file_io_handle,
+					     block_directory_offset,
+					     entries_array,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read block directory.",
+						 function );
+
+						goto on_error;
+					}
+					if( libfsxfs_directory_append_entries(
+					     directory,
+					     entries_array,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append block directory entries.",
+						 function );
+
+						goto on_error;
+					}
+					block_directory_offset += io_handle->directory_block_size;
+					extent_size            -= io_handle->directory_block_size;
+
+					if( libfsxfs_block_directory_free(
+					     &block_directory,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free block directory.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+		}
+		if( libcdata_array_free(
+		     &entries_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( block_directory != NULL )
+	{
+		libfsxfs_block_directory_free(
+		 &block_directory,
+		 NULL );
+	}
+	if( directory_table != NULL )
+	{
+		libfsxfs_directory_table_free(
+		 &directory_table,
+		 NULL );
+	}
+	if( entries_array != NULL )
+	{
+		libcdata_array_free(
+		 &entries_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+		 NULL );
+	}
+	libfsxfs_directory_empty(
+	 directory,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Determines the file offset of a directory block
+ * Returns 1 if successful, 0 if the directory block is not (contiguously) mapped or -1 on error
+ */
+int libfsxfs_directory_get_block_file_offset(
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t logical_block_number,
+     uint32_t number_of_blocks,
+     off64_t *file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_get_block_file_offset";
+	int extent_index      = 0;
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->data_extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode - missing data extent map.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_extent_map_get_extent_index_by_logical_block_number(
+	          inode->data_extent_map,
+	          logical_block_number,
+	          &extent_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent of logical block: %" PRIu64 ".",
+		 function,
+		 logical_block_number );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* The directory block must be stored in a single extent
+	 */
+	result = libfsxfs_extent_map_get_file_offset_by_extent_index(
+	          inode->data_extent_map,
+	          io_handle,
+	          extent_index,
+	          logical_block_number,
+	          (uint64_t) number_of_blocks,
+	          file_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file offset of logical block: %" PRIu64 ".",
+		 function,
+		 logical_block_number );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads the data of a directory block
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_read_block_data(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_read_block_data";
+	ssize_t read_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading directory block at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	if( io_handle->memory_mapped_file != NULL )
+	{
+		read_count = libfsxfs_memory_mapped_file_read_buffer_at_offset(
+		              io_handle->memory_mapped_file,
+		              data,
+		              data_size,
+		              file_offset,
+		              error );
+	}
+	else if( io_handle->metadata_block_cache != NULL )
+	{
+		read_count = libfsxfs_block_cache_read_buffer_at_offset(
+		              io_handle->metadata_block_cache,
+		              file_io_handle,
+		              data,
+		              data_size,
+		              file_offset,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              data,
+		              data_size,
+		              file_offset,
+		              error );
+	}
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the directory entry stored at a specific (data) address
+ * The address is the offset of the entry in the directory data in units of 8 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_read_entry_by_address(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint32_t address,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfsxfs_directory_read_entry_by_address";
+	off64_t file_offset       = 0;
+	size_t data_offset        = 0;
+	uint64_t directory_offset = 0;
+	uint64_t inode_number     = 0;
+	uint16_t free_tag         = 0;
+	uint8_t file_type         = 0;
+	uint8_t name_size         = 0;
+	int result                = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size != (size_t) io_handle->directory_block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	directory_offset = (uint64_t) address << 3;
+	data_offset      = (size_t) ( directory_offset % data_size );
+
+	result = libfsxfs_directory_get_block_file_offset(
+	          io_handle,
+	          inode,
+	          ( directory_offset - data_offset ) / io_handle->block_size,
+	          (uint32_t) ( data_size / io_handle->block_size ),
+	          &file_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file offset of directory data at offset: %" PRIu64 ".",
+		 function,
+		 directory_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing directory data at offset: %" PRIu64 ".",
+		 function,
+		 directory_offset );
+
+		return( -1 );
+	}
+	if( libfsxfs_directory_read_block_data(
+	     io_handle,
+	     file_io_handle,
+	     file_offset,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 11 )
+	 || ( data_offset > ( data_size - 11 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid address value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 &( data[ data_offset ] ),
+	 free_tag );
+
+	name_size = data[ data_offset + 8 ];
+
+	if( ( free_tag == 0xffff )
+	 || ( name_size == 0 )
+	 || ( (size_t) name_size > ( data_size - data_offset - 11 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory entry at offset: %" PRIu64 ".",
+		 function,
+		 directory_offset );
+
+		return( -1 );
+	}
+	if( ( name_size == 1 )
+	 && ( data[ data_offset + 9 ] == '.' ) )
+	{
+		/* Ignore self directory entry "." */
+		return( 1 );
+	}
+	else if( ( name_size == 2 )
+	      && ( data[ data_offset + 9 ] == '.' )
+	      && ( data[ data_offset + 10 ] == '.' ) )
+	{
+		/* Ignore parent directory entry ".." */
+		return( 1 );
+	}
+	byte_stream_copy_to_uint64_big_endian(
+	 &( data[ data_offset ] ),
+	 inode_number );
+
+	if( ( io_handle->format_version == 5 )
+	 || ( ( io_handle->secondary_feature_flags & LIBFSXFS_SECONDARY_FEATURE_FLAG_FILE_TYPE ) != 0 ) )
+	{
+		file_type = data[ data_offset + 9 + name_size ];
+	}
+	if( libfsxfs_directory_append_entry_values(
+	     directory,
+	     inode_number,
+	     &( data[ data_offset + 9 ] ),
+	     name_size,
+	     file_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the first leaf or node entry with a name hash equal or greater than the specified name hash
+ * The entries are sorted by name hash
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_get_leaf_entry_index_by_name_hash(
+     const uint8_t *entries_data,
+     uint16_t number_of_entries,
+     uint32_t name_hash,
+     uint16_t *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsxfs_directory_get_leaf_entry_index_by_name_hash";
+	uint32_t entry_name_hash = 0;
+	uint16_t lower_index     = 0;
+	uint16_t middle_index    = 0;
+	uint16_t upper_index     = 0;
+
+	if( ( entries_data == NULL )
+	 && ( number_of_entries > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries data.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_directory_leaf_entry_t *) &( entries_data[ middle_index * sizeof( fsxfs_directory_leaf_entry_t ) ] ) )->name_hash,
+		 entry_name_hash );
+
+		if( entry_name_hash < name_hash )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	*entry_index = lower_index;
+
+	return( 1 );
+}
+
+/* Reads the directory entries with a specific name hash using the hash index of the directory
+ * On success the entries array only contains the entries with the name hash
+ * Returns 1 if successful, 0 if the directory has no usable hash index or -1 on error
+ */
+int libfsxfs_directory_read_entries_by_name_hash(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint32_t name_hash,
+     libcerror_error_t **error )
+{
+	const uint8_t *entries_data     = NULL;
+	uint8_t *block_data             = NULL;
+	uint8_t *entry_block_data       = NULL;
+	static char *function           = "libfsxfs_directory_read_entries_by_name_hash";
+	off64_t file_offset             = 0;
+	size_t directory_block_size     = 0;
+	size_t header_data_size         = 0;
+	uint32_t address                = 0;
+	uint32_t entry_name_hash        = 0;
+	uint32_t next_block_number      = 0;
+	uint32_t number_of_blocks       = 0;
+	uint32_t number_of_tail_entries = 0;
+	uint16_t entry_index            = 0;
+	uint16_t number_of_entries      = 0;
+	uint16_t signature              = 0;
+	int recursion_depth             = 0;
+	int result                      = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	/* Short form directories are stored inline and have no hash index
+	 * and the name hash of ASCII case-insensitive directories is calculated differently
+	 */
+	if( ( ( inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY )
+	 || ( ( inode->fork_type != LIBFSXFS_FORK_TYPE_EXTENTS )
+	  &&  ( inode->fork_type != LIBFSXFS_FORK_TYPE_BTREE ) )
+	 || ( ( io_handle->feature_flags & LIBFSXFS_FEATURE_FLAG_ASCII_CASE_INSENSITIVE ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( io_handle->directory_block_size < io_handle->block_size )
+	 || ( ( io_handle->directory_block_size % io_handle->block_size ) != 0 )
+	 || ( io_handle->directory_block_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( 0 );
+	}
+	directory_block_size = (size_t) io_handle->directory_block_size;
+	number_of_blocks     = io_handle->directory_block_size / io_handle->block_size;
+
+	result = libfsxfs_directory_get_block_file_offset(
+	          io_handle,
+	          inode,
+	          (uint64_t) LIBFSXFS_DIRECTORY_LEAF_OFFSET / io_handle->block_size,
+	          number_of_blocks,
+	          &file_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file offset of directory leaf.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* Without a leaf the directory consists of a single block that contains the hash index
+		 */
+		result = libfsxfs_directory_get_block_file_offset(
+		          io_handle,
+		          inode,
+		          0,
+		          number_of_blocks,
+		          &file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine file offset of directory block.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	block_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * directory_block_size );
+
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		goto on_error;
+	}
+	entry_block_data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * directory_block_size );
+
+	if( entry_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_directory_empty(
+	     directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty directory.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		if( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid recursion depth value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		recursion_depth++;
+
+		if( libfsxfs_directory_read_block_data(
+		     io_handle,
+		     file_io_handle,
+		     file_offset,
+		     block_data,
+		     directory_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory block.",
+			 function );
+
+			goto on_error;
+		}
+		next_block_number = 0;
+
+		if( ( memory_compare(
+		       block_data,
+		       "XD2B",
+		       4 ) == 0 )
+		 || ( memory_compare(
+		       block_data,
+		       "XDB3",
+		       4 ) == 0 ) )
+		{
+			/* The hash index of a single block directory is stored before the 8-byte footer
+			 */
+			byte_stream_copy_to_uint32_big_endian(
+			 &( block_data[ directory_block_size - 8 ] ),
+			 number_of_tail_entries );
+
+			if( number_of_tail_entries > ( ( directory_block_size - 8 ) / sizeof( fsxfs_directory_leaf_entry_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of entries value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			number_of_entries = (uint16_t) number_of_tail_entries;
+			entries_data      = &( block_data[ directory_block_size - 8 - ( number_of_tail_entries * sizeof( fsxfs_directory_leaf_entry_t ) ) ] );
+			signature         = 0;
+		}
+		else
+		{
+			byte_stream_copy_to_uint16_big_endian(
+			 ( (fsxfs_directory_leaf_header_v2_t *) block_data )->signature,
+			 signature );
+
+			/* 0x3df1 (XFS_DIR3_LEAF1_MAGIC), 0x3dff (XFS_DIR3_LEAFN_MAGIC) and 0x3ebe (XFS_DA3_NODE_MAGIC)
+			 */
+			if( ( signature == 0x3df1 )
+			 || ( signature == 0x3dff )
+			 || ( signature == 0x3ebe ) )
+			{
+				header_data_size = sizeof( fsxfs_directory_leaf_header_v3_t );
+
+				byte_stream_copy_to_uint16_big_endian(
+				 ( (fsxfs_directory_leaf_header_v3_t *) block_data )->number_of_entries,
+				 number_of_entries );
+			}
+			/* 0xd2f1 (XFS_DIR2_LEAF1_MAGIC), 0xd2ff (XFS_DIR2_LEAFN_MAGIC) and 0xfebe (XFS_DA_NODE_MAGIC)
+			 */
+			else if( ( signature == 0xd2f1 )
+			      || ( signature == 0xd2ff )
+			      || ( signature == 0xfebe ) )
+			{
+				header_data_size = sizeof( fsxfs_directory_leaf_header_v2_t );
+
+				byte_stream_copy_to_uint16_big_endian(
+				 ( (fsxfs_directory_leaf_header_v2_t *) block_data )->number_of_entries,
+				 number_of_entries );
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported directory leaf signature: 0x%04" PRIx16 ".",
+				 function,
+				 signature );
+
+				goto on_error;
+			}
+			if( (size_t) number_of_entries > ( ( directory_block_size - header_data_size ) / sizeof( fsxfs_directory_leaf_entry_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of entries value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			entries_data = &( block_data[ header_data_size ] );
+		}
+		if( libfsxfs_directory_get_leaf_entry_index_by_name_hash(
+		     entries_data,
+		     number_of_entries,
+		     name_hash,
+		     &entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry index of name hash: 0x%08" PRIx32 ".",
+			 function,
+			 name_hash );
+
+			goto on_error;
+		}
+		if( ( signature == 0x3ebe )
+		 || ( signature == 0xfebe ) )
+		{
+			/* A node entry contains the highest name hash in the block it refers to
+			 */
+			if( entry_index >= number_of_entries )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_big_endian(
+			 ( (fsxfs_directory_leaf_entry_t *) &( entries_data[ entry_index * sizeof( fsxfs_directory_leaf_entry_t ) ] ) )->address,
+			 next_block_number );
+		}
+		else
+		{
+			while( entry_index < number_of_entries )
+			{
+				byte_stream_copy_to_uint32_big_endian(
+				 ( (fsxfs_directory_leaf_entry_t *) &( entries_data[ entry_index * sizeof( fsxfs_directory_leaf_entry_t ) ] ) )->name_hash,
+				 entry_name_hash );
+
+				if( entry_name_hash != name_hash )
+				{
+					break;
 				}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-				block_directory_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
-				extent_size            = (size64_t) extent->number_of_blocks * io_handle->block_size;
+				byte_stream_copy_to_uint32_big_endian(
+				 ( (fsxfs_directory_leaf_entry_t *) &( entries_data[ entry_index * sizeof( fsxfs_directory_leaf_entry_t ) ] ) )->address,
+				 address );
 
-				while( extent_size > 0 )
+				/* An address of 0 indicates a stale entry
+				 */
+				if( address != 0 )
 				{
-					if( libfsxfs_block_directory_initialize(
-					     &block_directory,
-					     io_handle->block_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-						 "%s: unable to initialize block directory.",
-						 function );
-
-						goto on_error;
-					}
-					if( libfsxfs_block_directory_read_file_io_handle(
-					     block_directory,
+					if( libfsxfs_directory_read_entry_by_address(
+					     directory,
 					     io_handle,
 					     file_io_handle,
-					     block_directory_offset,
-					     directory->entries_array,
+					     inode,
+					     address,
+					     entry_block_data,
+					     directory_block_size,
 					     error ) != 1 )
 					{
 						libcerror_error_set(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_IO,
 						 LIBCERROR_IO_ERROR_READ_FAILED,
-						 "%s: unable to read block directory.",
-						 function );
-
-						goto on_error;
-					}
-					block_directory_offset += io_handle->directory_block_size;
-					extent_size            -= io_handle->directory_block_size;
-
-					if( libfsxfs_block_directory_free(
-					     &block_directory,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-						 "%s: unable to free block directory.",
-						 function );
+						 "%s: unable to read directory entry at address: 0x%08" PRIx32 ".",
+						 function,
+						 address );
 
 						goto on_error;
 					}
 				}
+				entry_index++;
+			}
+			/* Entries with the same name hash can continue in the next leaf of a node directory
+			 */
+			if( ( signature == 0x3dff )
+			 || ( signature == 0xd2ff ) )
+			{
+				if( ( number_of_entries > 0 )
+				 && ( entry_index >= number_of_entries ) )
+				{
+					byte_stream_copy_to_uint32_big_endian(
+					 ( (fsxfs_directory_leaf_header_v2_t *) block_data )->next_block_number,
+					 next_block_number );
+				}
+			}
+		}
+		if( next_block_number != 0 )
+		{
+			result = libfsxfs_directory_get_block_file_offset(
+			          io_handle,
+			          inode,
+			          (uint64_t) next_block_number,
+			          number_of_blocks,
+			          &file_offset,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine file offset of directory block: %" PRIu32 ".",
+				 function,
+				 next_block_number );
+
+				goto on_error;
 			}
 		}
 	}
+	while( next_block_number != 0 );
+
+	memory_free(
+	 entry_block_data );
+
+	memory_free(
+	 block_data );
+
 	return( 1 );
 
 on_error:
-	if( block_directory != NULL )
+	if( entry_block_data != NULL )
 	{
-		libfsxfs_block_directory_free(
-		 &block_directory,
-		 NULL );
+		memory_free(
+		 entry_block_data );
 	}
-	if( directory_table != NULL )
+	if( block_data != NULL )
 	{
-		libfsxfs_directory_table_free(
-		 &directory_table,
-		 NULL );
+		memory_free(
+		 block_data );
 	}
-	libcdata_array_empty(
-	 directory->entries_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+	libfsxfs_directory_empty(
+	 directory,
 	 NULL );
 
 	return( -1 );
 }
 
+/* Reads the directory entry for an UTF-8 encoded name
+ * If available the hash index is used to only read the directory blocks that contain
+ * entries with the same name hash, otherwise all directory entries are read
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_directory_read_entry_by_utf8_name(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_read_entry_by_utf8_name";
+	uint32_t name_hash    = 0;
+	int result            = 0;
+
+	if( libfsxfs_name_hash_calculate_from_utf8_string(
+	     &name_hash,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_directory_read_entries_by_name_hash(
+	          directory,
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          name_hash,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries by name hash.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libfsxfs_directory_read_file_io_handle(
+		     directory,
+		     io_handle,
+		     file_io_handle,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libfsxfs_directory_get_entry_by_utf8_name(
+	          directory,
+	          utf8_string,
+	          utf8_string_length,
+	          directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads the directory entry for an UTF-16 encoded name
+ * If available the hash index is used to only read the directory blocks that contain
+ * entries with the same name hash, otherwise all directory entries are read
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_directory_read_entry_by_utf16_name(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_read_entry_by_utf16_name";
+	uint32_t name_hash    = 0;
+	int result            = 0;
+
+	if( libfsxfs_name_hash_calculate_from_utf16_string(
+	     &name_hash,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_directory_read_entries_by_name_hash(
+	          directory,
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          name_hash,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries by name hash.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libfsxfs_directory_read_file_io_handle(
+		     directory,
+		     io_handle,
+		     file_io_handle,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libfsxfs_directory_get_entry_by_utf16_name(
+	          directory,
+	          utf16_string,
+	          utf16_string_length,
+	          directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-16 name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the number of entries
  * Returns 1 if successful or -1 on error
  */
@@ -507,33 +2040,34 @@ int libfsxfs_directory_get_number_of_entries(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     directory->entries_array,
-	     number_of_entries,
-	     error ) != 1 )
+	if( number_of_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
 		 function );
 
 		return( -1 );
 	}
+	*number_of_entries = directory->number_of_records;
+
 	return( 1 );
 }
 
 /* Retrieves a specific entry
+ * The values of the entry are copied into directory_entry
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_directory_get_entry_by_index(
      libfsxfs_directory_t *directory,
      int entry_index,
-     libfsxfs_directory_entry_t **directory_entry,
+     libfsxfs_directory_entry_t *directory_entry,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_directory_get_entry_by_index";
+	libfsxfs_directory_record_t *record = NULL;
+	static char *function               = "libfsxfs_directory_get_entry_by_index";
 
 	if( directory == NULL )
 	{
@@ -546,40 +2080,71 @@ int libfsxfs_directory_get_entry_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     directory->entries_array,
-	     entry_index,
-	     (intptr_t **) directory_entry,
-	     error ) != 1 )
+	if( ( entry_index < 0 )
+	 || ( entry_index >= directory->number_of_records ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry: %d.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	record = &( directory->records[ entry_index ] );
+
+	if( memory_copy(
+	     directory_entry->name,
+	     &( directory->names_data[ record->name_offset ] ),
+	     (size_t) record->name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name of entry: %d.",
 		 function,
 		 entry_index );
 
 		return( -1 );
 	}
+	directory_entry->inode_number = record->inode_number;
+	directory_entry->name_size    = record->name_size;
+	directory_entry->file_type    = record->file_type;
+
 	return( 1 );
 }
 
 /* Retrieves the directory entry for an UTF-8 encoded name
+ * The values of the entry are copied into directory_entry
+ * The name hash index is built on demand and only records with a matching name hash are compared
  * Returns 1 if successful, 0 if not found or -1 on error
  */
 int libfsxfs_directory_get_entry_by_utf8_name(
      libfsxfs_directory_t *directory,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
-     libfsxfs_directory_entry_t **directory_entry,
+     libfsxfs_directory_entry_t *directory_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
-	static char *function                            = "libfsxfs_directory_get_entry_by_utf8_name";
-	int entry_index                                  = 0;
-	int number_of_entries                            = 0;
-	int result                                       = 0;
+	libfsxfs_directory_record_t *record = NULL;
+	static char *function               = "libfsxfs_directory_get_entry_by_utf8_name";
+	uint32_t hash_index_slot            = 0;
+	uint32_t name_hash                  = 0;
+	int entry_index                     = 0;
+	int result                          = 0;
 
 	if( directory == NULL )
 	{
@@ -592,44 +2157,58 @@ int libfsxfs_directory_get_entry_by_utf8_name(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     directory->entries_array,
-	     &number_of_entries,
+	if( libfsxfs_name_hash_calculate_from_utf8_string(
+	     &name_hash,
+	     utf8_string,
+	     utf8_string_length,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 "%s: unable to calculate name hash.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	if( directory->hash_index_is_valid == 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     directory->entries_array,
-		     entry_index,
-		     (intptr_t **) &safe_directory_entry,
+		if( libfsxfs_directory_build_hash_index(
+		     directory,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d.",
-			 function,
-			 entry_index );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build hash index.",
+			 function );
 
 			return( -1 );
 		}
-		result = libfsxfs_directory_entry_compare_with_utf8_string(
-		          safe_directory_entry,
+	}
+	hash_index_slot = (uint32_t) ( name_hash * (uint32_t) 0x9e3779b1UL ) >> ( 32 - directory->hash_index_bits );
+
+	/* The probe sequence ends at the first unused slot
+	 */
+	while( directory->hash_index[ hash_index_slot ] != 0 )
+	{
+		entry_index     = directory->hash_index[ hash_index_slot ] - 1;
+		record          = &( directory->records[ entry_index ] );
+		hash_index_slot = ( hash_index_slot + 1 ) & (uint32_t) ( directory->number_of_hash_index_slots - 1 );
+
+		/* Only compare the name if the name hash matches
+		 */
+		if( record->name_hash != name_hash )
+		{
+			continue;
+		}
+		result = libuna_utf8_string_compare_with_utf8_stream(
 		          utf8_string,
 		          utf8_string_length,
+		          &( directory->names_data[ record->name_offset ] ),
+		          (size_t) record->name_size,
 		          error );
 
 		if( result == -1 )
@@ -638,7 +2217,7 @@ int libfsxfs_directory_get_entry_by_utf8_name(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare UTF-8 string with directory entry: %d.",
+			 "%s: unable to compare UTF-8 string with entry: %d.",
 			 function,
 			 entry_index );
 
@@ -646,31 +2225,46 @@ int libfsxfs_directory_get_entry_by_utf8_name(
 		}
 		else if( result == LIBUNA_COMPARE_EQUAL )
 		{
-			*directory_entry = safe_directory_entry;
+			if( libfsxfs_directory_get_entry_by_index(
+			     directory,
+			     entry_index,
+			     directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d.",
+				 function,
+				 entry_index );
 
+				return( -1 );
+			}
 			return( 1 );
 		}
 	}
-	*directory_entry = NULL;
-
 	return( 0 );
 }
 
 /* Retrieves the directory entry for an UTF-16 encoded name
+ * The values of the entry are copied into directory_entry
+ * The name hash index is built on demand and only records with a matching name hash are compared
  * Returns 1 if successful, 0 if not found or -1 on error
  */
 int libfsxfs_directory_get_entry_by_utf16_name(
      libfsxfs_directory_t *directory,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
-     libfsxfs_directory_entry_t **directory_entry,
+     libfsxfs_directory_entry_t *directory_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
-	static char *function                            = "libfsxfs_directory_get_entry_by_utf16_name";
-	int entry_index                                  = 0;
-	int number_of_entries                            = 0;
-	int result                                       = 0;
+	libfsxfs_directory_record_t *record = NULL;
+	static char *function               = "libfsxfs_directory_get_entry_by_utf16_name";
+	uint32_t hash_index_slot            = 0;
+	uint32_t name_hash                  = 0;
+	int entry_index                     = 0;
+	int result                          = 0;
 
 	if( directory == NULL )
 	{
@@ -683,44 +2277,58 @@ int libfsxfs_directory_get_entry_by_utf16_name(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     directory->entries_array,
-	     &number_of_entries,
+	if( libfsxfs_name_hash_calculate_from_utf16_string(
+	     &name_hash,
+	     utf16_string,
+	     utf16_string_length,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 "%s: unable to calculate name hash.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	if( directory->hash_index_is_valid == 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     directory->entries_array,
-		     entry_index,
-		     (intptr_t **) &safe_directory_entry,
+		if( libfsxfs_directory_build_hash_index(
+		     directory,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d.",
-			 function,
-			 entry_index );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build hash index.",
+			 function );
 
 			return( -1 );
 		}
-		result = libfsxfs_directory_entry_compare_with_utf16_string(
-		          safe_directory_entry,
+	}
+	hash_index_slot = (uint32_t) ( name_hash * (uint32_t) 0x9e3779b1UL ) >> ( 32 - directory->hash_index_bits );
+
+	/* The probe sequence ends at the first unused slot
+	 */
+	while( directory->hash_index[ hash_index_slot ] != 0 )
+	{
+		entry_index     = directory->hash_index[ hash_index_slot ] - 1;
+		record          = &( directory->records[ entry_index ] );
+		hash_index_slot = ( hash_index_slot + 1 ) & (uint32_t) ( directory->number_of_hash_index_slots - 1 );
+
+		/* Only compare the name if the name hash matches
+		 */
+		if( record->name_hash != name_hash )
+		{
+			continue;
+		}
+		result = libuna_utf16_string_compare_with_utf8_stream(
 		          utf16_string,
 		          utf16_string_length,
+		          &( directory->names_data[ record->name_offset ] ),
+		          (size_t) record->name_size,
 		          error );
 
 		if( result == -1 )
@@ -729,7 +2337,7 @@ int libfsxfs_directory_get_entry_by_utf16_name(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare UTF-16 string with directory entry: %d.",
+			 "%s: unable to compare UTF-16 string with entry: %d.",
 			 function,
 			 entry_index );
 
@@ -737,13 +2345,25 @@ int libfsxfs_directory_get_entry_by_utf16_name(
 		}
 		else if( result == LIBUNA_COMPARE_EQUAL )
 		{
-			*directory_entry = safe_directory_entry;
+			if( libfsxfs_directory_get_entry_by_index(
+			     directory,
+			     entry_index,
+			     directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d.",
+				 function,
+				 entry_index );
 
+				return( -1 );
+			}
 			return( 1 );
 		}
 	}
-	*directory_entry = NULL;
-
 	return( 0 );
 }
 
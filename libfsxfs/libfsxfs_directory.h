@@ -36,13 +36,79 @@
 extern "C" {
 #endif
 
+typedef struct libfsxfs_directory_record libfsxfs_directory_record_t;
+
+struct libfsxfs_directory_record
+{
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The offset of the name in the names data
+	 */
+	uint32_t name_offset;
+
+	/* The name hash
+	 */
+	uint32_t name_hash;
+
+	/* The name size
+	 */
+	uint8_t name_size;
+
+	/* The file type
+	 */
+	uint8_t file_type;
+};
+
 typedef struct libfsxfs_directory libfsxfs_directory_t;
 
 struct libfsxfs_directory
 {
-	/* Entries array
+	/* The records
+	 */
+	libfsxfs_directory_record_t *records;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The number of allocated records
+	 */
+	int number_of_allocated_records;
+
+	/* The names data
+	 */
+	uint8_t *names_data;
+
+	/* The names data size
 	 */
-	libcdata_array_t *entries_array;
+	size_t names_data_size;
+
+	/* The allocated names data size
+	 */
+	size_t allocated_names_data_size;
+
+	/* The name hash index
+	 * A slot contains the index of the corresponding record + 1 or 0 if unused
+	 */
+	int *hash_index;
+
+	/* The number of name hash index slots
+	 */
+	int number_of_hash_index_slots;
+
+	/* The number of allocated name hash index slots
+	 */
+	int number_of_allocated_hash_index_slots;
+
+	/* The number of bits of a name hash index slot
+	 */
+	uint8_t hash_index_bits;
+
+	/* Value to indicate the name hash index contains all the records
+	 */
+	uint8_t hash_index_is_valid;
 };
 
 int libfsxfs_directory_initialize(
@@ -53,6 +119,27 @@ int libfsxfs_directory_free(
      libfsxfs_directory_t **directory,
      libcerror_error_t **error );
 
+int libfsxfs_directory_empty(
+     libfsxfs_directory_t *directory,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_append_entry_values(
+     libfsxfs_directory_t *directory,
+     uint64_t inode_number,
+     const uint8_t *name,
+     uint8_t name_size,
+     uint8_t file_type,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_append_entries(
+     libfsxfs_directory_t *directory,
+     libcdata_array_t *entries_array,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_build_hash_index(
+     libfsxfs_directory_t *directory,
+     libcerror_error_t **error );
+
 int libfsxfs_directory_read_file_io_handle(
      libfsxfs_directory_t *directory,
      libfsxfs_io_handle_t *io_handle,
@@ -60,6 +147,67 @@ int libfsxfs_directory_read_file_io_handle(
      libfsxfs_inode_t *inode,
      libcerror_error_t **error );
 
+int libfsxfs_directory_get_block_file_offset(
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t logical_block_number,
+     uint32_t number_of_blocks,
+     off64_t *file_offset,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_read_block_data(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_read_entry_by_address(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint32_t address,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_get_leaf_entry_index_by_name_hash(
+     const uint8_t *entries_data,
+     uint16_t number_of_entries,
+     uint32_t name_hash,
+     uint16_t *entry_index,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_read_entries_by_name_hash(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint32_t name_hash,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_read_entry_by_utf8_name(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_read_entry_by_utf16_name(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
 int libfsxfs_directory_get_number_of_entries(
      libfsxfs_directory_t *directory,
      int *number_of_entries,
@@ -68,21 +216,21 @@ int libfsxfs_directory_get_number_of_entries(
 int libfsxfs_directory_get_entry_by_index(
      libfsxfs_directory_t *directory,
      int entry_index,
-     libfsxfs_directory_entry_t **directory_entry,
+     libfsxfs_directory_entry_t *directory_entry,
      libcerror_error_t **error );
 
 int libfsxfs_directory_get_entry_by_utf8_name(
      libfsxfs_directory_t *directory,
      const uint8_t *utf8_string,
      size_t utf8_string_length,
-     libfsxfs_directory_entry_t **directory_entry,
+     libfsxfs_directory_entry_t *directory_entry,
      libcerror_error_t **error );
 
 int libfsxfs_directory_get_entry_by_utf16_name(
      libfsxfs_directory_t *directory,
      const uint16_t *utf16_string,
      size_t utf16_string_length,
-     libfsxfs_directory_entry_t **directory_entry,
+     libfsxfs_directory_entry_t *directory_entry,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
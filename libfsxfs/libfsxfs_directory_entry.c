@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsxfs_definitions.h"
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libuna.h"
@@ -246,6 +247,75 @@ int libfsxfs_directory_entry_get_inode_number(
 	return( 1 );
 }
 
+/* Retrieves the file type
+ * The file type is one of the LIBFSXFS_FILE_TYPE values, as used in the file mode
+ * Returns 1 if successful, 0 if the file type is not stored in the directory entry or -1 on error
+ */
+int libfsxfs_directory_entry_get_file_type(
+     libfsxfs_directory_entry_t *directory_entry,
+     uint16_t *file_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_entry_get_file_type";
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
+		 function );
+
+		return( -1 );
+	}
+	switch( directory_entry->file_type )
+	{
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_REGULAR_FILE:
+			*file_type = LIBFSXFS_FILE_TYPE_REGULAR_FILE;
+			break;
+
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_DIRECTORY:
+			*file_type = LIBFSXFS_FILE_TYPE_DIRECTORY;
+			break;
+
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_CHARACTER_DEVICE:
+			*file_type = LIBFSXFS_FILE_TYPE_CHARACTER_DEVICE;
+			break;
+
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_BLOCK_DEVICE:
+			*file_type = LIBFSXFS_FILE_TYPE_BLOCK_DEVICE;
+			break;
+
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_FIFO:
+			*file_type = LIBFSXFS_FILE_TYPE_FIFO;
+			break;
+
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_SOCKET:
+			*file_type = LIBFSXFS_FILE_TYPE_SOCKET;
+			break;
+
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_SYMBOLIC_LINK:
+			*file_type = LIBFSXFS_FILE_TYPE_SYMBOLIC_LINK;
+			break;
+
+		default:
+			return( 0 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-8 encoded name
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -46,6 +46,10 @@ struct libfsxfs_directory_entry
 	/* Name size
 	 */
 	uint8_t name_size;
+
+	/* The file type, LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_UNKNOWN if not stored in the directory entry
+	 */
+	uint8_t file_type;
 };
 
 int libfsxfs_directory_entry_initialize(
@@ -66,6 +70,11 @@ int libfsxfs_directory_entry_get_inode_number(
      uint64_t *inode_number,
      libcerror_error_t **error );
 
+int libfsxfs_directory_entry_get_file_type(
+     libfsxfs_directory_entry_t *directory_entry,
+     uint16_t *file_type,
+     libcerror_error_t **error );
+
 int libfsxfs_directory_entry_get_utf8_name_size(
      libfsxfs_directory_entry_t *directory_entry,
      size_t *utf8_string_size,
@@ -0,0 +1,769 @@
+/*
+ * Directory entry cache functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_directory_entry.h"
+#include "libfsxfs_directory_entry_cache.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_name_hash.h"
+
+/* Creates a directory entry cache
+ * Make sure the value directory_entry_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_entry_cache_initialize(
+     libfsxfs_directory_entry_cache_t **directory_entry_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_entry_cache_initialize";
+	size_t values_size    = 0;
+	int number_of_values  = 1;
+
+	if( directory_entry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_entry_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entry cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of values is rounded up to a power of 2 so that the value index
+	 * can be determined with a mask
+	 */
+	while( number_of_values < maximum_number_of_entries )
+	{
+		if( number_of_values > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid maximum number of entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_values <<= 1;
+	}
+	values_size = sizeof( libfsxfs_directory_entry_cache_value_t ) * (size_t) number_of_values;
+
+	if( values_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*directory_entry_cache = memory_allocate_structure(
+	                          libfsxfs_directory_entry_cache_t );
+
+	if( *directory_entry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory entry cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *directory_entry_cache,
+	     0,
+	     sizeof( libfsxfs_directory_entry_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory entry cache.",
+		 function );
+
+		memory_free(
+		 *directory_entry_cache );
+
+		*directory_entry_cache = NULL;
+
+		return( -1 );
+	}
+	( *directory_entry_cache )->values = (libfsxfs_directory_entry_cache_value_t *) memory_allocate(
+	                                                                                   values_size );
+
+	if( ( *directory_entry_cache )->values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *directory_entry_cache )->values,
+	     0,
+	     values_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear values.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *directory_entry_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *directory_entry_cache )->number_of_values = number_of_values;
+
+	return( 1 );
+
+on_error:
+	if( *directory_entry_cache != NULL )
+	{
+		if( ( *directory_entry_cache )->values != NULL )
+		{
+			memory_free(
+			 ( *directory_entry_cache )->values );
+		}
+		memory_free(
+		 *directory_entry_cache );
+
+		*directory_entry_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a directory entry cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_entry_cache_free(
+     libfsxfs_directory_entry_cache_t **directory_entry_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_entry_cache_free";
+	int result            = 1;
+	int value_index       = 0;
+
+	if( directory_entry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_entry_cache != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: number of cache hits\t\t: %" PRIu64 "\n",
+			 function,
+			 ( *directory_entry_cache )->number_of_hits );
+
+			libcnotify_printf(
+			 "%s: number of cache misses\t: %" PRIu64 "\n",
+			 function,
+			 ( *directory_entry_cache )->number_of_misses );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *directory_entry_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		for( value_index = 0;
+		     value_index < ( *directory_entry_cache )->number_of_values;
+		     value_index++ )
+		{
+			if( ( *directory_entry_cache )->values[ value_index ].directory_entry != NULL )
+			{
+				if( libfsxfs_directory_entry_free(
+				     &( ( *directory_entry_cache )->values[ value_index ].directory_entry ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory entry: %d.",
+					 function,
+					 value_index );
+
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 ( *directory_entry_cache )->values );
+
+		memory_free(
+		 *directory_entry_cache );
+
+		*directory_entry_cache = NULL;
+	}
+	return( result );
+}
+
+/* Determines the index of the cache value of a specific parent inode and name
+ * Returns 1 if successful, 0 if the name cannot be cached or -1 on error
+ */
+int libfsxfs_directory_entry_cache_get_value_index(
+     libfsxfs_directory_entry_cache_t *directory_entry_cache,
+     uint64_t parent_inode_number,
+     const uint8_t *name,
+     size_t name_length,
+     int *value_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_entry_cache_get_value_index";
+	uint64_t hash_value   = 0;
+	uint32_t name_hash    = 0;
+
+	if( directory_entry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry_cache->number_of_values <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory entry cache - number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Inode number 0 is used to mark unset cache values and names that do not fit
+	 * in a cache value are not cached
+	 */
+	if( ( parent_inode_number == 0 )
+	 || ( name_length == 0 )
+	 || ( name_length > 255 ) )
+	{
+		return( 0 );
+	}
+	if( libfsxfs_name_hash_calculate_from_utf8_string(
+	     &name_hash,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	hash_value  = parent_inode_number * 0x9e3779b97f4a7c15ULL;
+	hash_value ^= hash_value >> 32;
+	hash_value ^= name_hash;
+
+	*value_index = (int) ( hash_value & (uint64_t) ( directory_entry_cache->number_of_values - 1 ) );
+
+	return( 1 );
+}
+
+/* Retrieves a cached directory entry of a specific parent inode and name
+ * On a cache hit directory_entry is set to a copy of the cached directory entry,
+ * which the caller must free, or to NULL if the name is known not to exist
+ * Returns 1 if successful, 0 if no such value is cached or -1 on error
+ */
+int libfsxfs_directory_entry_cache_get_entry(
+     libfsxfs_directory_entry_cache_t *directory_entry_cache,
+     uint64_t parent_inode_number,
+     const uint8_t *name,
+     size_t name_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_cache_value_t *cache_value = NULL;
+	static char *function                               = "libfsxfs_directory_entry_cache_get_entry";
+	int result                                          = 0;
+	int value_index                                     = 0;
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_directory_entry_cache_get_value_index(
+	          directory_entry_cache,
+	          parent_inode_number,
+	          name,
+	          name_length,
+	          &value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine value index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     directory_entry_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cache_value = &( directory_entry_cache->values[ value_index ] );
+
+	if( ( cache_value->parent_inode_number == parent_inode_number )
+	 && ( (size_t) cache_value->name_length == name_length )
+	 && ( memory_compare(
+	       cache_value->name,
+	       name,
+	       name_length ) == 0 ) )
+	{
+		if( libfsxfs_directory_entry_clone(
+		     directory_entry,
+		     cache_value->directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		directory_entry_cache->number_of_hits += 1;
+
+		result = 1;
+	}
+	else
+	{
+		directory_entry_cache->number_of_misses += 1;
+
+		result = 0;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     directory_entry_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( result );
+
+on_error:
+	if( *directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 directory_entry,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 directory_entry_cache->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets the directory entry of a specific parent inode and name in the cache
+ * A copy of the directory entry is stored, directory_entry can be NULL to record
+ * that the name does not exist in the parent directory
+ * The value previously stored at the same position in the cache is replaced
+ * Returns 1 if successful, 0 if the name cannot be cached or -1 on error
+ */
+int libfsxfs_directory_entry_cache_set_entry(
+     libfsxfs_directory_entry_cache_t *directory_entry_cache,
+     uint64_t parent_inode_number,
+     const uint8_t *name,
+     size_t name_length,
+     libfsxfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_cache_value_t *cache_value = NULL;
+	libfsxfs_directory_entry_t *safe_directory_entry    = NULL;
+	static char *function                               = "libfsxfs_directory_entry_cache_set_entry";
+	int result                                          = 0;
+	int value_index                                     = 0;
+
+	result = libfsxfs_directory_entry_cache_get_value_index(
+	          directory_entry_cache,
+	          parent_inode_number,
+	          name,
+	          name_length,
+	          &value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine value index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsxfs_directory_entry_clone(
+	     &safe_directory_entry,
+	     directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     directory_entry_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	cache_value = &( directory_entry_cache->values[ value_index ] );
+
+	if( cache_value->directory_entry != NULL )
+	{
+		if( libfsxfs_directory_entry_free(
+		     &( cache_value->directory_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cached directory entry.",
+			 function );
+
+			cache_value->parent_inode_number = 0;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+			libcthreads_read_write_lock_release_for_write(
+			 directory_entry_cache->read_write_lock,
+			 NULL );
+#endif
+			goto on_error;
+		}
+	}
+	if( memory_copy(
+	     cache_value->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		cache_value->parent_inode_number = 0;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_write(
+		 directory_entry_cache->read_write_lock,
+		 NULL );
+#endif
+		goto on_error;
+	}
+	cache_value->parent_inode_number = parent_inode_number;
+	cache_value->name_length         = (uint8_t) name_length;
+	cache_value->directory_entry     = safe_directory_entry;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     directory_entry_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( safe_directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the directory entry cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_entry_cache_get_statistics(
+     libfsxfs_directory_entry_cache_t *directory_entry_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_entry_cache_get_statistics";
+
+	if( directory_entry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     directory_entry_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_hits   = directory_entry_cache->number_of_hits;
+	*number_of_misses = directory_entry_cache->number_of_misses;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     directory_entry_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,130 @@
+/*
+ * Directory entry cache functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_DIRECTORY_ENTRY_CACHE_H )
+#define _LIBFSXFS_DIRECTORY_ENTRY_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_directory_entry.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_directory_entry_cache_value libfsxfs_directory_entry_cache_value_t;
+
+struct libfsxfs_directory_entry_cache_value
+{
+	/* The parent (directory) inode number
+	 * 0 if the cache value is not set
+	 */
+	uint64_t parent_inode_number;
+
+	/* The name
+	 */
+	uint8_t name[ 255 ];
+
+	/* The name length
+	 */
+	uint8_t name_length;
+
+	/* The directory entry
+	 * NULL if the name does not exist in the parent directory
+	 */
+	libfsxfs_directory_entry_t *directory_entry;
+};
+
+typedef struct libfsxfs_directory_entry_cache libfsxfs_directory_entry_cache_t;
+
+struct libfsxfs_directory_entry_cache
+{
+	/* The cache values
+	 */
+	libfsxfs_directory_entry_cache_value_t *values;
+
+	/* The number of cache values, which is a power of 2
+	 */
+	int number_of_values;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsxfs_directory_entry_cache_initialize(
+     libfsxfs_directory_entry_cache_t **directory_entry_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_entry_cache_free(
+     libfsxfs_directory_entry_cache_t **directory_entry_cache,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_entry_cache_get_value_index(
+     libfsxfs_directory_entry_cache_t *directory_entry_cache,
+     uint64_t parent_inode_number,
+     const uint8_t *name,
+     size_t name_length,
+     int *value_index,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_entry_cache_get_entry(
+     libfsxfs_directory_entry_cache_t *directory_entry_cache,
+     uint64_t parent_inode_number,
+     const uint8_t *name,
+     size_t name_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_entry_cache_set_entry(
+     libfsxfs_directory_entry_cache_t *directory_entry_cache,
+     uint64_t parent_inode_number,
+     const uint8_t *name,
+     size_t name_length,
+     libfsxfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_entry_cache_get_statistics(
+     libfsxfs_directory_entry_cache_t *directory_entry_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_DIRECTORY_ENTRY_CACHE_H ) */
+
@@ -0,0 +1,817 @@
+/*
+ * Directory iterator functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_block_directory.h"
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_directory.h"
+#include "libfsxfs_directory_entry.h"
+#include "libfsxfs_directory_iterator.h"
+#include "libfsxfs_directory_table.h"
+#include "libfsxfs_extent_map.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+
+/* Creates a directory iterator
+ * Make sure the value directory_iterator is referencing, is set to NULL
+ * The directory iterator references the inode, which must remain valid while the iterator is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_iterator_initialize(
+     libfsxfs_directory_iterator_t **directory_iterator,
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_iterator_initialize";
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_iterator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory iterator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	*directory_iterator = memory_allocate_structure(
+	                       libfsxfs_directory_iterator_t );
+
+	if( *directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory iterator.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *directory_iterator,
+	     0,
+	     sizeof( libfsxfs_directory_iterator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory iterator.",
+		 function );
+
+		memory_free(
+		 *directory_iterator );
+
+		*directory_iterator = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *directory_iterator )->entries_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+	( *directory_iterator )->io_handle = io_handle;
+	( *directory_iterator )->inode     = inode;
+
+	return( 1 );
+
+on_error:
+	if( *directory_iterator != NULL )
+	{
+		memory_free(
+		 *directory_iterator );
+
+		*directory_iterator = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a directory iterator
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_iterator_free(
+     libfsxfs_directory_iterator_t **directory_iterator,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_iterator_free";
+	int result            = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_iterator != NULL )
+	{
+		/* The io_handle and inode references are freed elsewhere
+		 */
+		if( libcdata_array_free(
+		     &( ( *directory_iterator )->entries_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *directory_iterator );
+
+		*directory_iterator = NULL;
+	}
+	return( result );
+}
+
+/* Reads the entries of the first directory data block at or after the current block number
+ * Only the entries of a single directory data block are kept in memory
+ * Returns 1 if successful, 0 if there are no more directory data blocks or -1 on error
+ */
+int libfsxfs_directory_iterator_read_block(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsxfs_block_directory_t *block_directory = NULL;
+	libfsxfs_directory_table_t *directory_table = NULL;
+	libfsxfs_extent_map_t *extent_map           = NULL;
+	libfsxfs_inode_t *inode                     = NULL;
+	libfsxfs_io_handle_t *io_handle             = NULL;
+	static char *function                       = "libfsxfs_directory_iterator_read_block";
+	off64_t file_offset                         = 0;
+	uint64_t extent_block_number                = 0;
+	uint64_t extent_end_block_number            = 0;
+	uint64_t maximum_block_number               = 0;
+	uint64_t next_block_number                  = 0;
+	uint32_t number_of_blocks                   = 0;
+	uint8_t next_block_found                    = 0;
+	int extent_index                            = 0;
+	int result                                  = 0;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle = directory_iterator->io_handle;
+	inode     = directory_iterator->inode;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     directory_iterator->entries_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty entries array.",
+		 function );
+
+		return( -1 );
+	}
+	directory_iterator->block_is_read = 0;
+
+	if( ( inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY )
+	{
+		return( 0 );
+	}
+	if( inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA )
+	{
+		/* The entries of a short-form directory are stored in the inode
+		 * and are treated as directory data block 0
+		 */
+		if( directory_iterator->block_number != 0 )
+		{
+			return( 0 );
+		}
+		if( libfsxfs_directory_table_initialize(
+		     &directory_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize directory table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_table_read_data(
+		     directory_table,
+		     io_handle,
+		     inode->inline_data,
+		     (size_t) inode->size,
+		     directory_iterator->entries_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_table_free(
+		     &directory_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory table.",
+			 function );
+
+			goto on_error;
+		}
+		directory_iterator->block_is_read = 1;
+
+		return( 1 );
+	}
+	if( ( inode->fork_type != LIBFSXFS_FORK_TYPE_EXTENTS )
+	 && ( inode->fork_type != LIBFSXFS_FORK_TYPE_BTREE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported directory data fork type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->block_size == 0 )
+	 || ( io_handle->directory_block_size < io_handle->block_size )
+	 || ( ( io_handle->directory_block_size % io_handle->block_size ) != 0 )
+	 || ( io_handle->directory_block_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - directory block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks     = io_handle->directory_block_size / io_handle->block_size;
+	maximum_block_number = (uint64_t) LIBFSXFS_DIRECTORY_LEAF_OFFSET / io_handle->directory_block_size;
+
+	if( directory_iterator->block_number >= maximum_block_number )
+	{
+		return( 0 );
+	}
+	extent_map = inode->data_extent_map;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode - missing data extent map.",
+		 function );
+
+		return( -1 );
+	}
+	extent_index = directory_iterator->extent_index;
+
+	if( extent_index < 0 )
+	{
+		/* The cookie was set, reposition the extent cursor
+		 */
+		if( libfsxfs_extent_map_get_extent_index_by_logical_block_number(
+		     extent_map,
+		     directory_iterator->block_number * number_of_blocks,
+		     &extent_index,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent of directory data block: %" PRIu64 ".",
+			 function,
+			 directory_iterator->block_number );
+
+			return( -1 );
+		}
+	}
+	/* Determine the first directory data block at or after the current block number
+	 * that is mapped by an extent, since directory data can contain holes. The extents
+	 * are sorted by logical block number, hence the extent cursor only moves forward
+	 */
+	while( extent_index < extent_map->number_of_extents )
+	{
+		if( ( extent_map->range_flags[ extent_index ] & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) == 0 )
+		{
+			extent_block_number = extent_map->logical_block_numbers[ extent_index ] / number_of_blocks;
+
+			if( extent_block_number >= maximum_block_number )
+			{
+				break;
+			}
+			extent_end_block_number = ( extent_map->logical_block_numbers[ extent_index ] + extent_map->numbers_of_blocks[ extent_index ] + number_of_blocks - 1 ) / number_of_blocks;
+
+			if( directory_iterator->block_number < extent_end_block_number )
+			{
+				if( extent_block_number < directory_iterator->block_number )
+				{
+					extent_block_number = directory_iterator->block_number;
+				}
+				next_block_number = extent_block_number;
+				next_block_found  = 1;
+
+				break;
+			}
+		}
+		extent_index++;
+	}
+	directory_iterator->extent_index = extent_index;
+
+	if( next_block_found == 0 )
+	{
+		return( 0 );
+	}
+	result = libfsxfs_extent_map_get_file_offset_by_extent_index(
+	          extent_map,
+	          io_handle,
+	          extent_index,
+	          next_block_number * number_of_blocks,
+	          (uint64_t) number_of_blocks,
+	          &file_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file offset of directory data block: %" PRIu64 ".",
+		 function,
+		 next_block_number );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported directory data block: %" PRIu64 " not contiguously mapped.",
+		 function,
+		 next_block_number );
+
+		return( -1 );
+	}
+	if( next_block_number != directory_iterator->block_number )
+	{
+		directory_iterator->block_number = next_block_number;
+		directory_iterator->entry_index  = 0;
+	}
+	if( libfsxfs_block_directory_initialize(
+	     &block_directory,
+	     (size_t) io_handle->directory_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize block directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_block_directory_read_file_io_handle(
+	     block_directory,
+	     io_handle,
+	     file_io_handle,
+	     file_offset,
+	     directory_iterator->entries_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory data block: %" PRIu64 ".",
+		 function,
+		 next_block_number );
+
+		goto on_error;
+	}
+	if( libfsxfs_block_directory_free(
+	     &block_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block directory.",
+		 function );
+
+		goto on_error;
+	}
+	directory_iterator->block_is_read = 1;
+
+	return( 1 );
+
+on_error:
+	if( block_directory != NULL )
+	{
+		libfsxfs_block_directory_free(
+		 &block_directory,
+		 NULL );
+	}
+	if( directory_table != NULL )
+	{
+		libfsxfs_directory_table_free(
+		 &directory_table,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 directory_iterator->entries_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the entry at the current position
+ * The directory entry is managed by the directory iterator and remains valid
+ * until the position of the directory iterator is changed
+ * Returns 1 if successful, 0 if there are no more entries or -1 on error
+ */
+int libfsxfs_directory_iterator_get_entry(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_iterator_get_entry";
+	int number_of_entries = 0;
+	int result            = 0;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	while( 1 )
+	{
+		if( directory_iterator->block_is_read == 0 )
+		{
+			result = libfsxfs_directory_iterator_read_block(
+			          directory_iterator,
+			          file_io_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory data block: %" PRIu64 ".",
+				 function,
+				 directory_iterator->block_number );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				return( 0 );
+			}
+		}
+		if( libcdata_array_get_number_of_entries(
+		     directory_iterator->entries_array,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries.",
+			 function );
+
+			return( -1 );
+		}
+		if( directory_iterator->entry_index < number_of_entries )
+		{
+			break;
+		}
+		/* Continue with the next directory data block
+		 */
+		directory_iterator->block_number += 1;
+		directory_iterator->entry_index   = 0;
+		directory_iterator->block_is_read = 0;
+	}
+	if( libcdata_array_get_entry_by_index(
+	     directory_iterator->entries_array,
+	     directory_iterator->entry_index,
+	     (intptr_t **) directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 directory_iterator->entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Moves the directory iterator to the next entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_iterator_next_entry(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_iterator_next_entry";
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_iterator->entry_index == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory iterator - entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	directory_iterator->entry_index += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the cookie of the current position
+ * The cookie contains the directory data block number in the upper 32-bits
+ * and the index of the entry in the directory data block in the lower 32-bits
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_iterator_get_cookie(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     uint64_t *cookie,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_iterator_get_cookie";
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_iterator->block_number > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory iterator - block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( cookie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cookie.",
+		 function );
+
+		return( -1 );
+	}
+	*cookie = ( directory_iterator->block_number << 32 ) | (uint32_t) directory_iterator->entry_index;
+
+	return( 1 );
+}
+
+/* Sets the current position to the position of a cookie
+ * A cookie of 0 refers to the first entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_iterator_set_cookie(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     uint64_t cookie,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_iterator_set_cookie";
+	uint64_t block_number = 0;
+	uint32_t entry_index  = 0;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	block_number = cookie >> 32;
+	entry_index  = (uint32_t) ( cookie & 0xffffffffUL );
+
+	if( entry_index > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cookie - entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_iterator->block_is_read != 0 )
+	 && ( block_number == directory_iterator->block_number ) )
+	{
+		/* The entries of the directory data block can be reused
+		 */
+		directory_iterator->entry_index = (int) entry_index;
+
+		return( 1 );
+	}
+	if( libcdata_array_empty(
+	     directory_iterator->entries_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty entries array.",
+		 function );
+
+		return( -1 );
+	}
+	directory_iterator->block_number  = block_number;
+	directory_iterator->entry_index   = (int) entry_index;
+	directory_iterator->extent_index  = -1;
+	directory_iterator->block_is_read = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,114 @@
+/*
+ * Directory iterator functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFSXFS_DIRECTORY_ITERATOR_H )
+#define _LIBFSXFS_DIRECTORY_ITERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_directory_entry.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_directory_iterator libfsxfs_directory_iterator_t;
+
+struct libfsxfs_directory_iterator
+{
+	/* The IO handle
+	 */
+	libfsxfs_io_handle_t *io_handle;
+
+	/* The inode
+	 */
+	libfsxfs_inode_t *inode;
+
+	/* The entries of the current directory data block
+	 */
+	libcdata_array_t *entries_array;
+
+	/* The number of the current directory data block
+	 */
+	uint64_t block_number;
+
+	/* The index of the current entry in the directory data block
+	 */
+	int entry_index;
+
+	/* The index of the data extent map extent at or after the current directory data block,
+	 * -1 if it needs to be determined
+	 */
+	int extent_index;
+
+	/* Value to indicate the entries of the current directory data block were read
+	 */
+	uint8_t block_is_read;
+};
+
+int libfsxfs_directory_iterator_initialize(
+     libfsxfs_directory_iterator_t **directory_iterator,
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_iterator_free(
+     libfsxfs_directory_iterator_t **directory_iterator,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_iterator_read_block(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_iterator_get_entry(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_iterator_next_entry(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_iterator_get_cookie(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     uint64_t *cookie,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_iterator_set_cookie(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     uint64_t cookie,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_DIRECTORY_ITERATOR_H ) */
+
@@ -28,10 +28,14 @@
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_extent.h"
 #include "libfsxfs_extent_btree.h"
+#include "libfsxfs_extent_map.h"
 #include "libfsxfs_extents.h"
 #include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfcache.h"
 
 /* Creates an extent B+ tree
  * Make sure the value extent_btree is referencing, is set to NULL
@@ -91,13 +95,53 @@ int libfsxfs_extent_btree_initialize(
 		 "%s: unable to clear extent B+ tree.",
 		 function );
 
+		memory_free(
+		 *extent_btree );
+
+		*extent_btree = NULL;
+
+		return( -1 );
+	}
+	if( libfcache_cache_initialize(
+	     &( ( *extent_btree )->leaf_node_cache ),
+	     LIBFSXFS_MAXIMUM_NUMBER_OF_CACHED_EXTENT_BTREE_LEAF_NODES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create leaf node cache.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *extent_btree )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
 		goto on_error;
 	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *extent_btree != NULL )
 	{
+		if( ( *extent_btree )->leaf_node_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *extent_btree )->leaf_node_cache ),
+			 NULL );
+		}
 		memory_free(
 		 *extent_btree );
 
@@ -114,6 +158,7 @@ int libfsxfs_extent_btree_free(
      libcerror_error_t **error )
 {
 	static char *function = "libfsxfs_extent_btree_free";
+	int result            = 1;
 
 	if( extent_btree == NULL )
 	{
@@ -128,12 +173,50 @@ int libfsxfs_extent_btree_free(
 	}
 	if( *extent_btree != NULL )
 	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *extent_btree )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libfcache_cache_free(
+		     &( ( *extent_btree )->leaf_node_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free leaf node cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *extent_btree )->root_node_sub_block_numbers != NULL )
+		{
+			memory_free(
+			 ( *extent_btree )->root_node_sub_block_numbers );
+		}
+		if( ( *extent_btree )->root_node_keys != NULL )
+		{
+			memory_free(
+			 ( *extent_btree )->root_node_keys );
+		}
 		memory_free(
 		 *extent_btree );
 
 		*extent_btree = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the extents from the extent B+ tree root node
@@ -538,25 +621,22 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the extents from the extent B+ tree node
+/* Reads an extent B+ tree node block
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_extent_btree_get_extents_from_node(
+int libfsxfs_extent_btree_read_node_block(
      libfsxfs_extent_btree_t *extent_btree,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint64_t block_number,
-     libcdata_array_t *extents_array,
-     uint8_t add_sparse_extents,
-     int recursion_depth,
+     libfsxfs_btree_block_t **btree_block,
      libcerror_error_t **error )
 {
-	libfsxfs_btree_block_t *btree_block = NULL;
-	static char *function               = "libfsxfs_extent_btree_get_exents_from_node";
-	off64_t btree_block_offset          = 0;
-	uint64_t relative_block_number      = 0;
-	int allocation_group_index          = 0;
-	int compare_result                  = 0;
+	static char *function          = "libfsxfs_extent_btree_read_node_block";
+	off64_t btree_block_offset     = 0;
+	uint64_t relative_block_number = 0;
+	int allocation_group_index     = 0;
+	int compare_result             = 0;
 
 	if( extent_btree == NULL )
 	{
@@ -602,6 +682,28 @@ int libfsxfs_extent_btree_get_extents_from_node(
 
 		return( -1 );
 	}
+	if( btree_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B+ tree block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *btree_block != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid B+ tree block value already set.",
+		 function );
+
+		return( -1 );
+	}
 	allocation_group_index = (int) ( block_number >> io_handle->number_of_relative_block_number_bits );
 	relative_block_number  = block_number & ( ( 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
 
@@ -626,7 +728,7 @@ int libfsxfs_extent_btree_get_extents_from_node(
 	btree_block_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
 
 	if( libfsxfs_btree_block_initialize(
-	     &btree_block,
+	     btree_block,
 	     io_handle->block_size,
 	     8,
 	     error ) != 1 )
@@ -641,7 +743,7 @@ int libfsxfs_extent_btree_get_extents_from_node(
 		goto on_error;
 	}
 	if( libfsxfs_btree_block_read_file_io_handle(
-	     btree_block,
+	     *btree_block,
 	     io_handle,
 	     file_io_handle,
 	     btree_block_offset,
@@ -651,7 +753,7 @@ int libfsxfs_extent_btree_get_extents_from_node(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read extent B+ tree block: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 "%s: unable to read extent B+ tree block: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
 		 block_number,
 		 btree_block_offset,
@@ -662,14 +764,14 @@ int libfsxfs_extent_btree_get_extents_from_node(
 	if( io_handle->format_version == 5 )
 	{
 		compare_result = memory_compare(
-		                  btree_block->header->signature,
+		                  ( *btree_block )->header->signature,
 		                  "BMA3",
 		                  4 );
 	}
 	else
 	{
 		compare_result = memory_compare(
-		                  btree_block->header->signature,
+		                  ( *btree_block )->header->signature,
 		                  "BMAP",
 		                  4 );
 	}
@@ -684,7 +786,7 @@ int libfsxfs_extent_btree_get_extents_from_node(
 
 		goto on_error;
 	}
-	if( btree_block->header->level > extent_btree->maximum_depth )
+	if( ( *btree_block )->header->level > extent_btree->maximum_depth )
 	{
 		libcerror_error_set(
 		 error,
@@ -695,6 +797,52 @@ int libfsxfs_extent_btree_get_extents_from_node(
 
 		goto on_error;
 	}
+	return( 1 );
+
+on_error:
+	if( *btree_block != NULL )
+	{
+		libfsxfs_btree_block_free(
+		 btree_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the extents from the extent B+ tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_btree_get_extents_from_node(
+     libfsxfs_extent_btree_t *extent_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t block_number,
+     libcdata_array_t *extents_array,
+     uint8_t add_sparse_extents,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsxfs_btree_block_t *btree_block = NULL;
+	static char *function               = "libfsxfs_extent_btree_get_exents_from_node";
+
+	if( libfsxfs_extent_btree_read_node_block(
+	     extent_btree,
+	     io_handle,
+	     file_io_handle,
+	     block_number,
+	     &btree_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read extent B+ tree node: %" PRIu64 ".",
+		 function,
+		 block_number );
+
+		goto on_error;
+	}
 	if( btree_block->header->level == 0 )
 	{
 		if( libfsxfs_extents_read_data(
@@ -769,3 +917,897 @@ on_error:
 	return( -1 );
 }
 
+
+/* Reads the extent B+ tree root node
+ * Only the keys and sub block numbers of the root node are kept, the sub nodes are read on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_btree_read_root_node(
+     libfsxfs_extent_btree_t *extent_btree,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "libfsxfs_extent_btree_read_root_node";
+	size_t keys_data_offset          = 0;
+	size_t number_of_key_value_pairs = 0;
+	size_t values_data_offset        = 0;
+	uint16_t level                   = 0;
+	uint16_t number_of_records       = 0;
+	uint16_t record_index            = 0;
+
+	if( extent_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_btree->root_node_keys != NULL )
+	 || ( extent_btree->root_node_sub_block_numbers != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent B+ tree - root node values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 4 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 &( data[ 0 ] ),
+	 level );
+
+	byte_stream_copy_to_uint16_big_endian(
+	 &( data[ 2 ] ),
+	 number_of_records );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: node level\t\t: %" PRIu16 "\n",
+		 function,
+		 level );
+
+		libcnotify_printf(
+		 "%s: number of records\t: %" PRIu16 "\n",
+		 function,
+		 number_of_records );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( level == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported B+ tree root node level.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_key_value_pairs = ( data_size - 4 ) / 16;
+
+	if( (size_t) number_of_records > number_of_key_value_pairs )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records > 0 )
+	{
+		extent_btree->root_node_keys = (uint64_t *) memory_allocate(
+		                                             sizeof( uint64_t ) * number_of_records );
+
+		if( extent_btree->root_node_keys == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create root node keys.",
+			 function );
+
+			goto on_error;
+		}
+		extent_btree->root_node_sub_block_numbers = (uint64_t *) memory_allocate(
+		                                                          sizeof( uint64_t ) * number_of_records );
+
+		if( extent_btree->root_node_sub_block_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create root node sub block numbers.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	keys_data_offset   = 4;
+	values_data_offset = 4 + ( number_of_key_value_pairs * 8 );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint64_big_endian(
+		 &( data[ keys_data_offset ] ),
+		 extent_btree->root_node_keys[ record_index ] );
+
+		byte_stream_copy_to_uint64_big_endian(
+		 &( data[ values_data_offset ] ),
+		 extent_btree->root_node_sub_block_numbers[ record_index ] );
+
+		keys_data_offset   += 8;
+		values_data_offset += 8;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: key: %" PRIu16 "\t\t: %" PRIu64 "\n",
+			 function,
+			 record_index,
+			 extent_btree->root_node_keys[ record_index ] );
+
+			libcnotify_printf(
+			 "%s: value: %" PRIu16 "\t\t: %" PRIu64 "\n",
+			 function,
+			 record_index,
+			 extent_btree->root_node_sub_block_numbers[ record_index ] );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		if( ( record_index > 0 )
+		 && ( extent_btree->root_node_keys[ record_index ] <= extent_btree->root_node_keys[ record_index - 1 ] ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported root node key: %" PRIu16 " - keys not in ascending order.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	extent_btree->maximum_depth               = (uint32_t) level;
+	extent_btree->root_node_level             = level;
+	extent_btree->number_of_root_node_records = number_of_records;
+
+	return( 1 );
+
+on_error:
+	if( extent_btree->root_node_sub_block_numbers != NULL )
+	{
+		memory_free(
+		 extent_btree->root_node_sub_block_numbers );
+
+		extent_btree->root_node_sub_block_numbers = NULL;
+	}
+	if( extent_btree->root_node_keys != NULL )
+	{
+		memory_free(
+		 extent_btree->root_node_keys );
+
+		extent_btree->root_node_keys = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the extent map of the leaf node that contains a specific logical block number
+ * The leaf node is read on demand and stored in the leaf node cache, the extent map
+ * is managed by the cache and remains valid until the next leaf node is retrieved
+ * next_logical_block_number contains the first logical block number that is not covered
+ * by the leaf node or UINT64_MAX if the leaf node covers the remainder of the data
+ * Returns 1 if successful, 0 if the logical block number precedes the first leaf node or -1 on error
+ */
+int libfsxfs_extent_btree_get_leaf_node_by_logical_block_number(
+     libfsxfs_extent_btree_t *extent_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t logical_block_number,
+     libfsxfs_extent_map_t **extent_map,
+     uint64_t *next_logical_block_number,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *extents_array       = NULL;
+	libfcache_cache_value_t *cache_value  = NULL;
+	libfsxfs_btree_block_t *btree_block   = NULL;
+	libfsxfs_extent_map_t *leaf_node      = NULL;
+	static char *function                 = "libfsxfs_extent_btree_get_leaf_node_by_logical_block_number";
+	size_t number_of_key_value_pairs      = 0;
+	uint64_t key                          = 0;
+	uint64_t next_key                     = UINT64_MAX;
+	uint64_t sub_block_number             = 0;
+	uint16_t node_level                   = 0;
+	uint16_t number_of_records            = 0;
+	uint16_t record_index                 = 0;
+	uint16_t record_index_lower_bound     = 0;
+	uint16_t record_index_upper_bound     = 0;
+	int result                            = 0;
+
+	if( extent_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_btree->number_of_root_node_records > 0 )
+	 && ( ( extent_btree->root_node_keys == NULL )
+	  ||  ( extent_btree->root_node_sub_block_numbers == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid extent B+ tree - missing root node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_logical_block_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next logical block number.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_btree->number_of_root_node_records == 0 )
+	 || ( logical_block_number < extent_btree->root_node_keys[ 0 ] ) )
+	{
+		if( extent_btree->number_of_root_node_records == 0 )
+		{
+			*next_logical_block_number = UINT64_MAX;
+		}
+		else
+		{
+			*next_logical_block_number = extent_btree->root_node_keys[ 0 ];
+		}
+		return( 0 );
+	}
+	/* Find the last root node record with a key that is less than or equal to the logical block number
+	 */
+	record_index_lower_bound = 0;
+	record_index_upper_bound = extent_btree->number_of_root_node_records;
+
+	while( ( record_index_upper_bound - record_index_lower_bound ) > 1 )
+	{
+		record_index = record_index_lower_bound + ( ( record_index_upper_bound - record_index_lower_bound ) / 2 );
+
+		if( extent_btree->root_node_keys[ record_index ] <= logical_block_number )
+		{
+			record_index_lower_bound = record_index;
+		}
+		else
+		{
+			record_index_upper_bound = record_index;
+		}
+	}
+	record_index     = record_index_lower_bound;
+	sub_block_number = extent_btree->root_node_sub_block_numbers[ record_index ];
+
+	if( ( record_index + 1 ) < extent_btree->number_of_root_node_records )
+	{
+		next_key = extent_btree->root_node_keys[ record_index + 1 ];
+	}
+	node_level = extent_btree->root_node_level;
+
+	while( leaf_node == NULL )
+	{
+		result = libfcache_cache_get_value_by_identifier(
+		          extent_btree->leaf_node_cache,
+		          0,
+		          (off64_t) sub_block_number,
+		          0,
+		          &cache_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from leaf node cache.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &leaf_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve leaf node from cache value.",
+				 function );
+
+				goto on_error;
+			}
+			if( leaf_node != NULL )
+			{
+				break;
+			}
+		}
+		if( libfsxfs_extent_btree_read_node_block(
+		     extent_btree,
+		     io_handle,
+		     file_io_handle,
+		     sub_block_number,
+		     &btree_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extent B+ tree node: %" PRIu64 ".",
+			 function,
+			 sub_block_number );
+
+			goto on_error;
+		}
+		/* The node level must decrease with every step to guarantee the descent terminates
+		 */
+		if( btree_block->header->level >= node_level )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported B+ tree node level.",
+			 function );
+
+			goto on_error;
+		}
+		node_level        = btree_block->header->level;
+		number_of_records = btree_block->header->number_of_records;
+
+		if( node_level == 0 )
+		{
+			if( libcdata_array_initialize(
+			     &extents_array,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create extents array.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_extents_read_data(
+			     extents_array,
+			     (uint32_t) number_of_records,
+			     btree_block->records_data,
+			     btree_block->records_data_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read leaf node extents.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_extent_map_initialize(
+			     &leaf_node,
+			     extents_array,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create leaf node extent map.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcdata_array_free(
+			     &extents_array,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free extents array.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfcache_cache_set_value_by_identifier(
+			     extent_btree->leaf_node_cache,
+			     0,
+			     (off64_t) sub_block_number,
+			     0,
+			     (intptr_t *) leaf_node,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_map_free,
+			     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set leaf node in cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			number_of_key_value_pairs = btree_block->records_data_size / 16;
+
+			if( ( number_of_records == 0 )
+			 || ( (size_t) number_of_records > number_of_key_value_pairs ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of records value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			record_index_lower_bound = 0;
+			record_index_upper_bound = number_of_records;
+
+			while( ( record_index_upper_bound - record_index_lower_bound ) > 1 )
+			{
+				record_index = record_index_lower_bound + ( ( record_index_upper_bound - record_index_lower_bound ) / 2 );
+
+				byte_stream_copy_to_uint64_big_endian(
+				 &( btree_block->records_data[ record_index * 8 ] ),
+				 key );
+
+				if( key <= logical_block_number )
+				{
+					record_index_lower_bound = record_index;
+				}
+				else
+				{
+					record_index_upper_bound = record_index;
+				}
+			}
+			record_index = record_index_lower_bound;
+
+			byte_stream_copy_to_uint64_big_endian(
+			 &( btree_block->records_data[ ( number_of_key_value_pairs + record_index ) * 8 ] ),
+			 sub_block_number );
+
+			if( ( record_index + 1 ) < number_of_records )
+			{
+				byte_stream_copy_to_uint64_big_endian(
+				 &( btree_block->records_data[ ( record_index + 1 ) * 8 ] ),
+				 key );
+
+				if( key < next_key )
+				{
+					next_key = key;
+				}
+			}
+		}
+		if( libfsxfs_btree_block_free(
+		     &btree_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free B+ tree block.",
+			 function );
+
+			leaf_node = NULL;
+
+			goto on_error;
+		}
+	}
+	*extent_map                = leaf_node;
+	*next_logical_block_number = next_key;
+
+	return( 1 );
+
+on_error:
+	if( ( leaf_node != NULL )
+	 && ( btree_block != NULL ) )
+	{
+		/* The leaf node was not yet stored in the cache
+		 */
+		libfsxfs_extent_map_free(
+		 &leaf_node,
+		 NULL );
+	}
+	if( extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+		 NULL );
+	}
+	if( btree_block != NULL )
+	{
+		libfsxfs_btree_block_free(
+		 &btree_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads data at a specific logical offset into a buffer
+ * The leaf nodes of the extent B+ tree are read on demand, blocks that are not covered
+ * by an extent are sparse and are returned as 0-byte values
+ * The lock is only held while retrieving a leaf node and copying the extent that is read,
+ * the data is read without holding the lock
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_extent_btree_read_buffer_at_offset(
+         libfsxfs_extent_btree_t *extent_btree,
+         libfsxfs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfsxfs_extent_map_t extent_run;
+
+	libfsxfs_extent_map_t *leaf_node      = NULL;
+	static char *function                 = "libfsxfs_extent_btree_read_buffer_at_offset";
+	size64_t range_size                   = 0;
+	size_t buffer_offset                  = 0;
+	size_t read_size                      = 0;
+	ssize_t read_count                    = 0;
+	uint64_t extent_logical_block_number  = 0;
+	uint64_t extent_number_of_blocks      = 0;
+	uint64_t extent_physical_block_number = 0;
+	uint64_t logical_block_number         = 0;
+	uint64_t next_logical_block_number    = 0;
+	uint32_t extent_range_flags           = 0;
+	int extent_index                      = 0;
+	int result                            = 0;
+
+	if( extent_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* The extent run refers to a copy of a single extent of the leaf node
+	 */
+	extent_run.logical_block_numbers  = &extent_logical_block_number;
+	extent_run.physical_block_numbers = &extent_physical_block_number;
+	extent_run.numbers_of_blocks      = &extent_number_of_blocks;
+	extent_run.range_flags            = &extent_range_flags;
+	extent_run.number_of_extents      = 0;
+
+	while( buffer_offset < buffer_size )
+	{
+		logical_block_number = (uint64_t) offset / io_handle->block_size;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     extent_btree->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		result = libfsxfs_extent_btree_get_leaf_node_by_logical_block_number(
+		          extent_btree,
+		          io_handle,
+		          file_io_handle,
+		          logical_block_number,
+		          &leaf_node,
+		          &next_logical_block_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf node of logical block: %" PRIu64 ".",
+			 function,
+			 logical_block_number );
+
+			goto on_error;
+		}
+		if( next_logical_block_number <= logical_block_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid next logical block number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		extent_run.number_of_extents = 0;
+
+		if( result != 0 )
+		{
+			/* The leaf node can be removed from the cache once the lock is released,
+			 * hence the extent that contains or follows the logical block number is copied
+			 */
+			if( libfsxfs_extent_map_get_extent_index_by_logical_block_number(
+			     leaf_node,
+			     logical_block_number,
+			     &extent_index,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extent of logical block: %" PRIu64 ".",
+				 function,
+				 logical_block_number );
+
+				goto on_error;
+			}
+			if( extent_index < leaf_node->number_of_extents )
+			{
+				extent_logical_block_number  = leaf_node->logical_block_numbers[ extent_index ];
+				extent_physical_block_number = leaf_node->physical_block_numbers[ extent_index ];
+				extent_number_of_blocks      = leaf_node->numbers_of_blocks[ extent_index ];
+				extent_range_flags           = leaf_node->range_flags[ extent_index ];
+
+				extent_run.number_of_extents = 1;
+			}
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     extent_btree->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		read_size = buffer_size - buffer_offset;
+
+		/* Restrict the read to the range covered by the leaf node
+		 */
+		if( next_logical_block_number <= ( (uint64_t) INT64_MAX / io_handle->block_size ) )
+		{
+			range_size = ( next_logical_block_number * io_handle->block_size ) - (size64_t) offset;
+
+			if( (size64_t) read_size > range_size )
+			{
+				read_size = (size_t) range_size;
+			}
+		}
+		/* Restrict the read to the end of the copied extent
+		 */
+		if( ( extent_run.number_of_extents != 0 )
+		 && ( ( extent_logical_block_number + extent_number_of_blocks ) <= ( (uint64_t) INT64_MAX / io_handle->block_size ) ) )
+		{
+			range_size = ( ( extent_logical_block_number + extent_number_of_blocks ) * io_handle->block_size ) - (size64_t) offset;
+
+			if( (size64_t) read_size > range_size )
+			{
+				read_size = (size_t) range_size;
+			}
+		}
+		if( result == 0 )
+		{
+			if( memory_set(
+			     &( buffer[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to set sparse data in buffer.",
+				 function );
+
+				return( -1 );
+			}
+			read_count = (ssize_t) read_size;
+		}
+		else
+		{
+			read_count = libfsxfs_extent_map_read_buffer_at_offset(
+			              &extent_run,
+			              io_handle,
+			              file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data from leaf node at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset,
+				 offset );
+
+				return( -1 );
+			}
+		}
+		buffer_offset += (size_t) read_count;
+		offset        += (off64_t) read_count;
+
+		if( io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 extent_btree->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
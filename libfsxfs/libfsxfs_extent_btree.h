@@ -25,10 +25,14 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_btree_block.h"
+#include "libfsxfs_extent_map.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfcache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -41,6 +45,32 @@ struct libfsxfs_extent_btree
 	/* B+ tree maximum depth
 	 */
 	uint32_t maximum_depth;
+
+	/* The root node level
+	 */
+	uint16_t root_node_level;
+
+	/* The number of root node records
+	 */
+	uint16_t number_of_root_node_records;
+
+	/* The root node keys, contains the first logical block number of every sub node
+	 */
+	uint64_t *root_node_keys;
+
+	/* The root node sub block numbers
+	 */
+	uint64_t *root_node_sub_block_numbers;
+
+	/* The leaf node cache, contains an extent map per leaf node
+	 */
+	libfcache_cache_t *leaf_node_cache;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsxfs_extent_btree_initialize(
@@ -74,6 +104,14 @@ int libfsxfs_extent_btree_get_extents_from_branch_node(
      int recursion_depth,
      libcerror_error_t **error );
 
+int libfsxfs_extent_btree_read_node_block(
+     libfsxfs_extent_btree_t *extent_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t block_number,
+     libfsxfs_btree_block_t **btree_block,
+     libcerror_error_t **error );
+
 int libfsxfs_extent_btree_get_extents_from_node(
      libfsxfs_extent_btree_t *extent_btree,
      libfsxfs_io_handle_t *io_handle,
@@ -84,6 +122,30 @@ int libfsxfs_extent_btree_get_extents_from_node(
      int recursion_depth,
      libcerror_error_t **error );
 
+int libfsxfs_extent_btree_read_root_node(
+     libfsxfs_extent_btree_t *extent_btree,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_btree_get_leaf_node_by_logical_block_number(
+     libfsxfs_extent_btree_t *extent_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t logical_block_number,
+     libfsxfs_extent_map_t **extent_map,
+     uint64_t *next_logical_block_number,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_extent_btree_read_buffer_at_offset(
+         libfsxfs_extent_btree_t *extent_btree,
+         libfsxfs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
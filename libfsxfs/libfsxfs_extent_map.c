@@ -0,0 +1,727 @@
+/*
+ * Extent map functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_extent.h"
+#include "libfsxfs_extent_map.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_memory_mapped_file.h"
+
+/* Creates an extent map from an array of extents
+ * The extents must be sorted by logical block number and must not overlap
+ * Extents that are contiguous both logically and physically and have the same
+ * range flags are merged into a single extent, so that they can be read at once
+ * Make sure the value extent_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_map_initialize(
+     libfsxfs_extent_map_t **extent_map,
+     libcdata_array_t *extents_array,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *extent     = NULL;
+	static char *function         = "libfsxfs_extent_map_initialize";
+	uint64_t logical_block_number = 0;
+	int extent_index              = 0;
+	int map_index                 = -1;
+	int number_of_extents         = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     extents_array,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_extents > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of extents value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_map = memory_allocate_structure(
+	               libfsxfs_extent_map_t );
+
+	if( *extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent_map,
+	     0,
+	     sizeof( libfsxfs_extent_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent map.",
+		 function );
+
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+
+		return( -1 );
+	}
+	if( number_of_extents > 0 )
+	{
+		( *extent_map )->logical_block_numbers = (uint64_t *) memory_allocate(
+		                                                       sizeof( uint64_t ) * number_of_extents );
+
+		if( ( *extent_map )->logical_block_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create logical block numbers.",
+			 function );
+
+			goto on_error;
+		}
+		( *extent_map )->physical_block_numbers = (uint64_t *) memory_allocate(
+		                                                        sizeof( uint64_t ) * number_of_extents );
+
+		if( ( *extent_map )->physical_block_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create physical block numbers.",
+			 function );
+
+			goto on_error;
+		}
+		( *extent_map )->numbers_of_blocks = (uint64_t *) memory_allocate(
+		                                                   sizeof( uint64_t ) * number_of_extents );
+
+		if( ( *extent_map )->numbers_of_blocks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create numbers of blocks.",
+			 function );
+
+			goto on_error;
+		}
+		( *extent_map )->range_flags = (uint32_t *) memory_allocate(
+		                                             sizeof( uint32_t ) * number_of_extents );
+
+		if( ( *extent_map )->range_flags == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create range flags.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     extents_array,
+		     extent_index,
+		     (intptr_t **) &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( ( extent->logical_block_number < logical_block_number )
+		 || ( extent->logical_block_number > ( (uint64_t) UINT64_MAX - extent->number_of_blocks ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extent: %d - logical block number value out of bounds.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( ( map_index >= 0 )
+		 && ( extent->logical_block_number == logical_block_number )
+		 && ( extent->range_flags == ( *extent_map )->range_flags[ map_index ] )
+		 && ( ( ( extent->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		  ||  ( extent->physical_block_number == ( ( *extent_map )->physical_block_numbers[ map_index ] + ( *extent_map )->numbers_of_blocks[ map_index ] ) ) ) )
+		{
+			( *extent_map )->numbers_of_blocks[ map_index ] += extent->number_of_blocks;
+		}
+		else
+		{
+			map_index++;
+
+			( *extent_map )->logical_block_numbers[ map_index ]  = extent->logical_block_number;
+			( *extent_map )->physical_block_numbers[ map_index ] = extent->physical_block_number;
+			( *extent_map )->numbers_of_blocks[ map_index ]      = extent->number_of_blocks;
+			( *extent_map )->range_flags[ map_index ]            = extent->range_flags;
+		}
+		logical_block_number = extent->logical_block_number + extent->number_of_blocks;
+	}
+	( *extent_map )->number_of_extents = map_index + 1;
+
+	return( 1 );
+
+on_error:
+	if( *extent_map != NULL )
+	{
+		libfsxfs_extent_map_free(
+		 extent_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an extent map
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_map_free(
+     libfsxfs_extent_map_t **extent_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_map_free";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_map != NULL )
+	{
+		if( ( *extent_map )->range_flags != NULL )
+		{
+			memory_free(
+			 ( *extent_map )->range_flags );
+		}
+		if( ( *extent_map )->numbers_of_blocks != NULL )
+		{
+			memory_free(
+			 ( *extent_map )->numbers_of_blocks );
+		}
+		if( ( *extent_map )->physical_block_numbers != NULL )
+		{
+			memory_free(
+			 ( *extent_map )->physical_block_numbers );
+		}
+		if( ( *extent_map )->logical_block_numbers != NULL )
+		{
+			memory_free(
+			 ( *extent_map )->logical_block_numbers );
+		}
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of extents
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_map_get_number_of_extents(
+     libfsxfs_extent_map_t *extent_map,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_map_get_number_of_extents";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_extents = extent_map->number_of_extents;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the extent that contains a specific logical block number
+ * If the logical block number is not contained by an extent, extent_index is set
+ * to the index of the first extent that follows the logical block number
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int libfsxfs_extent_map_get_extent_index_by_logical_block_number(
+     libfsxfs_extent_map_t *extent_map,
+     uint64_t logical_block_number,
+     int *extent_index,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfsxfs_extent_map_get_extent_index_by_logical_block_number";
+	int extent_index_lower = 0;
+	int extent_index_upper = 0;
+	int middle_index       = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the first extent that starts after the logical block number
+	 */
+	extent_index_upper = extent_map->number_of_extents;
+
+	while( extent_index_lower < extent_index_upper )
+	{
+		middle_index = extent_index_lower + ( ( extent_index_upper - extent_index_lower ) / 2 );
+
+		if( logical_block_number < extent_map->logical_block_numbers[ middle_index ] )
+		{
+			extent_index_upper = middle_index;
+		}
+		else
+		{
+			extent_index_lower = middle_index + 1;
+		}
+	}
+	if( extent_index_lower > 0 )
+	{
+		middle_index = extent_index_lower - 1;
+
+		if( ( logical_block_number - extent_map->logical_block_numbers[ middle_index ] ) < extent_map->numbers_of_blocks[ middle_index ] )
+		{
+			*extent_index = middle_index;
+
+			return( 1 );
+		}
+	}
+	*extent_index = extent_index_lower;
+
+	return( 0 );
+}
+
+/* Determines the file offset of a range of logical blocks that starts in a specific extent
+ * Returns 1 if successful, 0 if the range is not (contiguously) mapped by the extent or -1 on error
+ */
+int libfsxfs_extent_map_get_file_offset_by_extent_index(
+     libfsxfs_extent_map_t *extent_map,
+     libfsxfs_io_handle_t *io_handle,
+     int extent_index,
+     uint64_t logical_block_number,
+     uint64_t number_of_blocks,
+     off64_t *file_offset,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfsxfs_extent_map_get_file_offset_by_extent_index";
+	uint64_t allocation_group_index = 0;
+	uint64_t extent_block_offset    = 0;
+	uint64_t physical_block_number  = 0;
+	uint64_t relative_block_number  = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_index < 0 )
+	 || ( extent_index >= extent_map->number_of_extents ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( logical_block_number < extent_map->logical_block_numbers[ extent_index ] )
+	 || ( ( extent_map->range_flags[ extent_index ] & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 ) )
+	{
+		return( 0 );
+	}
+	extent_block_offset = logical_block_number - extent_map->logical_block_numbers[ extent_index ];
+
+	if( ( extent_block_offset >= extent_map->numbers_of_blocks[ extent_index ] )
+	 || ( number_of_blocks > ( extent_map->numbers_of_blocks[ extent_index ] - extent_block_offset ) ) )
+	{
+		return( 0 );
+	}
+	physical_block_number  = extent_map->physical_block_numbers[ extent_index ] + extent_block_offset;
+	allocation_group_index = physical_block_number >> io_handle->number_of_relative_block_number_bits;
+	relative_block_number  = physical_block_number & ( ( (uint64_t) 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
+
+	*file_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
+
+	return( 1 );
+}
+
+/* Reads data at a specific logical offset
+ * Data that is not covered by an extent or that is covered by a sparse extent is filled with 0-byte values
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_extent_map_read_buffer_at_offset(
+         libfsxfs_extent_map_t *extent_map,
+         libfsxfs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function           = "libfsxfs_extent_map_read_buffer_at_offset";
+	size64_t extent_data_offset     = 0;
+	size64_t extent_data_size       = 0;
+	size64_t sparse_data_size       = 0;
+	size_t buffer_offset            = 0;
+	size_t read_size                = 0;
+	ssize_t read_count              = 0;
+	off64_t physical_offset         = 0;
+	uint64_t allocation_group_index = 0;
+	uint64_t logical_block_number   = 0;
+	uint64_t physical_block_number  = 0;
+	uint64_t relative_block_number  = 0;
+	uint32_t block_offset           = 0;
+	int extent_index                = 0;
+	int result                      = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		logical_block_number = (uint64_t) offset / io_handle->block_size;
+		block_offset         = (uint32_t) ( (uint64_t) offset % io_handle->block_size );
+
+		result = libfsxfs_extent_map_get_extent_index_by_logical_block_number(
+		          extent_map,
+		          logical_block_number,
+		          &extent_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent of logical block: %" PRIu64 ".",
+			 function,
+			 logical_block_number );
+
+			return( -1 );
+		}
+		read_size = buffer_size - buffer_offset;
+
+		if( result == 0 )
+		{
+			/* Blocks that are not covered by an extent are sparse up to the next extent
+			 */
+			if( extent_index < extent_map->number_of_extents )
+			{
+				sparse_data_size = ( ( extent_map->logical_block_numbers[ extent_index ] - logical_block_number ) * io_handle->block_size ) - block_offset;
+
+				if( (size64_t) read_size > sparse_data_size )
+				{
+					read_size = (size_t) sparse_data_size;
+				}
+			}
+		}
+		else
+		{
+			extent_data_offset = ( ( logical_block_number - extent_map->logical_block_numbers[ extent_index ] ) * io_handle->block_size ) + block_offset;
+			extent_data_size   = extent_map->numbers_of_blocks[ extent_index ] * io_handle->block_size;
+
+			if( (size64_t) read_size > ( extent_data_size - extent_data_offset ) )
+			{
+				read_size = (size_t) ( extent_data_size - extent_data_offset );
+			}
+		}
+		if( ( result == 0 )
+		 || ( ( extent_map->range_flags[ extent_index ] & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 ) )
+		{
+			if( memory_set(
+			     &( buffer[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			physical_block_number  = extent_map->physical_block_numbers[ extent_index ];
+			allocation_group_index = physical_block_number >> io_handle->number_of_relative_block_number_bits;
+			relative_block_number  = physical_block_number & ( ( (uint64_t) 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
+
+			physical_offset = ( ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size ) + (off64_t) extent_data_offset;
+
+			if( io_handle->memory_mapped_file != NULL )
+			{
+				read_count = libfsxfs_memory_mapped_file_read_buffer_at_offset(
+				              io_handle->memory_mapped_file,
+				              &( buffer[ buffer_offset ] ),
+				              read_size,
+				              physical_offset,
+				              error );
+			}
+			else
+			{
+				read_count = libbfio_handle_read_buffer_at_offset(
+				              file_io_handle,
+				              &( buffer[ buffer_offset ] ),
+				              read_size,
+				              physical_offset,
+				              error );
+			}
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 physical_offset,
+				 physical_offset );
+
+				return( -1 );
+			}
+		}
+		buffer_offset += read_size;
+		offset        += (off64_t) read_size;
+
+		if( io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
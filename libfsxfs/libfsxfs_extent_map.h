@@ -0,0 +1,108 @@
+/*
+ * Extent map functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_EXTENT_MAP_H )
+#define _LIBFSXFS_EXTENT_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_extent_map libfsxfs_extent_map_t;
+
+/* The extent map stores the extents sorted by logical block number
+ * in separate arrays, so that a lookup only touches the logical block numbers
+ */
+struct libfsxfs_extent_map
+{
+	/* The logical block numbers
+	 */
+	uint64_t *logical_block_numbers;
+
+	/* The physical block numbers
+	 */
+	uint64_t *physical_block_numbers;
+
+	/* The numbers of blocks
+	 */
+	uint64_t *numbers_of_blocks;
+
+	/* The range flags
+	 */
+	uint32_t *range_flags;
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+};
+
+int libfsxfs_extent_map_initialize(
+     libfsxfs_extent_map_t **extent_map,
+     libcdata_array_t *extents_array,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_map_free(
+     libfsxfs_extent_map_t **extent_map,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_map_get_number_of_extents(
+     libfsxfs_extent_map_t *extent_map,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_map_get_extent_index_by_logical_block_number(
+     libfsxfs_extent_map_t *extent_map,
+     uint64_t logical_block_number,
+     int *extent_index,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_map_get_file_offset_by_extent_index(
+     libfsxfs_extent_map_t *extent_map,
+     libfsxfs_io_handle_t *io_handle,
+     int extent_index,
+     uint64_t logical_block_number,
+     uint64_t number_of_blocks,
+     off64_t *file_offset,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_extent_map_read_buffer_at_offset(
+         libfsxfs_extent_map_t *extent_map,
+         libfsxfs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_EXTENT_MAP_H ) */
+
@@ -28,8 +28,11 @@
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_directory.h"
 #include "libfsxfs_directory_entry.h"
+#include "libfsxfs_directory_iterator.h"
 #include "libfsxfs_extended_attribute.h"
+#include "libfsxfs_extent.h"
 #include "libfsxfs_file_entry.h"
+#include "libfsxfs_file_io_handle_pool.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
@@ -38,6 +41,7 @@
 #include "libfsxfs_libfdata.h"
 #include "libfsxfs_libfdatetime.h"
 #include "libfsxfs_libuna.h"
+#include "libfsxfs_read_queue.h"
 #include "libfsxfs_types.h"
 
 /* Creates a file entry
@@ -90,6 +94,27 @@ int libfsxfs_file_entry_initialize(
 
 		return( -1 );
 	}
+	if( ( io_handle != NULL )
+	 && ( io_handle->file_io_handle_pool != NULL ) )
+	{
+		/* Spread the file entries over the file IO handles of the pool
+		 * so that reads of different file entries do not contend for the same file IO handle
+		 */
+		if( libfsxfs_file_io_handle_pool_get_file_io_handle(
+		     io_handle->file_io_handle_pool,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle from pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	internal_file_entry = memory_allocate_structure(
 	                       libfsxfs_internal_file_entry_t );
 
@@ -2881,7 +2906,6 @@ int libfsxfs_file_entry_get_sub_file_entry_by_index(
      libcerror_error_t **error )
 {
 	libfsxfs_directory_entry_t *safe_directory_entry    = NULL;
-	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
 	libfsxfs_inode_t *inode                             = NULL;
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
 	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_by_index";
@@ -2956,11 +2980,24 @@ int libfsxfs_file_entry_get_sub_file_entry_by_index(
 	}
 	if( result != -1 )
 	{
-		if( libfsxfs_directory_get_entry_by_index(
-		     internal_file_entry->directory,
-		     sub_file_entry_index,
-		     &sub_directory_entry,
+		if( libfsxfs_directory_entry_initialize(
+		     &safe_directory_entry,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub directory entry.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfsxfs_directory_get_entry_by_index(
+		          internal_file_entry->directory,
+		          sub_file_entry_index,
+		          safe_directory_entry,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -2970,13 +3007,17 @@ int libfsxfs_file_entry_get_sub_file_entry_by_index(
 			 function,
 			 sub_file_entry_index );
 
+			libfsxfs_directory_entry_free(
+			 &safe_directory_entry,
+			 NULL );
+
 			result = -1;
 		}
 		else if( libfsxfs_file_system_get_inode_by_number(
 		          internal_file_entry->file_system,
 		          internal_file_entry->io_handle,
 		          internal_file_entry->file_io_handle,
-		          sub_directory_entry->inode_number,
+		          safe_directory_entry->inode_number,
 		          &inode,
 		          error ) != 1 )
 		{
@@ -2987,37 +3028,22 @@ int libfsxfs_file_entry_get_sub_file_entry_by_index(
 			 "%s: unable to retrieve sub directory entry: %d inode: %" PRIu64 "\n",
 			 function,
 			 sub_file_entry_index,
-			 sub_directory_entry->inode_number );
-
-			result = -1;
-		}
-		else if( libfsxfs_directory_entry_clone(
-		          &safe_directory_entry,
-		          sub_directory_entry,
-		          error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to clone sub directory entry: %d.",
-			 function,
-			 sub_file_entry_index );
+			 safe_directory_entry->inode_number );
 
-			libfsxfs_inode_free(
-			 &inode,
+			libfsxfs_directory_entry_free(
+			 &safe_directory_entry,
 			 NULL );
 
 			result = -1;
 		}
-		/* libfsxfs_file_entry_initialize takes over management of sub_directory_entry
+		/* libfsxfs_file_entry_initialize takes over management of safe_directory_entry
 		 */
 		else if( libfsxfs_file_entry_initialize(
 		          sub_file_entry,
 		          internal_file_entry->io_handle,
 		          internal_file_entry->file_io_handle,
 		          internal_file_entry->file_system,
-		          sub_directory_entry->inode_number,
+		          safe_directory_entry->inode_number,
 		          inode,
 		          safe_directory_entry,
 		          error ) != 1 )
@@ -3068,9 +3094,12 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
      libfsxfs_file_entry_t **sub_file_entry,
      libcerror_error_t **error )
 {
+	libfsxfs_directory_entry_t *safe_directory_entry    = NULL;
+	libfsxfs_inode_t *inode                             = NULL;
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
 	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_by_utf8_name";
-	int result                                          = 1;
+	int has_directory                                   = 0;
+	int result                                          = 0;
 
 	if( file_entry == NULL )
 	{
@@ -3122,9 +3151,37 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
 		return( -1 );
 	}
 #endif
-	/* TODO implement */
-	result = -1;
+	if( internal_file_entry->directory != NULL )
+	{
+		has_directory = 1;
+	}
+	else if( ( internal_file_entry->inode != NULL )
+	      && ( ( internal_file_entry->inode->file_mode & 0xf000 ) == LIBFSXFS_FILE_TYPE_DIRECTORY ) )
+	{
+		/* The directory has not been read, look up the name without reading
+		 * all the directory entries
+		 */
+		result = libfsxfs_file_system_get_directory_entry_by_utf8_name(
+		          internal_file_entry->file_system,
+		          internal_file_entry->io_handle,
+		          internal_file_entry->file_io_handle,
+		          internal_file_entry->inode_number,
+		          internal_file_entry->inode,
+		          utf8_string,
+		          utf8_string_length,
+		          &safe_directory_entry,
+		          error );
 
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub directory entry by UTF-8 name.",
+			 function );
+		}
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
@@ -3137,10 +3194,157 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
 		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #endif
-	return( result );
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( has_directory != 0 )
+	{
+		/* The directory is retained by the file entry, the lookup builds
+		 * its name hash index on first use and requires the write lock
+		 */
+		if( libfsxfs_directory_entry_initialize(
+		     &safe_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub directory entry.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_file_entry->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		result = libfsxfs_directory_get_entry_by_utf8_name(
+		          internal_file_entry->directory,
+		          utf8_string,
+		          utf8_string_length,
+		          safe_directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub directory entry by UTF-8 name.",
+			 function );
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_file_entry->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libfsxfs_directory_entry_free(
+			     &safe_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub directory entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsxfs_file_system_get_inode_by_number(
+	     internal_file_entry->file_system,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     safe_directory_entry->inode_number,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve sub directory entry inode: %" PRIu64 ".",
+		 function,
+		 safe_directory_entry->inode_number );
+
+		goto on_error;
+	}
+	/* libfsxfs_file_entry_initialize takes over management of inode and safe_directory_entry
+	 */
+	if( libfsxfs_file_entry_initialize(
+	     sub_file_entry,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     internal_file_entry->file_system,
+	     safe_directory_entry->inode_number,
+	     inode,
+	     safe_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( safe_directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the sub file entry for an UTF-16 encoded name
@@ -3153,9 +3357,12 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
      libfsxfs_file_entry_t **sub_file_entry,
      libcerror_error_t **error )
 {
+	libfsxfs_directory_entry_t *safe_directory_entry    = NULL;
+	libfsxfs_inode_t *inode                             = NULL;
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
 	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_by_utf16_name";
-	int result                                          = 1;
+	int has_directory                                   = 0;
+	int result                                          = 0;
 
 	if( file_entry == NULL )
 	{
@@ -3207,9 +3414,37 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
 		return( -1 );
 	}
 #endif
-	/* TODO implement */
-	result = -1;
+	if( internal_file_entry->directory != NULL )
+	{
+		has_directory = 1;
+	}
+	else if( ( internal_file_entry->inode != NULL )
+	      && ( ( internal_file_entry->inode->file_mode & 0xf000 ) == LIBFSXFS_FILE_TYPE_DIRECTORY ) )
+	{
+		/* The directory has not been read, look up the name without reading
+		 * all the directory entries
+		 */
+		result = libfsxfs_file_system_get_directory_entry_by_utf16_name(
+		          internal_file_entry->file_system,
+		          internal_file_entry->io_handle,
+		          internal_file_entry->file_io_handle,
+		          internal_file_entry->inode_number,
+		          internal_file_entry->inode,
+		          utf16_string,
+		          utf16_string_length,
+		          &safe_directory_entry,
+		          error );
 
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub directory entry by UTF-16 name.",
+			 function );
+		}
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
@@ -3222,53 +3457,1596 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
 		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #endif
-	return( result );
-}
-
-/* Reads data at the current offset
- * Returns the number of bytes read or -1 on error
- */
-ssize_t libfsxfs_file_entry_read_buffer(
-         libfsxfs_file_entry_t *file_entry,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
-{
-	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_read_buffer";
-	ssize_t read_count                                  = 0;
-
-	if( file_entry == NULL )
+	if( result == -1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
+		goto on_error;
 	}
-	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
-
-	if( internal_file_entry->inode == NULL )
+	if( has_directory != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file entry - missing inode.",
-		 function );
+		/* The directory is retained by the file entry, the lookup builds
+		 * its name hash index on first use and requires the write lock
+		 */
+		if( libfsxfs_directory_entry_initialize(
+		     &safe_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub directory entry.",
+			 function );
 
-		return( -1 );
-	}
-	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
-	{
-		libcerror_error_set(
-		 error,
+			goto on_error;
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_file_entry->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		result = libfsxfs_directory_get_entry_by_utf16_name(
+		          internal_file_entry->directory,
+		          utf16_string,
+		          utf16_string_length,
+		          safe_directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub directory entry by UTF-16 name.",
+			 function );
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_file_entry->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libfsxfs_directory_entry_free(
+			     &safe_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub directory entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsxfs_file_system_get_inode_by_number(
+	     internal_file_entry->file_system,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     safe_directory_entry->inode_number,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve sub directory entry inode: %" PRIu64 ".",
+		 function,
+		 safe_directory_entry->inode_number );
+
+		goto on_error;
+	}
+	/* libfsxfs_file_entry_initialize takes over management of inode and safe_directory_entry
+	 */
+	if( libfsxfs_file_entry_initialize(
+	     sub_file_entry,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     internal_file_entry->file_system,
+	     safe_directory_entry->inode_number,
+	     inode,
+	     safe_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( safe_directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the names, inode numbers and file types of multiple sub file entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_file_entry_get_directory_entries(
+     libfsxfs_internal_file_entry_t *internal_file_entry,
+     int first_entry_index,
+     uint8_t *utf8_names_buffer,
+     size_t utf8_names_buffer_size,
+     uint8_t **utf8_names,
+     size_t *utf8_name_sizes,
+     uint64_t *inode_numbers,
+     uint16_t *file_types,
+     int maximum_number_of_entries,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfsxfs_internal_file_entry_get_directory_entries";
+	size_t utf8_name_size                       = 0;
+	size_t utf8_names_buffer_offset             = 0;
+	int entry_index                             = 0;
+	int number_of_directory_entries             = 0;
+	int result                                  = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->directory == NULL )
+	{
+		if( libfsxfs_internal_file_entry_get_directory(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory for inode: %" PRIu32 ".",
+			 function,
+			 internal_file_entry->inode_number );
+
+			return( -1 );
+		}
+	}
+	if( internal_file_entry->directory != NULL )
+	{
+		if( libfsxfs_directory_get_number_of_entries(
+		     internal_file_entry->directory,
+		     &number_of_directory_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sub directory entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( first_entry_index < 0 )
+	 || ( first_entry_index > number_of_directory_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < maximum_number_of_entries;
+	     entry_index++ )
+	{
+		if( entry_index >= ( number_of_directory_entries - first_entry_index ) )
+		{
+			break;
+		}
+		if( libfsxfs_directory_get_entry_by_index(
+		     internal_file_entry->directory,
+		     first_entry_index + entry_index,
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub directory entry: %d.",
+			 function,
+			 first_entry_index + entry_index );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_entry_get_utf8_name_size(
+		     directory_entry,
+		     &utf8_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name size of sub directory entry: %d.",
+			 function,
+			 first_entry_index + entry_index );
+
+			goto on_error;
+		}
+		/* Stop when the name does not fit in the remainder of the names buffer
+		 */
+		if( utf8_name_size > ( utf8_names_buffer_size - utf8_names_buffer_offset ) )
+		{
+			if( entry_index == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid UTF-8 names buffer size value too small.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+		}
+		if( libfsxfs_directory_entry_get_utf8_name(
+		     directory_entry,
+		     &( utf8_names_buffer[ utf8_names_buffer_offset ] ),
+		     utf8_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name of sub directory entry: %d.",
+			 function,
+			 first_entry_index + entry_index );
+
+			goto on_error;
+		}
+		result = libfsxfs_directory_entry_get_file_type(
+		          directory_entry,
+		          &( file_types[ entry_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file type of sub directory entry: %d.",
+			 function,
+			 first_entry_index + entry_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			file_types[ entry_index ] = 0;
+		}
+		utf8_names[ entry_index ]      = &( utf8_names_buffer[ utf8_names_buffer_offset ] );
+		utf8_name_sizes[ entry_index ] = utf8_name_size;
+		inode_numbers[ entry_index ]   = directory_entry->inode_number;
+
+		utf8_names_buffer_offset += utf8_name_size;
+	}
+	if( libfsxfs_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_entries = entry_index;
+
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the names, inode numbers and file types of multiple sub file entries
+ * This function does not read the inodes of the sub file entries
+ * The names are stored with an end of string character in utf8_names_buffer,
+ * utf8_names is set to point to the name of each sub file entry in the buffer
+ * The file type is one of the LIBFSXFS_FILE_TYPE values and is read from the directory entry
+ * if the file system stores it, otherwise the file type is set to 0
+ * At most maximum_number_of_entries sub file entries are retrieved starting at first_entry_index,
+ * number_of_entries is set to the number of sub file entries retrieved, which is less
+ * if the end of the directory is reached or the names buffer is full
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_get_directory_entries(
+     libfsxfs_file_entry_t *file_entry,
+     int first_entry_index,
+     uint8_t *utf8_names_buffer,
+     size_t utf8_names_buffer_size,
+     uint8_t **utf8_names,
+     size_t *utf8_name_sizes,
+     uint64_t *inode_numbers,
+     uint16_t *file_types,
+     int maximum_number_of_entries,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_directory_entries";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( utf8_names_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 names buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_names_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 names buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 names.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file types.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_file_entry_get_directory_entries(
+	     internal_file_entry,
+	     first_entry_index,
+	     utf8_names_buffer,
+	     utf8_names_buffer_size,
+	     utf8_names,
+	     utf8_name_sizes,
+	     inode_numbers,
+	     file_types,
+	     maximum_number_of_entries,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the names, inode numbers and file types of multiple sub file entries starting at a cookie
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_file_entry_read_directory_entries(
+     libfsxfs_internal_file_entry_t *internal_file_entry,
+     uint64_t *cookie,
+     uint8_t *utf8_names_buffer,
+     size_t utf8_names_buffer_size,
+     uint8_t **utf8_names,
+     size_t *utf8_name_sizes,
+     uint64_t *inode_numbers,
+     uint16_t *file_types,
+     int maximum_number_of_entries,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *directory_entry       = NULL;
+	libfsxfs_directory_iterator_t *directory_iterator = NULL;
+	static char *function                             = "libfsxfs_internal_file_entry_read_directory_entries";
+	size_t utf8_name_size                             = 0;
+	size_t utf8_names_buffer_offset                   = 0;
+	int entry_index                                   = 0;
+	int result                                        = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( cookie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cookie.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_directory_iterator_initialize(
+	     &directory_iterator,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory iterator.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_directory_iterator_set_cookie(
+	     directory_iterator,
+	     *cookie,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set directory iterator cookie.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < maximum_number_of_entries;
+	     entry_index++ )
+	{
+		result = libfsxfs_directory_iterator_get_entry(
+		          directory_iterator,
+		          internal_file_entry->file_io_handle,
+		          &directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub directory entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsxfs_directory_entry_get_utf8_name_size(
+		     directory_entry,
+		     &utf8_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name size of sub directory entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		/* Stop when the name does not fit in the remainder of the names buffer,
+		 * the cookie then refers to this entry
+		 */
+		if( utf8_name_size > ( utf8_names_buffer_size - utf8_names_buffer_offset ) )
+		{
+			if( entry_index == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid UTF-8 names buffer size value too small.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+		}
+		if( libfsxfs_directory_entry_get_utf8_name(
+		     directory_entry,
+		     &( utf8_names_buffer[ utf8_names_buffer_offset ] ),
+		     utf8_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name of sub directory entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		result = libfsxfs_directory_entry_get_file_type(
+		          directory_entry,
+		          &( file_types[ entry_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file type of sub directory entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			file_types[ entry_index ] = 0;
+		}
+		utf8_names[ entry_index ]      = &( utf8_names_buffer[ utf8_names_buffer_offset ] );
+		utf8_name_sizes[ entry_index ] = utf8_name_size;
+		inode_numbers[ entry_index ]   = directory_entry->inode_number;
+
+		utf8_names_buffer_offset += utf8_name_size;
+
+		if( libfsxfs_directory_iterator_next_entry(
+		     directory_iterator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to move directory iterator to next entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsxfs_directory_iterator_get_cookie(
+	     directory_iterator,
+	     cookie,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory iterator cookie.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_directory_iterator_free(
+	     &directory_iterator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory iterator.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_entries = entry_index;
+
+	return( 1 );
+
+on_error:
+	if( directory_iterator != NULL )
+	{
+		libfsxfs_directory_iterator_free(
+		 &directory_iterator,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the names, inode numbers and file types of multiple sub file entries starting at a cookie
+ * Unlike libfsxfs_file_entry_get_directory_entries this function does not read all the entries
+ * of the directory into memory, only the entries of a single directory data block are read at a time
+ * A cookie of 0 refers to the first sub file entry, on return cookie is set to the position
+ * of the next sub file entry, which can be passed to a subsequent call to resume reading
+ * The names are stored with an end of string character in utf8_names_buffer,
+ * utf8_names is set to point to the name of each sub file entry in the buffer
+ * The file type is one of the LIBFSXFS_FILE_TYPE values and is read from the directory entry
+ * if the file system stores it, otherwise the file type is set to 0
+ * number_of_entries is set to the number of sub file entries read, which is 0 at the end of the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_read_directory_entries(
+     libfsxfs_file_entry_t *file_entry,
+     uint64_t *cookie,
+     uint8_t *utf8_names_buffer,
+     size_t utf8_names_buffer_size,
+     uint8_t **utf8_names,
+     size_t *utf8_name_sizes,
+     uint64_t *inode_numbers,
+     uint16_t *file_types,
+     int maximum_number_of_entries,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_directory_entries";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( cookie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cookie.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_names_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 names buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_names_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 names buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 names.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file types.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_file_entry_read_directory_entries(
+	     internal_file_entry,
+	     cookie,
+	     utf8_names_buffer,
+	     utf8_names_buffer_size,
+	     utf8_names,
+	     utf8_name_sizes,
+	     inode_numbers,
+	     file_types,
+	     maximum_number_of_entries,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data at the current offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_file_entry_read_buffer(
+         libfsxfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_buffer";
+	ssize_t read_count                                  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libfdata_stream_read_buffer(
+	              internal_file_entry->data_stream,
+	              (intptr_t *) internal_file_entry->file_io_handle,
+	              buffer,
+	              buffer_size,
+	              0,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from data stream.",
+		 function );
+
+		read_count = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_file_entry_read_buffer_at_offset(
+         libfsxfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_buffer_at_offset";
+	ssize_t read_count                                  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libfdata_stream_read_buffer_at_offset(
+	              internal_file_entry->data_stream,
+	              (intptr_t *) internal_file_entry->file_io_handle,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              0,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from data stream.",
+		 function );
+
+		read_count = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at a specific offset without using the data stream
+ * The offset is mapped onto the data extent map of the inode, hence no read state is maintained
+ * The data is read using file_io_handle, which does not need to be the file IO handle of the file entry
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_internal_file_entry_read_buffer_at_offset(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_file_entry_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file entry - invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= internal_file_entry->data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( internal_file_entry->data_size - (size64_t) offset ) )
+	{
+		buffer_size = (size_t) ( internal_file_entry->data_size - (size64_t) offset );
+	}
+	if( internal_file_entry->inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA )
+	{
+		if( internal_file_entry->inode->inline_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid file entry - invalid inode - missing inline data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     buffer,
+		     &( ( internal_file_entry->inode->inline_data )[ offset ] ),
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy inline data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) buffer_size );
+	}
+	read_count = libfsxfs_inode_read_data_buffer_at_offset(
+	              internal_file_entry->inode,
+	              internal_file_entry->io_handle,
+	              file_io_handle,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data from inode at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads data at a specific offset without changing the current offset
+ * The data is read using file_io_handle while holding the read/write lock of the file entry for reading
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_internal_file_entry_pread_buffer(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_file_entry_pread_buffer";
+	ssize_t read_count    = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libfsxfs_internal_file_entry_read_buffer_at_offset(
+	              internal_file_entry,
+	              file_io_handle,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		read_count = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at a specific offset without changing the current offset
+ * Unlike libfsxfs_file_entry_read_buffer_at_offset this function maintains no read state,
+ * hence multiple threads can read from the same file entry concurrently
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_file_entry_pread_buffer(
+         libfsxfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_pread_buffer";
+	ssize_t read_count                                  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libfsxfs_internal_file_entry_pread_buffer(
+	              internal_file_entry,
+	              internal_file_entry->file_io_handle,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads data of multiple ranges without changing the current offset
+ * The ranges are read in order of their offset and ranges that are near each other
+ * are read as a single range, after which the data is copied into the range buffers
+ * The number of bytes read of each range is stored in read_counts
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_read_ranges(
+     libfsxfs_file_entry_t *file_entry,
+     void **buffers,
+     size_t *buffer_sizes,
+     off64_t *offsets,
+     ssize_t *read_counts,
+     int number_of_ranges,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	uint8_t *merged_data                                = NULL;
+	uint8_t *reallocation                               = NULL;
+	int *range_indexes                                  = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_ranges";
+	size_t merged_data_size                             = 0;
+	size_t range_data_offset                            = 0;
+	size_t read_size                                    = 0;
+	ssize_t read_count                                  = 0;
+	off64_t merged_range_end_offset                     = 0;
+	off64_t range_end_offset                            = 0;
+	int first_sorted_index                              = 0;
+	int last_sorted_index                               = 0;
+	int range_index                                     = 0;
+	int result                                          = 1;
+	int sorted_index                                    = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
 		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
@@ -3276,8 +5054,142 @@ ssize_t libfsxfs_file_entry_read_buffer(
 
 		return( -1 );
 	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_ranges < 0 )
+	 || ( (size_t) number_of_ranges > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of ranges value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( buffers[ range_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( buffer_sizes[ range_index ] > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer size: %d value exceeds maximum.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( ( offsets[ range_index ] < 0 )
+		 || ( offsets[ range_index ] > ( (off64_t) INT64_MAX - (off64_t) buffer_sizes[ range_index ] ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset: %d value out of bounds.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		read_counts[ range_index ] = 0;
+	}
+	if( number_of_ranges == 0 )
+	{
+		return( 1 );
+	}
+	range_indexes = (int *) memory_allocate(
+	                         sizeof( int ) * number_of_ranges );
+
+	if( range_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range indexes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Sort the ranges by offset, the number of ranges is expected to be small
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		sorted_index = range_index;
+
+		while( ( sorted_index > 0 )
+		    && ( offsets[ range_indexes[ sorted_index - 1 ] ] > offsets[ range_index ] ) )
+		{
+			range_indexes[ sorted_index ] = range_indexes[ sorted_index - 1 ];
+
+			sorted_index--;
+		}
+		range_indexes[ sorted_index ] = range_index;
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3285,33 +5197,169 @@ ssize_t libfsxfs_file_entry_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
+		memory_free(
+		 range_indexes );
+
 		return( -1 );
 	}
 #endif
-	read_count = libfdata_stream_read_buffer(
-	              internal_file_entry->data_stream,
-	              (intptr_t *) internal_file_entry->file_io_handle,
-	              buffer,
-	              buffer_size,
-	              0,
-	              error );
+	first_sorted_index = 0;
 
-	if( read_count < 0 )
+	while( first_sorted_index < number_of_ranges )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from data stream.",
-		 function );
+		range_index             = range_indexes[ first_sorted_index ];
+		merged_range_end_offset = offsets[ range_index ] + (off64_t) buffer_sizes[ range_index ];
+		last_sorted_index       = first_sorted_index;
 
-		read_count = -1;
+		/* Merge the ranges that overlap or are separated by less than a block
+		 */
+		while( ( last_sorted_index + 1 ) < number_of_ranges )
+		{
+			sorted_index = range_indexes[ last_sorted_index + 1 ];
+
+			if( offsets[ sorted_index ] > ( merged_range_end_offset + (off64_t) internal_file_entry->io_handle->block_size ) )
+			{
+				break;
+			}
+			range_end_offset = offsets[ sorted_index ] + (off64_t) buffer_sizes[ sorted_index ];
+
+			if( range_end_offset < merged_range_end_offset )
+			{
+				range_end_offset = merged_range_end_offset;
+			}
+			if( (size64_t) ( range_end_offset - offsets[ range_index ] ) > (size64_t) LIBFSXFS_MAXIMUM_MERGED_READ_RANGE_SIZE )
+			{
+				break;
+			}
+			merged_range_end_offset = range_end_offset;
+
+			last_sorted_index++;
+		}
+		if( last_sorted_index == first_sorted_index )
+		{
+			read_count = libfsxfs_internal_file_entry_read_buffer_at_offset(
+			              internal_file_entry,
+			              internal_file_entry->file_io_handle,
+			              (uint8_t *) buffers[ range_index ],
+			              buffer_sizes[ range_index ],
+			              offsets[ range_index ],
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read range: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 range_index,
+				 offsets[ range_index ],
+				 offsets[ range_index ] );
+
+				result = -1;
+
+				break;
+			}
+			read_counts[ range_index ] = read_count;
+		}
+		else
+		{
+			read_size = (size_t) ( merged_range_end_offset - offsets[ range_index ] );
+
+			if( read_size > merged_data_size )
+			{
+				reallocation = (uint8_t *) memory_reallocate(
+				                            merged_data,
+				                            sizeof( uint8_t ) * read_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize merged range data.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+				merged_data      = reallocation;
+				merged_data_size = read_size;
+			}
+			read_count = libfsxfs_internal_file_entry_read_buffer_at_offset(
+			              internal_file_entry,
+			              internal_file_entry->file_io_handle,
+			              merged_data,
+			              read_size,
+			              offsets[ range_index ],
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read merged range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offsets[ range_index ],
+				 offsets[ range_index ] );
+
+				result = -1;
+
+				break;
+			}
+			for( sorted_index = first_sorted_index;
+			     sorted_index <= last_sorted_index;
+			     sorted_index++ )
+			{
+				range_index       = range_indexes[ sorted_index ];
+				range_data_offset = (size_t) ( offsets[ range_index ] - offsets[ range_indexes[ first_sorted_index ] ] );
+
+				if( range_data_offset >= (size_t) read_count )
+				{
+					continue;
+				}
+				read_size = buffer_sizes[ range_index ];
+
+				if( read_size > ( (size_t) read_count - range_data_offset ) )
+				{
+					read_size = (size_t) read_count - range_data_offset;
+				}
+				if( memory_copy(
+				     buffers[ range_index ],
+				     &( merged_data[ range_data_offset ] ),
+				     read_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy range: %d data.",
+					 function,
+					 range_index );
+
+					result = -1;
+
+					break;
+				}
+				read_counts[ range_index ] = (ssize_t) read_size;
+			}
+			if( result != 1 )
+			{
+				break;
+			}
+		}
+		first_sorted_index = last_sorted_index + 1;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3319,28 +5367,40 @@ ssize_t libfsxfs_file_entry_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
 #endif
-	return( read_count );
+	if( merged_data != NULL )
+	{
+		memory_free(
+		 merged_data );
+	}
+	memory_free(
+	 range_indexes );
+
+	return( result );
 }
 
-/* Reads data at a specific offset
- * Returns the number of bytes read or -1 on error
+/* Submits an asynchronous read of data at a specific offset
+ * The read is processed by the read queue of the volume and does not change the current offset
+ * The completion is retrieved using libfsxfs_volume_poll_read or libfsxfs_volume_wait_for_read
+ * The file entry and buffer must remain valid until the completion has been retrieved
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libfsxfs_file_entry_read_buffer_at_offset(
-         libfsxfs_file_entry_t *file_entry,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libfsxfs_file_entry_read_async(
+     libfsxfs_file_entry_t *file_entry,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     intptr_t *user_value,
+     libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle                    = NULL;
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_read_buffer_at_offset";
-	ssize_t read_count                                  = 0;
+	static char *function                               = "libfsxfs_file_entry_read_async";
 
 	if( file_entry == NULL )
 	{
@@ -3355,79 +5415,92 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
 	}
 	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
 
-	if( internal_file_entry->inode == NULL )
+	if( internal_file_entry->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file entry - missing inode.",
+		 "%s: invalid file entry - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	if( internal_file_entry->io_handle->read_queue == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - invalid IO handle - missing read queue.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( internal_file_entry->inode == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	read_count = libfdata_stream_read_buffer_at_offset(
-	              internal_file_entry->data_stream,
-	              (intptr_t *) internal_file_entry->file_io_handle,
-	              buffer,
-	              buffer_size,
-	              offset,
-	              0,
-	              error );
-
-	if( read_count < 0 )
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from data stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
 		 function );
 
-		read_count = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file_entry->read_write_lock,
+	file_io_handle = internal_file_entry->file_io_handle;
+
+	if( internal_file_entry->io_handle->file_io_handle_pool != NULL )
+	{
+		/* Spread the requests over the file IO handles of the pool
+		 * so that requests of the same file entry can be read concurrently
+		 */
+		if( libfsxfs_file_io_handle_pool_get_file_io_handle(
+		     internal_file_entry->io_handle->file_io_handle_pool,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle from pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfsxfs_read_queue_push_request(
+	     internal_file_entry->io_handle->read_queue,
+	     file_entry,
+	     file_io_handle,
+	     (uint8_t *) buffer,
+	     buffer_size,
+	     offset,
+	     user_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push read request onto read queue.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( read_count );
+	return( 1 );
 }
 
 /* Seeks a certain offset in the data
@@ -3731,10 +5804,25 @@ int libfsxfs_file_entry_get_number_of_extents(
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_inode_get_number_of_data_extents(
+	if( libfsxfs_inode_read_data_extents(
 	     internal_file_entry->inode,
-	     number_of_extents,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents of inode.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsxfs_inode_get_number_of_data_extents(
+	          internal_file_entry->inode,
+	          number_of_extents,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -3807,11 +5895,26 @@ int libfsxfs_file_entry_get_extent_by_index(
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_inode_get_data_extent_by_index(
+	if( libfsxfs_inode_read_data_extents(
 	     internal_file_entry->inode,
-	     extent_index,
-	     &extent,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents of inode.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsxfs_inode_get_data_extent_by_index(
+	          internal_file_entry->inode,
+	          extent_index,
+	          &extent,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
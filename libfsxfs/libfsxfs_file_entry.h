@@ -333,6 +333,60 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
      libfsxfs_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+int libfsxfs_internal_file_entry_get_directory_entries(
+     libfsxfs_internal_file_entry_t *internal_file_entry,
+     int first_entry_index,
+     uint8_t *utf8_names_buffer,
+     size_t utf8_names_buffer_size,
+     uint8_t **utf8_names,
+     size_t *utf8_name_sizes,
+     uint64_t *inode_numbers,
+     uint16_t *file_types,
+     int maximum_number_of_entries,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_directory_entries(
+     libfsxfs_file_entry_t *file_entry,
+     int first_entry_index,
+     uint8_t *utf8_names_buffer,
+     size_t utf8_names_buffer_size,
+     uint8_t **utf8_names,
+     size_t *utf8_name_sizes,
+     uint64_t *inode_numbers,
+     uint16_t *file_types,
+     int maximum_number_of_entries,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_file_entry_read_directory_entries(
+     libfsxfs_internal_file_entry_t *internal_file_entry,
+     uint64_t *cookie,
+     uint8_t *utf8_names_buffer,
+     size_t utf8_names_buffer_size,
+     uint8_t **utf8_names,
+     size_t *utf8_name_sizes,
+     uint64_t *inode_numbers,
+     uint16_t *file_types,
+     int maximum_number_of_entries,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_read_directory_entries(
+     libfsxfs_file_entry_t *file_entry,
+     uint64_t *cookie,
+     uint8_t *utf8_names_buffer,
+     size_t utf8_names_buffer_size,
+     uint8_t **utf8_names,
+     size_t *utf8_name_sizes,
+     uint64_t *inode_numbers,
+     uint16_t *file_types,
+     int maximum_number_of_entries,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 ssize_t libfsxfs_file_entry_read_buffer(
          libfsxfs_file_entry_t *file_entry,
@@ -348,6 +402,49 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+ssize_t libfsxfs_internal_file_entry_read_buffer_at_offset(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libfsxfs_internal_file_entry_pread_buffer(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+ssize_t libfsxfs_file_entry_pread_buffer(
+         libfsxfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_read_ranges(
+     libfsxfs_file_entry_t *file_entry,
+     void **buffers,
+     size_t *buffer_sizes,
+     off64_t *offsets,
+     ssize_t *read_counts,
+     int number_of_ranges,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_read_async(
+     libfsxfs_file_entry_t *file_entry,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     intptr_t *user_value,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 off64_t libfsxfs_file_entry_seek_offset(
          libfsxfs_file_entry_t *file_entry,
@@ -0,0 +1,364 @@
+/*
+ * File IO handle pool functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_file_io_handle_pool.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+/* Creates a file IO handle pool
+ * The pool contains the file IO handle and number_of_file_io_handles - 1 clones of it
+ * Make sure the value file_io_handle_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_io_handle_pool_initialize(
+     libfsxfs_file_io_handle_pool_t **file_io_handle_pool,
+     libbfio_handle_t *file_io_handle,
+     int number_of_file_io_handles,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsxfs_file_io_handle_pool_initialize";
+	int file_io_handle_index = 0;
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_file_io_handles <= 0 )
+	 || ( (size_t) number_of_file_io_handles > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libbfio_handle_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of file IO handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*file_io_handle_pool = memory_allocate_structure(
+	                        libfsxfs_file_io_handle_pool_t );
+
+	if( *file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handle pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_io_handle_pool,
+	     0,
+	     sizeof( libfsxfs_file_io_handle_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handle pool.",
+		 function );
+
+		memory_free(
+		 *file_io_handle_pool );
+
+		*file_io_handle_pool = NULL;
+
+		return( -1 );
+	}
+	( *file_io_handle_pool )->file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                                                   sizeof( libbfio_handle_t * ) * number_of_file_io_handles );
+
+	if( ( *file_io_handle_pool )->file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *file_io_handle_pool )->file_io_handles,
+	     0,
+	     sizeof( libbfio_handle_t * ) * number_of_file_io_handles ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_io_handle_pool )->file_io_handles[ 0 ] = file_io_handle;
+
+	for( file_io_handle_index = 1;
+	     file_io_handle_index < number_of_file_io_handles;
+	     file_io_handle_index++ )
+	{
+		if( libbfio_handle_clone(
+		     &( ( *file_io_handle_pool )->file_io_handles[ file_io_handle_index ] ),
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone file IO handle: %d.",
+			 function,
+			 file_io_handle_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *file_io_handle_pool )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *file_io_handle_pool )->number_of_file_io_handles = number_of_file_io_handles;
+
+	return( 1 );
+
+on_error:
+	if( *file_io_handle_pool != NULL )
+	{
+		if( ( *file_io_handle_pool )->file_io_handles != NULL )
+		{
+			for( file_io_handle_index = 1;
+			     file_io_handle_index < number_of_file_io_handles;
+			     file_io_handle_index++ )
+			{
+				if( ( *file_io_handle_pool )->file_io_handles[ file_io_handle_index ] != NULL )
+				{
+					libbfio_handle_free(
+					 &( ( *file_io_handle_pool )->file_io_handles[ file_io_handle_index ] ),
+					 NULL );
+				}
+			}
+			memory_free(
+			 ( *file_io_handle_pool )->file_io_handles );
+		}
+		memory_free(
+		 *file_io_handle_pool );
+
+		*file_io_handle_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a file IO handle pool
+ * The cloned file IO handles are closed and freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_io_handle_pool_free(
+     libfsxfs_file_io_handle_pool_t **file_io_handle_pool,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsxfs_file_io_handle_pool_free";
+	int file_io_handle_index = 0;
+	int result               = 1;
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle_pool != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *file_io_handle_pool )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The first file IO handle is not managed by the pool
+		 */
+		for( file_io_handle_index = 1;
+		     file_io_handle_index < ( *file_io_handle_pool )->number_of_file_io_handles;
+		     file_io_handle_index++ )
+		{
+			if( libbfio_handle_free(
+			     &( ( *file_io_handle_pool )->file_io_handles[ file_io_handle_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle: %d.",
+				 function,
+				 file_io_handle_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *file_io_handle_pool )->file_io_handles );
+
+		memory_free(
+		 *file_io_handle_pool );
+
+		*file_io_handle_pool = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a file IO handle from the pool
+ * The file IO handles are handed out round-robin, the pool retains ownership
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_io_handle_pool_get_file_io_handle(
+     libfsxfs_file_io_handle_pool_t *file_io_handle_pool,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_io_handle_pool_get_file_io_handle";
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_io_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*file_io_handle = file_io_handle_pool->file_io_handles[ file_io_handle_pool->next_file_io_handle_index ];
+
+	file_io_handle_pool->next_file_io_handle_index += 1;
+
+	if( file_io_handle_pool->next_file_io_handle_index >= file_io_handle_pool->number_of_file_io_handles )
+	{
+		file_io_handle_pool->next_file_io_handle_index = 0;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_io_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
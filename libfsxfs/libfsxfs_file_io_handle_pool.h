@@ -0,0 +1,80 @@
+/*
+ * File IO handle pool functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_FILE_IO_HANDLE_POOL_H )
+#define _LIBFSXFS_FILE_IO_HANDLE_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_file_io_handle_pool libfsxfs_file_io_handle_pool_t;
+
+struct libfsxfs_file_io_handle_pool
+{
+	/* The file IO handles
+	 * The first file IO handle is not managed by the pool
+	 */
+	libbfio_handle_t **file_io_handles;
+
+	/* The number of file IO handles
+	 */
+	int number_of_file_io_handles;
+
+	/* The index of the next file IO handle to hand out
+	 */
+	int next_file_io_handle_index;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsxfs_file_io_handle_pool_initialize(
+     libfsxfs_file_io_handle_pool_t **file_io_handle_pool,
+     libbfio_handle_t *file_io_handle,
+     int number_of_file_io_handles,
+     libcerror_error_t **error );
+
+int libfsxfs_file_io_handle_pool_free(
+     libfsxfs_file_io_handle_pool_t **file_io_handle_pool,
+     libcerror_error_t **error );
+
+int libfsxfs_file_io_handle_pool_get_file_io_handle(
+     libfsxfs_file_io_handle_pool_t *file_io_handle_pool,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_FILE_IO_HANDLE_POOL_H ) */
+
@@ -23,26 +23,51 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_directory.h"
 #include "libfsxfs_directory_entry.h"
+#include "libfsxfs_directory_entry_cache.h"
 #include "libfsxfs_file_system.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_inode_btree.h"
+#include "libfsxfs_inode_chunk_index.h"
 #include "libfsxfs_inode_information.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 #include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfcache.h"
 #include "libfsxfs_libuna.h"
+#include "libfsxfs_memory_mapped_file.h"
+
+typedef struct libfsxfs_file_system_sorted_inode libfsxfs_file_system_sorted_inode_t;
+
+struct libfsxfs_file_system_sorted_inode
+{
+	/* The file offset of the inode
+	 */
+	off64_t file_offset;
+
+	/* The index of the inode in the inode numbers
+	 */
+	int inode_index;
+};
 
 /* Creates a file system
  * Make sure the value file_system is referencing, is set to NULL
+ * A maximum number of cached inodes of 0 disables the inode cache
+ * A maximum number of cached directory entries of 0 disables the directory entry cache
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_file_system_initialize(
      libfsxfs_file_system_t **file_system,
      uint64_t root_directory_inode_number,
+     int maximum_number_of_cached_inodes,
+     int maximum_number_of_cached_directory_entries,
      libcerror_error_t **error )
 {
 	static char *function = "libfsxfs_file_system_initialize";
@@ -69,6 +94,28 @@ int libfsxfs_file_system_initialize(
 
 		return( -1 );
 	}
+	if( maximum_number_of_cached_inodes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of cached inodes value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_cached_directory_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of cached directory entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
 	*file_system = memory_allocate_structure(
 	                libfsxfs_file_system_t );
 
@@ -115,6 +162,40 @@ int libfsxfs_file_system_initialize(
 
 		goto on_error;
 	}
+	if( maximum_number_of_cached_inodes > 0 )
+	{
+		if( libfcache_cache_initialize(
+		     &( ( *file_system )->inode_cache ),
+		     maximum_number_of_cached_inodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( maximum_number_of_cached_directory_entries > 0 )
+	{
+		if( libfsxfs_directory_entry_cache_initialize(
+		     &( ( *file_system )->directory_entry_cache ),
+		     maximum_number_of_cached_directory_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entry cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
 	     &( ( *file_system )->read_write_lock ),
@@ -137,6 +218,18 @@ int libfsxfs_file_system_initialize(
 on_error:
 	if( *file_system != NULL )
 	{
+		if( ( *file_system )->directory_entry_cache != NULL )
+		{
+			libfsxfs_directory_entry_cache_free(
+			 &( ( *file_system )->directory_entry_cache ),
+			 NULL );
+		}
+		if( ( *file_system )->inode_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *file_system )->inode_cache ),
+			 NULL );
+		}
 		if( ( *file_system )->inode_btree != NULL )
 		{
 			libfsxfs_inode_btree_free(
@@ -189,6 +282,35 @@ int libfsxfs_file_system_free(
 			result = -1;
 		}
 #endif
+		if( libfsxfs_directory_entry_cache_free(
+		     &( ( *file_system )->directory_entry_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *file_system )->inode_cache != NULL )
+		{
+			if( libfcache_cache_free(
+			     &( ( *file_system )->inode_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free inode cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libfsxfs_inode_btree_free(
 		     &( ( *file_system )->inode_btree ),
 		     error ) != 1 )
@@ -233,42 +355,1815 @@ int libfsxfs_file_system_read_inode_information(
 
 		return( -1 );
 	}
-	if( libfsxfs_inode_btree_read_inode_information(
-	     file_system->inode_btree,
-	     io_handle,
-	     file_io_handle,
-	     file_offset,
-	     error ) != 1 )
+	if( libfsxfs_inode_btree_read_inode_information(
+	     file_system->inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode information at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( 1 );
+	}
+	return( 1 );
+}
+
+/* Reads the inode information of all allocation groups
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_read_all_inode_information(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_system_read_all_inode_information";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_btree_read_all_inode_information(
+	     file_system->inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     number_of_allocation_groups,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode information of all allocation groups.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the number of allocation groups
+ * The inode information of the allocation groups is read on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_set_number_of_allocation_groups(
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_system_set_number_of_allocation_groups";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_btree_set_number_of_allocation_groups(
+	     file_system->inode_btree,
+	     number_of_allocation_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of allocation groups in inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific inode from the inode cache
+ * The caller receives a reference to the cached inode that must be released with libfsxfs_inode_free
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int libfsxfs_file_system_get_cached_inode_by_number(
+     libfsxfs_file_system_t *file_system,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsxfs_inode_t *cached_inode       = NULL;
+	static char *function                = "libfsxfs_file_system_get_cached_inode_by_number";
+	int result                           = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->inode_cache == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfcache_cache_get_value_by_identifier(
+	          file_system->inode_cache,
+	          0,
+	          (off64_t) inode_number,
+	          0,
+	          &cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from cache.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfcache_cache_value_get_value(
+		     cache_value,
+		     (intptr_t **) &cached_inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode from cache value.",
+			 function );
+
+			goto on_error;
+		}
+		if( cached_inode == NULL )
+		{
+			result = 0;
+		}
+		else if( libfsxfs_inode_add_reference(
+		          cached_inode,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to cached inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( result != 0 )
+		{
+			libfsxfs_inode_free(
+			 &cached_inode,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	if( result != 0 )
+	{
+		*inode = cached_inode;
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 file_system->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Stores an inode in the inode cache
+ * The inode cache holds its own reference to the inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_set_cached_inode_by_number(
+     libfsxfs_file_system_t *file_system,
+     uint64_t inode_number,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *cached_inode = NULL;
+	static char *function          = "libfsxfs_file_system_set_cached_inode_by_number";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->inode_cache == NULL )
+	{
+		return( 1 );
+	}
+	if( libfsxfs_inode_add_reference(
+	     inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		return( -1 );
+	}
+	cached_inode = inode;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libfcache_cache_set_value_by_identifier(
+	     file_system->inode_cache,
+	     0,
+	     (off64_t) inode_number,
+	     0,
+	     (intptr_t *) cached_inode,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set inode: %" PRIu64 " in cache.",
+		 function,
+		 inode_number );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_write(
+		 file_system->read_write_lock,
+		 NULL );
+#endif
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	libfsxfs_inode_free(
+	 &cached_inode,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves a specific inode
+ * Inodes are shared with the inode cache and must not be modified by the caller
+ * The caller receives a reference that must be released with libfsxfs_inode_free
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfsxfs_file_system_get_inode_by_number(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *safe_inode = NULL;
+	static char *function        = "libfsxfs_file_system_get_inode_by_number";
+	off64_t file_offset          = 0;
+	int result                   = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->inode_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - inode size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode_number == 0 )
+	 || ( inode_number > (uint64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_file_system_get_cached_inode_by_number(
+	          file_system,
+	          inode_number,
+	          &safe_inode,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		*inode = safe_inode;
+
+		return( 1 );
+	}
+	result = libfsxfs_inode_btree_get_inode_by_number(
+	          file_system->inode_btree,
+	          io_handle,
+	          file_io_handle,
+	          inode_number,
+	          &file_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 "\n",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsxfs_inode_initialize(
+		     &safe_inode,
+		     io_handle->inode_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 inode_number,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		if( libfsxfs_inode_read_file_io_handle(
+		     safe_inode,
+		     io_handle,
+		     file_io_handle,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 inode_number,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( libfsxfs_file_system_set_cached_inode_by_number(
+		     file_system,
+		     inode_number,
+		     safe_inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to cache inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		*inode = safe_inode;
+	}
+	return( result );
+
+on_error:
+	if( safe_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares two sorted inodes by their file offset
+ * Returns -1 if the first is less than, 0 if equal to or 1 if greater than the second
+ */
+static int libfsxfs_file_system_compare_sorted_inodes(
+            const void *first_sorted_inode,
+            const void *second_sorted_inode )
+{
+	const libfsxfs_file_system_sorted_inode_t *first_inode  = (const libfsxfs_file_system_sorted_inode_t *) first_sorted_inode;
+	const libfsxfs_file_system_sorted_inode_t *second_inode = (const libfsxfs_file_system_sorted_inode_t *) second_sorted_inode;
+
+	if( first_inode->file_offset < second_inode->file_offset )
+	{
+		return( -1 );
+	}
+	else if( first_inode->file_offset > second_inode->file_offset )
+	{
+		return( 1 );
+	}
+	/* The inode index keeps the order of inodes at the same file offset stable
+	 */
+	if( first_inode->inode_index < second_inode->inode_index )
+	{
+		return( -1 );
+	}
+	else if( first_inode->inode_index > second_inode->inode_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves multiple inodes by number
+ * The inode numbers are resolved to file offsets first and the inodes are read
+ * in order of their file offset, where inodes in the same inode cluster are read
+ * from the inode cluster cache, or if there is no inode cluster cache, inodes that
+ * are near each other are read with a single read of at most
+ * LIBFSXFS_MAXIMUM_INODE_CLUSTER_READ_SIZE bytes
+ * The inodes are set to NULL for inode numbers that are not allocated
+ * The caller receives a reference to each inode that must be released with libfsxfs_inode_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_get_inodes_by_numbers(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint64_t *inode_numbers,
+     int number_of_inodes,
+     libfsxfs_inode_t **inodes,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_system_sorted_inode_t *sorted_inodes = NULL;
+	libfsxfs_inode_t *safe_inode                       = NULL;
+	const uint8_t *cluster_data                        = NULL;
+	uint8_t *cluster_buffer                            = NULL;
+	static char *function                              = "libfsxfs_file_system_get_inodes_by_numbers";
+	size_t cluster_data_size                           = 0;
+	ssize_t read_count                                 = 0;
+	off64_t cluster_offset                             = 0;
+	int first_sorted_index                             = 0;
+	int inode_index                                    = 0;
+	int last_sorted_index                              = 0;
+	int number_of_sorted_inodes                        = 0;
+	int result                                         = 0;
+	int sorted_index                                   = 0;
+	int use_inode_cluster_cache                        = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->inode_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - inode size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_inodes < 0 )
+	 || ( (size_t) number_of_inodes > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_file_system_sorted_inode_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of inodes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inodes.",
+		 function );
+
+		return( -1 );
+	}
+	for( inode_index = 0;
+	     inode_index < number_of_inodes;
+	     inode_index++ )
+	{
+		if( ( inode_numbers[ inode_index ] == 0 )
+		 || ( inode_numbers[ inode_index ] > (uint64_t) UINT32_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid inode number: %d value out of bounds.",
+			 function,
+			 inode_index );
+
+			return( -1 );
+		}
+		inodes[ inode_index ] = NULL;
+	}
+	if( number_of_inodes == 0 )
+	{
+		return( 1 );
+	}
+	sorted_inodes = (libfsxfs_file_system_sorted_inode_t *) memory_allocate(
+	                                                         sizeof( libfsxfs_file_system_sorted_inode_t ) * number_of_inodes );
+
+	if( sorted_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted inodes.",
+		 function );
+
+		goto on_error;
+	}
+	/* Resolve the inode numbers that are not cached to file offsets
+	 */
+	for( inode_index = 0;
+	     inode_index < number_of_inodes;
+	     inode_index++ )
+	{
+		result = libfsxfs_file_system_get_cached_inode_by_number(
+		          file_system,
+		          inode_numbers[ inode_index ],
+		          &safe_inode,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached inode: %" PRIu64 ".",
+			 function,
+			 inode_numbers[ inode_index ] );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			inodes[ inode_index ] = safe_inode;
+			safe_inode            = NULL;
+
+			continue;
+		}
+		result = libfsxfs_inode_btree_get_inode_by_number(
+		          file_system->inode_btree,
+		          io_handle,
+		          file_io_handle,
+		          inode_numbers[ inode_index ],
+		          &( sorted_inodes[ number_of_sorted_inodes ].file_offset ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to retrieve inode: %" PRIu64 ".",
+			 function,
+			 inode_numbers[ inode_index ] );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		sorted_inodes[ number_of_sorted_inodes ].inode_index = inode_index;
+
+		number_of_sorted_inodes++;
+	}
+	/* Sort the inodes by file offset so that inodes that are near each other
+	 * can be read with a single read
+	 */
+	if( number_of_sorted_inodes > 1 )
+	{
+		qsort(
+		 sorted_inodes,
+		 (size_t) number_of_sorted_inodes,
+		 sizeof( libfsxfs_file_system_sorted_inode_t ),
+		 &libfsxfs_file_system_compare_sorted_inodes );
+	}
+	if( ( io_handle->memory_mapped_file == NULL )
+	 && ( io_handle->inode_cluster_cache != NULL )
+	 && ( io_handle->inode_cluster_size != 0 )
+	 && ( io_handle->allocation_group_size != 0 ) )
+	{
+		use_inode_cluster_cache = 1;
+	}
+	if( ( number_of_sorted_inodes > 0 )
+	 && ( io_handle->memory_mapped_file == NULL )
+	 && ( use_inode_cluster_cache == 0 ) )
+	{
+		cluster_buffer = (uint8_t *) memory_allocate(
+		                              sizeof( uint8_t ) * LIBFSXFS_MAXIMUM_INODE_CLUSTER_READ_SIZE );
+
+		if( cluster_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create cluster buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	first_sorted_index = 0;
+
+	while( first_sorted_index < number_of_sorted_inodes )
+	{
+		cluster_offset    = sorted_inodes[ first_sorted_index ].file_offset;
+		last_sorted_index = first_sorted_index;
+
+		if( use_inode_cluster_cache != 0 )
+		{
+			/* The inodes are sorted by file offset, hence inodes in the same
+			 * inode cluster are read consecutively from the inode cluster cache
+			 */
+			last_sorted_index = number_of_sorted_inodes - 1;
+		}
+		else
+		{
+			while( ( ( last_sorted_index + 1 ) < number_of_sorted_inodes )
+			    && ( ( sorted_inodes[ last_sorted_index + 1 ].file_offset - cluster_offset ) <= (off64_t) ( LIBFSXFS_MAXIMUM_INODE_CLUSTER_READ_SIZE - io_handle->inode_size ) ) )
+			{
+				last_sorted_index++;
+			}
+			cluster_data_size = (size_t) ( sorted_inodes[ last_sorted_index ].file_offset - cluster_offset ) + io_handle->inode_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading %d inodes at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd ".\n",
+				 last_sorted_index - first_sorted_index + 1,
+				 cluster_offset,
+				 cluster_offset,
+				 cluster_data_size );
+			}
+#endif
+			if( io_handle->memory_mapped_file != NULL )
+			{
+				if( libfsxfs_memory_mapped_file_get_data_at_offset(
+				     io_handle->memory_mapped_file,
+				     cluster_offset,
+				     cluster_data_size,
+				     &cluster_data,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve inode cluster data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 cluster_offset,
+					 cluster_offset );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				read_count = libbfio_handle_read_buffer_at_offset(
+				              file_io_handle,
+				              cluster_buffer,
+				              cluster_data_size,
+				              cluster_offset,
+				              error );
+
+				if( read_count != (ssize_t) cluster_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read inode cluster data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 cluster_offset,
+					 cluster_offset );
+
+					goto on_error;
+				}
+				cluster_data = cluster_buffer;
+			}
+		}
+		for( sorted_index = first_sorted_index;
+		     sorted_index <= last_sorted_index;
+		     sorted_index++ )
+		{
+			inode_index = sorted_inodes[ sorted_index ].inode_index;
+
+			/* The same inode number can be requested more than once
+			 */
+			result = libfsxfs_file_system_get_cached_inode_by_number(
+			          file_system,
+			          inode_numbers[ inode_index ],
+			          &safe_inode,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cached inode: %" PRIu64 ".",
+				 function,
+				 inode_numbers[ inode_index ] );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				inodes[ inode_index ] = safe_inode;
+				safe_inode            = NULL;
+
+				continue;
+			}
+			if( libfsxfs_inode_initialize(
+			     &safe_inode,
+			     io_handle->inode_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create inode.",
+				 function );
+
+				goto on_error;
+			}
+			if( use_inode_cluster_cache != 0 )
+			{
+				result = libfsxfs_inode_read_file_io_handle(
+				          safe_inode,
+				          io_handle,
+				          file_io_handle,
+				          sorted_inodes[ sorted_index ].file_offset,
+				          error );
+			}
+			else
+			{
+				result = libfsxfs_inode_read_data_and_forks(
+				          safe_inode,
+				          io_handle,
+				          file_io_handle,
+				          &( cluster_data[ sorted_inodes[ sorted_index ].file_offset - cluster_offset ] ),
+				          (size_t) io_handle->inode_size,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 inode_numbers[ inode_index ],
+				 sorted_inodes[ sorted_index ].file_offset,
+				 sorted_inodes[ sorted_index ].file_offset );
+
+				goto on_error;
+			}
+			if( libfsxfs_file_system_set_cached_inode_by_number(
+			     file_system,
+			     inode_numbers[ inode_index ],
+			     safe_inode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to cache inode: %" PRIu64 ".",
+				 function,
+				 inode_numbers[ inode_index ] );
+
+				goto on_error;
+			}
+			inodes[ inode_index ] = safe_inode;
+			safe_inode            = NULL;
+		}
+		first_sorted_index = last_sorted_index + 1;
+	}
+	if( cluster_buffer != NULL )
+	{
+		memory_free(
+		 cluster_buffer );
+	}
+	memory_free(
+	 sorted_inodes );
+
+	return( 1 );
+
+on_error:
+	if( safe_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	if( cluster_buffer != NULL )
+	{
+		memory_free(
+		 cluster_buffer );
+	}
+	if( sorted_inodes != NULL )
+	{
+		memory_free(
+		 sorted_inodes );
+	}
+	for( inode_index = 0;
+	     inode_index < number_of_inodes;
+	     inode_index++ )
+	{
+		if( inodes[ inode_index ] != NULL )
+		{
+			libfsxfs_inode_free(
+			 &( inodes[ inode_index ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Retrieves the inode chunk index of a specific allocation group
+ * The inode chunk index is owned by the inode B+ tree and must not be freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_get_inode_chunk_index(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_chunk_index_t **inode_chunk_index,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_information_t *inode_information = NULL;
+	static char *function                           = "libfsxfs_file_system_get_inode_chunk_index";
+	uint64_t allocation_group_block_number          = 0;
+	int result                                      = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_index > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_btree_get_inode_information(
+	     file_system->inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     (int) allocation_group_index,
+	     &inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	allocation_group_block_number = (uint64_t) allocation_group_index * io_handle->allocation_group_size;
+
+	result = libfsxfs_inode_btree_get_chunk_index(
+	          file_system->inode_btree,
+	          io_handle,
+	          file_io_handle,
+	          allocation_group_block_number,
+	          inode_information,
+	          inode_chunk_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode chunk index: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported allocation group: %" PRIu32 " - too many inode chunks.",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Iterates the allocated inodes in a range of inode chunks of a specific allocation group
+ * The inodes are read per inode chunk in order of the inode B+ tree, where free inodes are skipped
+ * The inodes are not added to the inode cache, so that a scan does not evict frequently used inodes
+ * The callback function takes over management of the inode and returns 1 to continue, 0 to stop or -1 on error
+ * The callback function is passed the file IO handle the inode was read with
+ * Returns 1 if all inodes were iterated, 0 if the iteration was stopped or -1 on error
+ */
+int libfsxfs_file_system_iterate_inodes_in_inode_chunks(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     int first_chunk_index,
+     int number_of_chunks,
+     int (*callback_function)(
+            uint64_t inode_number,
+            libfsxfs_inode_t *inode,
+            libbfio_handle_t *file_io_handle,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *inode                = NULL;
+	const uint8_t *chunk_data              = NULL;
+	uint8_t *chunk_buffer                  = NULL;
+	static char *function                  = "libfsxfs_file_system_iterate_inodes_in_inode_chunks";
+	size_t chunk_data_size                 = 0;
+	ssize_t read_count                     = 0;
+	off64_t chunk_offset                   = 0;
+	uint64_t allocation_group_block_number = 0;
+	uint64_t free_inode_bitmap             = 0;
+	uint64_t inode_number                  = 0;
+	int chunk_index                        = 0;
+	int first_inode_index                  = 0;
+	int inode_index                        = 0;
+	int last_inode_index                   = 0;
+	int result                             = 1;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->inode_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - inode size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_index > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_chunk_index < 0 )
+	 || ( number_of_chunks < 0 )
+	 || ( first_chunk_index > inode_chunk_index->number_of_chunks )
+	 || ( number_of_chunks > ( inode_chunk_index->number_of_chunks - first_chunk_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode chunk range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	allocation_group_block_number = (uint64_t) allocation_group_index * io_handle->allocation_group_size;
+
+	if( io_handle->memory_mapped_file == NULL )
+	{
+		chunk_buffer = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * 64 * io_handle->inode_size );
+
+		if( chunk_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( chunk_index = first_chunk_index;
+	     chunk_index < ( first_chunk_index + number_of_chunks );
+	     chunk_index++ )
+	{
+		if( io_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		free_inode_bitmap = inode_chunk_index->free_inode_bitmaps[ chunk_index ];
+
+		if( free_inode_bitmap == 0xffffffffffffffffUL )
+		{
+			continue;
+		}
+		/* Only read the part of the chunk that contains allocated inodes
+		 */
+		first_inode_index = 0;
+
+		while( ( free_inode_bitmap & ( (uint64_t) 1 << first_inode_index ) ) != 0 )
+		{
+			first_inode_index++;
+		}
+		last_inode_index = 63;
+
+		while( ( free_inode_bitmap & ( (uint64_t) 1 << last_inode_index ) ) != 0 )
+		{
+			last_inode_index--;
+		}
+		chunk_offset    = ( (off64_t) allocation_group_block_number * io_handle->block_size )
+		                + ( (off64_t) ( inode_chunk_index->inode_numbers[ chunk_index ] + first_inode_index ) * io_handle->inode_size );
+		chunk_data_size = (size_t) ( last_inode_index - first_inode_index + 1 ) * io_handle->inode_size;
+
+		if( io_handle->memory_mapped_file != NULL )
+		{
+			if( libfsxfs_memory_mapped_file_get_data_at_offset(
+			     io_handle->memory_mapped_file,
+			     chunk_offset,
+			     chunk_data_size,
+			     &chunk_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve inode chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 chunk_offset,
+				 chunk_offset );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              chunk_buffer,
+			              chunk_data_size,
+			              chunk_offset,
+			              error );
+
+			if( read_count != (ssize_t) chunk_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 chunk_offset,
+				 chunk_offset );
+
+				goto on_error;
+			}
+			chunk_data = chunk_buffer;
+		}
+		for( inode_index = first_inode_index;
+		     inode_index <= last_inode_index;
+		     inode_index++ )
+		{
+			if( ( free_inode_bitmap & ( (uint64_t) 1 << inode_index ) ) != 0 )
+			{
+				continue;
+			}
+			inode_number = ( (uint64_t) allocation_group_index << io_handle->number_of_relative_inode_number_bits )
+			             | ( inode_chunk_index->inode_numbers[ chunk_index ] + inode_index );
+
+			if( libfsxfs_inode_initialize(
+			     &inode,
+			     io_handle->inode_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create inode.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_inode_read_data_and_forks(
+			     inode,
+			     io_handle,
+			     file_io_handle,
+			     &( chunk_data[ ( inode_index - first_inode_index ) * io_handle->inode_size ] ),
+			     (size_t) io_handle->inode_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode: %" PRIu64 ".",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			/* The callback function takes over management of inode
+			 */
+			result = callback_function(
+			          inode_number,
+			          inode,
+			          file_io_handle,
+			          callback_data,
+			          error );
+
+			inode = NULL;
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback function failed for inode: %" PRIu64 ".",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		if( result == 0 )
+		{
+			break;
+		}
+	}
+	if( chunk_buffer != NULL )
+	{
+		memory_free(
+		 chunk_buffer );
+	}
+	return( result );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( chunk_buffer != NULL )
+	{
+		memory_free(
+		 chunk_buffer );
+	}
+	return( -1 );
+}
+
+/* Iterates the allocated inodes of a specific allocation group
+ * The inodes are not added to the inode cache, so that a scan does not evict frequently used inodes
+ * The callback function takes over management of the inode and returns 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if all inodes were iterated, 0 if the iteration was stopped or -1 on error
+ */
+int libfsxfs_file_system_iterate_inodes_in_allocation_group(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     int (*callback_function)(
+            uint64_t inode_number,
+            libfsxfs_inode_t *inode,
+            libbfio_handle_t *file_io_handle,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_chunk_index_t *inode_chunk_index = NULL;
+	static char *function                           = "libfsxfs_file_system_iterate_inodes_in_allocation_group";
+	int result                                      = 0;
+
+	if( libfsxfs_file_system_get_inode_chunk_index(
+	     file_system,
+	     io_handle,
+	     file_io_handle,
+	     allocation_group_index,
+	     &inode_chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode chunk index: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	result = libfsxfs_file_system_iterate_inodes_in_inode_chunks(
+	          file_system,
+	          io_handle,
+	          file_io_handle,
+	          allocation_group_index,
+	          inode_chunk_index,
+	          0,
+	          inode_chunk_index->number_of_chunks,
+	          callback_function,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to iterate inodes in inode chunks of allocation group: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Iterates the allocated inodes of all allocation groups
+ * The callback function takes over management of the inode and returns 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if all inodes were iterated, 0 if the iteration was stopped or -1 on error
+ */
+int libfsxfs_file_system_iterate_inodes(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     int (*callback_function)(
+            uint64_t inode_number,
+            libfsxfs_inode_t *inode,
+            libbfio_handle_t *file_io_handle,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfsxfs_file_system_iterate_inodes";
+	uint32_t allocation_group_index = 0;
+	int result                      = 1;
+
+	for( allocation_group_index = 0;
+	     allocation_group_index < number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		result = libfsxfs_file_system_iterate_inodes_in_allocation_group(
+		          file_system,
+		          io_handle,
+		          file_io_handle,
+		          allocation_group_index,
+		          callback_function,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to iterate inodes in allocation group: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves a directory entry for a specific UTF-8 encoded name in a parent directory
+ * The directory entry cache is consulted first, which also records names that do not exist
+ * On success directory_entry is set to a directory entry that the caller must free
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_file_system_get_directory_entry_by_utf8_name(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t parent_inode_number,
+     libfsxfs_inode_t *parent_inode,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_t *directory                  = NULL;
+	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                            = "libfsxfs_file_system_get_directory_entry_by_utf8_name";
+	int result                                       = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->directory_entry_cache != NULL )
+	{
+		result = libfsxfs_directory_entry_cache_get_entry(
+		          file_system->directory_entry_cache,
+		          parent_inode_number,
+		          utf8_string,
+		          utf8_string_length,
+		          directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry from cache.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( *directory_entry == NULL )
+			{
+				return( 0 );
+			}
+			return( 1 );
+		}
+	}
+	if( libfsxfs_directory_initialize(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_directory_entry_initialize(
+	     &safe_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsxfs_directory_read_entry_by_utf8_name(
+	          directory,
+	          io_handle,
+	          file_io_handle,
+	          parent_inode,
+	          utf8_string,
+	          utf8_string_length,
+	          safe_directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read directory entry by UTF-8 name from inode: %" PRIu64 ".",
+		 function,
+		 parent_inode_number );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libfsxfs_directory_entry_free(
+		     &safe_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_system->directory_entry_cache != NULL )
+	{
+		if( libfsxfs_directory_entry_cache_set_entry(
+		     file_system->directory_entry_cache,
+		     parent_inode_number,
+		     utf8_string,
+		     utf8_string_length,
+		     safe_directory_entry,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set directory entry in cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsxfs_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
+		 function );
+
+		goto on_error;
+	}
+	*directory_entry = safe_directory_entry;
+
+	return( result );
+
+on_error:
+	if( safe_directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read inode information at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
-
-		return( 1 );
+		libfsxfs_directory_free(
+		 &directory,
+		 NULL );
 	}
-	return( 1 );
+	return( -1 );
 }
 
-/* Retrieves a specific inode
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Retrieves a directory entry for a specific UTF-16 encoded name in a parent directory
+ * The directory entry cache is consulted first, which also records names that do not exist
+ * On success directory_entry is set to a directory entry that the caller must free
+ * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsxfs_file_system_get_inode_by_number(
+int libfsxfs_file_system_get_directory_entry_by_utf16_name(
      libfsxfs_file_system_t *file_system,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     uint64_t inode_number,
-     libfsxfs_inode_t **inode,
+     uint64_t parent_inode_number,
+     libfsxfs_inode_t *parent_inode,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_t *safe_inode = NULL;
-	static char *function        = "libfsxfs_file_system_get_inode_by_number";
-	off64_t file_offset          = 0;
-	int result                   = 0;
+	uint8_t utf8_name[ 256 ];
+
+	libfsxfs_directory_t *directory                  = NULL;
+	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                            = "libfsxfs_file_system_get_directory_entry_by_utf16_name";
+	size_t utf8_name_size                            = 0;
+	int result                                       = 0;
 
 	if( file_system == NULL )
 	{
@@ -281,114 +2176,201 @@ int libfsxfs_file_system_get_inode_by_number(
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( directory_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid directory entry.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle->inode_size == 0 )
+	/* The directory entry cache is keyed by the UTF-8 representation of the name,
+	 * names that do not fit in the name buffer bypass the cache
+	 */
+	if( file_system->directory_entry_cache != NULL )
+	{
+		if( libuna_utf8_string_size_from_utf16(
+		     utf16_string,
+		     utf16_string_length,
+		     &utf8_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 name size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( utf8_name_size <= 1 )
+		 || ( utf8_name_size > 256 ) )
+		{
+			utf8_name_size = 0;
+		}
+		else
+		{
+			if( libuna_utf8_string_copy_from_utf16(
+			     utf8_name,
+			     256,
+			     utf16_string,
+			     utf16_string_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 name.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfsxfs_directory_entry_cache_get_entry(
+			          file_system->directory_entry_cache,
+			          parent_inode_number,
+			          utf8_name,
+			          utf8_name_size - 1,
+			          directory_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry from cache.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( *directory_entry == NULL )
+				{
+					return( 0 );
+				}
+				return( 1 );
+			}
+		}
+	}
+	if( libfsxfs_directory_initialize(
+	     &directory,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - inode size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ( inode_number == 0 )
-	 || ( inode_number > (uint64_t) UINT32_MAX ) )
+	if( libfsxfs_directory_entry_initialize(
+	     &safe_directory_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid inode number value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	result = libfsxfs_inode_btree_get_inode_by_number(
-	          file_system->inode_btree,
+	result = libfsxfs_directory_read_entry_by_utf16_name(
+	          directory,
 	          io_handle,
 	          file_io_handle,
-	          inode_number,
-	          &file_offset,
+	          parent_inode,
+	          utf16_string,
+	          utf16_string_length,
+	          safe_directory_entry,
 	          error );
 
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 "\n",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read directory entry by UTF-16 name from inode: %" PRIu64 ".",
 		 function,
-		 inode_number );
+		 parent_inode_number );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	else if( result == 0 )
 	{
-		if( libfsxfs_inode_initialize(
-		     &safe_inode,
-		     io_handle->inode_size,
+		if( libfsxfs_directory_entry_free(
+		     &safe_directory_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create inode.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 inode_number,
-			 file_offset,
-			 file_offset );
-		}
-#endif
-		if( libfsxfs_inode_read_file_io_handle(
-		     safe_inode,
-		     io_handle,
-		     file_io_handle,
-		     file_offset,
-		     error ) != 1 )
+	}
+	if( utf8_name_size != 0 )
+	{
+		if( libfsxfs_directory_entry_cache_set_entry(
+		     file_system->directory_entry_cache,
+		     parent_inode_number,
+		     utf8_name,
+		     utf8_name_size - 1,
+		     safe_directory_entry,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 inode_number,
-			 file_offset,
-			 file_offset );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set directory entry in cache.",
+			 function );
 
 			goto on_error;
 		}
-		*inode = safe_inode;
 	}
+	if( libfsxfs_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
+		 function );
+
+		goto on_error;
+	}
+	*directory_entry = safe_directory_entry;
+
 	return( result );
 
 on_error:
-	if( safe_inode != NULL )
+	if( safe_directory_entry != NULL )
 	{
-		libfsxfs_inode_free(
-		 &safe_inode,
+		libfsxfs_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsxfs_directory_free(
+		 &directory,
 		 NULL );
 	}
 	return( -1 );
@@ -408,7 +2390,6 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_t *directory                  = NULL;
 	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
 	libfsxfs_inode_t *safe_inode                     = NULL;
 	const uint8_t *utf8_string_segment               = NULL;
@@ -510,52 +2491,22 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 	}
 	else while( utf8_string_index < utf8_string_length )
 	{
-		if( directory != NULL )
+		if( safe_directory_entry != NULL )
 		{
-			if( libfsxfs_directory_free(
-			     &directory,
+			if( libfsxfs_directory_entry_free(
+			     &safe_directory_entry,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory.",
+				 "%s: unable to free directory entry.",
 				 function );
 
 				goto on_error;
 			}
 		}
-		if( libfsxfs_directory_initialize(
-		     &directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsxfs_directory_read_file_io_handle(
-		     directory,
-		     io_handle,
-		     file_io_handle,
-		     safe_inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory from inode: %" PRIu64 ".",
-			 function,
-			 safe_inode_number );
-
-			goto on_error;
-		}
 		utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
 		utf8_string_segment_length = utf8_string_index;
 
@@ -593,8 +2544,12 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 		}
 		else
 		{
-			result = libfsxfs_directory_get_entry_by_utf8_name(
-			          directory,
+			result = libfsxfs_file_system_get_directory_entry_by_utf8_name(
+			          file_system,
+			          io_handle,
+			          file_io_handle,
+			          safe_inode_number,
+			          safe_inode,
 			          utf8_string_segment,
 			          utf8_string_segment_length,
 			          &safe_directory_entry,
@@ -606,8 +2561,9 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by UTF-8 name.",
-			 function );
+			 "%s: unable to retrieve directory entry by UTF-8 name from inode: %" PRIu64 ".",
+			 function,
+			 safe_inode_number );
 
 			goto on_error;
 		}
@@ -685,34 +2641,20 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 	}
 	else
 	{
-		if( libfsxfs_directory_entry_clone(
-		     directory_entry,
-		     safe_directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory entry.",
-			 function );
-
-			goto on_error;
-		}
+		*directory_entry     = safe_directory_entry;
+		safe_directory_entry = NULL;
 	}
-	/* Directory needs to be freed after making a clone of directory_entry
-	 */
-	if( directory != NULL )
+	if( safe_directory_entry != NULL )
 	{
-		if( libfsxfs_directory_free(
-		     &directory,
+		if( libfsxfs_directory_entry_free(
+		     &safe_directory_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free directory.",
+			 "%s: unable to free directory entry.",
 			 function );
 
 			goto on_error;
@@ -724,10 +2666,10 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 	return( result );
 
 on_error:
-	if( directory != NULL )
+	if( safe_directory_entry != NULL )
 	{
-		libfsxfs_directory_free(
-		 &directory,
+		libfsxfs_directory_entry_free(
+		 &safe_directory_entry,
 		 NULL );
 	}
 	if( safe_inode != NULL )
@@ -759,7 +2701,6 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_t *directory                  = NULL;
 	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
 	libfsxfs_inode_t *safe_inode                     = NULL;
 	const uint16_t *utf16_string_segment             = NULL;
@@ -861,52 +2802,22 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 	}
 	else while( utf16_string_index < utf16_string_length )
 	{
-		if( directory != NULL )
+		if( safe_directory_entry != NULL )
 		{
-			if( libfsxfs_directory_free(
-			     &directory,
+			if( libfsxfs_directory_entry_free(
+			     &safe_directory_entry,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory.",
+				 "%s: unable to free directory entry.",
 				 function );
 
 				goto on_error;
 			}
 		}
-		if( libfsxfs_directory_initialize(
-		     &directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsxfs_directory_read_file_io_handle(
-		     directory,
-		     io_handle,
-		     file_io_handle,
-		     safe_inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory from inode: %" PRIu64 ".",
-			 function,
-			 safe_inode_number );
-
-			goto on_error;
-		}
 		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
 		utf16_string_segment_length = utf16_string_index;
 
@@ -944,8 +2855,12 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 		}
 		else
 		{
-			result = libfsxfs_directory_get_entry_by_utf16_name(
-			          directory,
+			result = libfsxfs_file_system_get_directory_entry_by_utf16_name(
+			          file_system,
+			          io_handle,
+			          file_io_handle,
+			          safe_inode_number,
+			          safe_inode,
 			          utf16_string_segment,
 			          utf16_string_segment_length,
 			          &safe_directory_entry,
@@ -957,8 +2872,9 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by UTF-16 name.",
-			 function );
+			 "%s: unable to retrieve directory entry by UTF-16 name from inode: %" PRIu64 ".",
+			 function,
+			 safe_inode_number );
 
 			goto on_error;
 		}
@@ -1036,34 +2952,20 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 	}
 	else
 	{
-		if( libfsxfs_directory_entry_clone(
-		     directory_entry,
-		     safe_directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory entry.",
-			 function );
-
-			goto on_error;
-		}
+		*directory_entry     = safe_directory_entry;
+		safe_directory_entry = NULL;
 	}
-	/* Directory needs to be freed after making a clone of directory_entry
-	 */
-	if( directory != NULL )
+	if( safe_directory_entry != NULL )
 	{
-		if( libfsxfs_directory_free(
-		     &directory,
+		if( libfsxfs_directory_entry_free(
+		     &safe_directory_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free directory.",
+			 "%s: unable to free directory entry.",
 			 function );
 
 			goto on_error;
@@ -1075,10 +2977,10 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 	return( result );
 
 on_error:
-	if( directory != NULL )
+	if( safe_directory_entry != NULL )
 	{
-		libfsxfs_directory_free(
-		 &directory,
+		libfsxfs_directory_entry_free(
+		 &safe_directory_entry,
 		 NULL );
 	}
 	if( safe_inode != NULL )
@@ -26,11 +26,14 @@
 #include <types.h>
 
 #include "libfsxfs_directory_entry.h"
+#include "libfsxfs_directory_entry_cache.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_inode_btree.h"
+#include "libfsxfs_inode_chunk_index.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfcache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -48,6 +51,14 @@ struct libfsxfs_file_system
 	 */
 	uint64_t root_directory_inode_number;
 
+	/* The inode cache
+	 */
+	libfcache_cache_t *inode_cache;
+
+	/* The directory entry cache
+	 */
+	libfsxfs_directory_entry_cache_t *directory_entry_cache;
+
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -58,6 +69,8 @@ struct libfsxfs_file_system
 int libfsxfs_file_system_initialize(
      libfsxfs_file_system_t **file_system,
      uint64_t root_directory_inode_number,
+     int maximum_number_of_cached_inodes,
+     int maximum_number_of_cached_directory_entries,
      libcerror_error_t **error );
 
 int libfsxfs_file_system_free(
@@ -71,6 +84,31 @@ int libfsxfs_file_system_read_inode_information(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libfsxfs_file_system_read_all_inode_information(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_set_number_of_allocation_groups(
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_get_cached_inode_by_number(
+     libfsxfs_file_system_t *file_system,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_set_cached_inode_by_number(
+     libfsxfs_file_system_t *file_system,
+     uint64_t inode_number,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error );
+
 int libfsxfs_file_system_get_inode_by_number(
      libfsxfs_file_system_t *file_system,
      libfsxfs_io_handle_t *io_handle,
@@ -79,6 +117,90 @@ int libfsxfs_file_system_get_inode_by_number(
      libfsxfs_inode_t **inode,
      libcerror_error_t **error );
 
+int libfsxfs_file_system_get_inodes_by_numbers(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint64_t *inode_numbers,
+     int number_of_inodes,
+     libfsxfs_inode_t **inodes,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_get_inode_chunk_index(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_chunk_index_t **inode_chunk_index,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_iterate_inodes_in_inode_chunks(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     int first_chunk_index,
+     int number_of_chunks,
+     int (*callback_function)(
+            uint64_t inode_number,
+            libfsxfs_inode_t *inode,
+            libbfio_handle_t *file_io_handle,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_iterate_inodes_in_allocation_group(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     int (*callback_function)(
+            uint64_t inode_number,
+            libfsxfs_inode_t *inode,
+            libbfio_handle_t *file_io_handle,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_iterate_inodes(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     int (*callback_function)(
+            uint64_t inode_number,
+            libfsxfs_inode_t *inode,
+            libbfio_handle_t *file_io_handle,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_get_directory_entry_by_utf8_name(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t parent_inode_number,
+     libfsxfs_inode_t *parent_inode,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_get_directory_entry_by_utf16_name(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t parent_inode_number,
+     libfsxfs_inode_t *parent_inode,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
 int libfsxfs_file_system_get_directory_entry_by_utf8_path(
      libfsxfs_file_system_t *file_system,
      libfsxfs_io_handle_t *io_handle,
@@ -23,12 +23,14 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsxfs_block_cache.h"
 #include "libfsxfs_file_system_block.h"
 #include "libfsxfs_file_system_block_header.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
+#include "libfsxfs_memory_mapped_file.h"
 
 #include "fsxfs_file_system_block.h"
 
@@ -342,6 +344,17 @@ int libfsxfs_file_system_block_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -352,12 +365,34 @@ int libfsxfs_file_system_block_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              file_system_block->data,
-	              file_system_block->data_size,
-	              file_offset,
-	              error );
+	if( io_handle->memory_mapped_file != NULL )
+	{
+		read_count = libfsxfs_memory_mapped_file_read_buffer_at_offset(
+		              io_handle->memory_mapped_file,
+		              file_system_block->data,
+		              file_system_block->data_size,
+		              file_offset,
+		              error );
+	}
+	else if( io_handle->metadata_block_cache != NULL )
+	{
+		read_count = libfsxfs_block_cache_read_buffer_at_offset(
+		              io_handle->metadata_block_cache,
+		              file_io_handle,
+		              file_system_block->data,
+		              file_system_block->data_size,
+		              file_offset,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              file_system_block->data,
+		              file_system_block->data_size,
+		              file_offset,
+		              error );
+	}
 
 	if( read_count != (ssize_t) file_system_block->data_size )
 	{
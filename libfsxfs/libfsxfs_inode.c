@@ -25,17 +25,21 @@
 #include <types.h>
 
 #include "libfsxfs_attribute_values.h"
+#include "libfsxfs_block_cache.h"
 #include "libfsxfs_debug.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_extent.h"
 #include "libfsxfs_extent_btree.h"
 #include "libfsxfs_extent_list.h"
+#include "libfsxfs_extent_map.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
 #include "libfsxfs_libfdatetime.h"
 #include "libfsxfs_libfguid.h"
+#include "libfsxfs_memory_mapped_file.h"
 
 #include "fsxfs_inode.h"
 
@@ -135,11 +139,33 @@ int libfsxfs_inode_initialize(
 	}
 	( *inode )->data_size = inode_size;
 
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *inode )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *inode )->number_of_references = 1;
+
 	return( 1 );
 
 on_error:
 	if( *inode != NULL )
 	{
+		if( ( *inode )->data != NULL )
+		{
+			memory_free(
+			 ( *inode )->data );
+		}
 		memory_free(
 		 *inode );
 
@@ -149,14 +175,16 @@ on_error:
 }
 
 /* Frees a inode
+ * The inode is only freed when its last reference is released
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_inode_free(
      libfsxfs_inode_t **inode,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_inode_free";
-	int result            = 1;
+	static char *function    = "libfsxfs_inode_free";
+	int number_of_references = 0;
+	int result               = 1;
 
 	if( inode == NULL )
 	{
@@ -171,6 +199,64 @@ int libfsxfs_inode_free(
 	}
 	if( *inode != NULL )
 	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     ( *inode )->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		( *inode )->number_of_references -= 1;
+
+		number_of_references = ( *inode )->number_of_references;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     ( *inode )->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references > 0 )
+		{
+			*inode = NULL;
+
+			return( 1 );
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( ( *inode )->read_write_lock != NULL )
+		{
+			if( libcthreads_read_write_lock_free(
+			     &( ( *inode )->read_write_lock ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read/write lock.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		if( ( *inode )->data != NULL )
 		{
 			memory_free(
@@ -193,6 +279,38 @@ int libfsxfs_inode_free(
 				result = -1;
 			}
 		}
+		if( ( *inode )->data_extent_map != NULL )
+		{
+			if( libfsxfs_extent_map_free(
+			     &( ( *inode )->data_extent_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data extent map.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *inode )->data_extent_btree != NULL )
+		{
+			if( libfsxfs_extent_btree_free(
+			     &( ( *inode )->data_extent_btree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data extent B+ tree.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *inode )->attributes_extents_array != NULL )
 		{
 			if( libcdata_array_free(
@@ -218,6 +336,78 @@ int libfsxfs_inode_free(
 	return( result );
 }
 
+/* Adds a reference to the inode
+ * Every reference must be released with libfsxfs_inode_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_add_reference(
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_add_reference";
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     inode->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( inode->number_of_references == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode - number of references value out of bounds.",
+		 function );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_write(
+		 inode->read_write_lock,
+		 NULL );
+#endif
+		return( -1 );
+	}
+	inode->number_of_references += 1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     inode->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
 /* Reads the inode data
  * Returns 1 if successful or -1 on error
  */
@@ -871,11 +1061,10 @@ int libfsxfs_inode_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	libfsxfs_extent_btree_t *extent_btree = NULL;
-	static char *function                 = "libfsxfs_inode_read_file_io_handle";
-	ssize_t read_count                    = 0;
-	uint64_t number_of_blocks             = 0;
-	uint8_t add_sparse_extents            = 0;
+	static char *function              = "libfsxfs_inode_read_file_io_handle";
+	ssize_t read_count                 = 0;
+	off64_t allocation_group_data_size = 0;
+	off64_t inode_cluster_offset       = 0;
 
 	if( inode == NULL )
 	{
@@ -909,12 +1098,44 @@ int libfsxfs_inode_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              inode->data,
-	              inode->data_size,
-	              file_offset,
-	              error );
+	if( io_handle->memory_mapped_file != NULL )
+	{
+		read_count = libfsxfs_memory_mapped_file_read_buffer_at_offset(
+		              io_handle->memory_mapped_file,
+		              inode->data,
+		              inode->data_size,
+		              file_offset,
+		              error );
+	}
+	else if( ( io_handle->inode_cluster_cache != NULL )
+	      && ( io_handle->inode_cluster_size != 0 )
+	      && ( io_handle->allocation_group_size != 0 ) )
+	{
+		/* Inode clusters are aligned relative to the start of the allocation group
+		 */
+		allocation_group_data_size = (off64_t) io_handle->allocation_group_size * io_handle->block_size;
+		inode_cluster_offset       = file_offset % allocation_group_data_size;
+		inode_cluster_offset       = file_offset - ( inode_cluster_offset % io_handle->inode_cluster_size );
+
+		read_count = libfsxfs_block_cache_read_buffer_from_block(
+		              io_handle->inode_cluster_cache,
+		              file_io_handle,
+		              inode_cluster_offset,
+		              (size_t) io_handle->inode_cluster_size,
+		              (size_t) ( file_offset - inode_cluster_offset ),
+		              inode->data,
+		              inode->data_size,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              inode->data,
+		              inode->data_size,
+		              file_offset,
+		              error );
+	}
 
 	if( read_count != (ssize_t) inode->data_size )
 	{
@@ -929,8 +1150,10 @@ int libfsxfs_inode_read_file_io_handle(
 
 		return( -1 );
 	}
-	if( libfsxfs_inode_read_data(
+	if( libfsxfs_inode_read_data_and_forks(
 	     inode,
+	     io_handle,
+	     file_io_handle,
 	     inode->data,
 	     inode->data_size,
 	     error ) != 1 )
@@ -946,6 +1169,113 @@ int libfsxfs_inode_read_file_io_handle(
 
 		return( -1 );
 	}
+	return( 1 );
+}
+
+/* Reads the inode and the extents of its forks from inode data
+ * The data is copied into the inode if it is not the data of the inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_read_data_and_forks(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_btree_t *extent_btree = NULL;
+	static char *function                 = "libfsxfs_inode_read_data_and_forks";
+	uint64_t number_of_blocks             = 0;
+	uint8_t add_sparse_extents            = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != inode->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data != inode->data )
+	{
+		if( memory_copy(
+		     inode->data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy inode data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfsxfs_inode_read_data(
+	     inode,
+	     inode->data,
+	     inode->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode.",
+		 function );
+
+		return( -1 );
+	}
 	number_of_blocks = inode->size / io_handle->block_size;
 
 	if( ( inode->size % io_handle->block_size ) != 0 )
@@ -1055,62 +1385,116 @@ int libfsxfs_inode_read_file_io_handle(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		if( libcdata_array_initialize(
-		     &( inode->data_extents_array ),
-		     0,
-		     error ) != 1 )
+		/* For non-directories only the root node of the extent B+ tree is read,
+		 * the leaf nodes are read when a read touches their logical range
+		 */
+		if( ( inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data extents array.",
-			 function );
+			if( libfsxfs_extent_btree_initialize(
+			     &( inode->data_extent_btree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create data extents B+ tree.",
+				 function );
 
-			goto on_error;
-		}
-		if( libfsxfs_extent_btree_initialize(
-		     &extent_btree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data extents B+ tree.",
-			 function );
+				goto on_error;
+			}
+			if( libfsxfs_extent_btree_read_root_node(
+			     inode->data_extent_btree,
+			     &( inode->data[ inode->data_fork_offset ] ),
+			     inode->data_fork_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data extents B+ tree root node.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
-		if( libfsxfs_extent_btree_get_extents_from_root_node(
-		     extent_btree,
-		     io_handle,
-		     file_io_handle,
-		     number_of_blocks,
-		     &( inode->data[ inode->data_fork_offset ] ),
-		     inode->data_fork_size,
-		     inode->data_extents_array,
-		     add_sparse_extents,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data extents from extent B+ tree.",
-			 function );
+			if( libcdata_array_initialize(
+			     &( inode->data_extents_array ),
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create data extents array.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( libfsxfs_extent_btree_initialize(
+			     &extent_btree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create data extents B+ tree.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_extent_btree_get_extents_from_root_node(
+			     extent_btree,
+			     io_handle,
+			     file_io_handle,
+			     number_of_blocks,
+			     &( inode->data[ inode->data_fork_offset ] ),
+			     inode->data_fork_size,
+			     inode->data_extents_array,
+			     add_sparse_extents,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data extents from extent B+ tree.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_extent_btree_free(
+			     &extent_btree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data extents B+ tree.",
+				 function );
+
+				goto on_error;
+			}
 		}
-		if( libfsxfs_extent_btree_free(
-		     &extent_btree,
+	}
+	if( inode->data_extents_array != NULL )
+	{
+		if( libfsxfs_extent_map_initialize(
+		     &( inode->data_extent_map ),
+		     inode->data_extents_array,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free data extents B+ tree.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data extent map.",
 			 function );
 
 			goto on_error;
@@ -1270,6 +1654,18 @@ on_error:
 		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
 		 NULL );
 	}
+	if( inode->data_extent_btree != NULL )
+	{
+		libfsxfs_extent_btree_free(
+		 &( inode->data_extent_btree ),
+		 NULL );
+	}
+	if( inode->data_extent_map != NULL )
+	{
+		libfsxfs_extent_map_free(
+		 &( inode->data_extent_map ),
+		 NULL );
+	}
 	if( inode->data_extents_array != NULL )
 	{
 		libcdata_array_free(
@@ -1716,7 +2112,219 @@ int libfsxfs_inode_get_device_number(
 	return( 0 );
 }
 
+/* Reads the data extents of a data extent B+ tree that was not read when the inode was read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_read_data_extents(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *extents_array = NULL;
+	static char *function           = "libfsxfs_inode_read_data_extents";
+	uint64_t number_of_blocks       = 0;
+	int result                      = 1;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     inode->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( inode->data_extents_array == NULL )
+	 && ( inode->data_extent_btree != NULL ) )
+	{
+		number_of_blocks = inode->size / io_handle->block_size;
+
+		if( ( inode->size % io_handle->block_size ) != 0 )
+		{
+			number_of_blocks++;
+		}
+		if( libcdata_array_initialize(
+		     &extents_array,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data extents array.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfsxfs_extent_btree_get_extents_from_root_node(
+		          inode->data_extent_btree,
+		          io_handle,
+		          file_io_handle,
+		          number_of_blocks,
+		          &( inode->data[ inode->data_fork_offset ] ),
+		          inode->data_fork_size,
+		          extents_array,
+		          1,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data extents from extent B+ tree.",
+			 function );
+
+			libcdata_array_free(
+			 &extents_array,
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+			 NULL );
+
+			result = -1;
+		}
+		else
+		{
+			inode->data_extents_array = extents_array;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     inode->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data at a specific logical offset into a buffer
+ * The data is read using the data extent map or, when the inode uses a data extent
+ * B+ tree, the leaf nodes that cover the logical range
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_inode_read_data_buffer_at_offset(
+         libfsxfs_inode_t *inode,
+         libfsxfs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_read_data_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->data_extent_map != NULL )
+	{
+		read_count = libfsxfs_extent_map_read_buffer_at_offset(
+		              inode->data_extent_map,
+		              io_handle,
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+	}
+	else if( inode->data_extent_btree != NULL )
+	{
+		read_count = libfsxfs_extent_btree_read_buffer_at_offset(
+		              inode->data_extent_btree,
+		              io_handle,
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode - missing data extent map and B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
 /* Retrieves the number of data extents
+ * The data extents of a data extent B+ tree are read on demand by libfsxfs_inode_read_data_extents,
+ * hence the inode lock is held while the data extents are accessed
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_inode_get_number_of_data_extents(
@@ -1725,6 +2333,7 @@ int libfsxfs_inode_get_number_of_data_extents(
      libcerror_error_t **error )
 {
 	static char *function = "libfsxfs_inode_get_number_of_data_extents";
+	int result            = 1;
 
 	if( inode == NULL )
 	{
@@ -1737,6 +2346,21 @@ int libfsxfs_inode_get_number_of_data_extents(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     inode->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libcdata_array_get_number_of_entries(
 	     inode->data_extents_array,
 	     number_of_extents,
@@ -1749,9 +2373,24 @@ int libfsxfs_inode_get_number_of_data_extents(
 		 "%s: unable to retrieve number of data entries.",
 		 function );
 
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     inode->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
 /* Retrieves a specific data extent
@@ -1764,6 +2403,7 @@ int libfsxfs_inode_get_data_extent_by_index(
      libcerror_error_t **error )
 {
 	static char *function = "libfsxfs_inode_get_data_extent_by_index";
+	int result            = 1;
 
 	if( inode == NULL )
 	{
@@ -1776,6 +2416,21 @@ int libfsxfs_inode_get_data_extent_by_index(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     inode->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libcdata_array_get_entry_by_index(
 	     inode->data_extents_array,
 	     extent_index,
@@ -1790,9 +2445,24 @@ int libfsxfs_inode_get_data_extent_by_index(
 		 function,
 		 extent_index );
 
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     inode->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
 /* Retrieves the number of attributes extents
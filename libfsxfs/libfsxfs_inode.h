@@ -26,10 +26,13 @@
 #include <types.h>
 
 #include "libfsxfs_extent.h"
+#include "libfsxfs_extent_btree.h"
+#include "libfsxfs_extent_map.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -107,6 +110,14 @@ struct libfsxfs_inode
 	 */
 	libcdata_array_t *data_extents_array;
 
+	/* Data extent map
+	 */
+	libfsxfs_extent_map_t *data_extent_map;
+
+	/* Data extent B+ tree, of which the leaf nodes are read on demand
+	 */
+	libfsxfs_extent_btree_t *data_extent_btree;
+
 	/* Data fork offset
 	 */
 	uint16_t data_fork_offset;
@@ -138,6 +149,16 @@ struct libfsxfs_inode
 	/* (Extended) attributes fork size
 	 */
 	uint16_t attributes_fork_size;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsxfs_inode_initialize(
@@ -149,6 +170,10 @@ int libfsxfs_inode_free(
      libfsxfs_inode_t **inode,
      libcerror_error_t **error );
 
+int libfsxfs_inode_add_reference(
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_read_data(
      libfsxfs_inode_t *inode,
      const uint8_t *data,
@@ -162,6 +187,14 @@ int libfsxfs_inode_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libfsxfs_inode_read_data_and_forks(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_get_creation_time(
      libfsxfs_inode_t *inode,
      int64_t *posix_time,
@@ -218,6 +251,21 @@ int libfsxfs_inode_get_device_number(
      uint32_t *minor_device_number,
      libcerror_error_t **error );
 
+int libfsxfs_inode_read_data_extents(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_inode_read_data_buffer_at_offset(
+         libfsxfs_inode_t *inode,
+         libfsxfs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 int libfsxfs_inode_get_number_of_data_extents(
      libfsxfs_inode_t *inode,
      int *number_of_extents,
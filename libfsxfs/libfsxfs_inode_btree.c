@@ -28,12 +28,15 @@
 #include "libfsxfs_btree_header.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_inode_btree.h"
-#include "libfsxfs_inode_btree_record.h"
+#include "libfsxfs_inode_chunk_index.h"
 #include "libfsxfs_inode_information.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
+
+#include "fsxfs_btree.h"
 
 /* Creates an inode B+ tree
  * Make sure the value inode_btree is referencing, is set to NULL
@@ -114,11 +117,33 @@ int libfsxfs_inode_btree_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *inode_btree )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *inode_btree != NULL )
 	{
+		if( ( *inode_btree )->inode_information_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *inode_btree )->inode_information_array ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *inode_btree );
 
@@ -150,6 +175,21 @@ int libfsxfs_inode_btree_free(
 	}
 	if( *inode_btree != NULL )
 	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *inode_btree )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		if( libcdata_array_free(
 		     &( ( *inode_btree )->inode_information_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_information_free,
@@ -255,28 +295,18 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the inode from the inode B+ tree branch node
+/* Determines the offset of the inode information of a specific allocation group
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_inode_btree_get_inode_from_branch_node(
+int libfsxfs_inode_btree_get_inode_information_offset(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     uint64_t allocation_group_block_number,
-     uint16_t number_of_records,
-     const uint8_t *records_data,
-     size_t records_data_size,
-     uint64_t relative_inode_number,
-     int recursion_depth,
+     uint32_t allocation_group_index,
+     off64_t *file_offset,
      libcerror_error_t **error )
 {
-	static char *function              = "libfsxfs_inode_btree_get_inode_from_branch_node";
-	size_t number_of_key_value_pairs   = 0;
-	size_t records_data_offset         = 0;
-	uint32_t relative_key_inode_number = 0;
-	uint32_t relative_sub_block_number = 0;
-	uint16_t record_index              = 0;
-	int result                         = 0;
+	static char *function         = "libfsxfs_inode_btree_get_inode_information_offset";
+	off64_t allocation_group_size = 0;
 
 	if( inode_btree == NULL )
 	{
@@ -289,147 +319,168 @@ int libfsxfs_inode_btree_get_inode_from_branch_node(
 
 		return( -1 );
 	}
-	if( records_data == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid records data.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( records_data_size == 0 )
-	 || ( records_data_size > (size_t) SSIZE_MAX ) )
+	if( file_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid records data size value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
 		 function );
 
 		return( -1 );
 	}
-	number_of_key_value_pairs = records_data_size / 8;
+	allocation_group_size = (off64_t) io_handle->allocation_group_size * io_handle->block_size;
 
-	if( (size_t) number_of_records > number_of_key_value_pairs )
+	if( ( allocation_group_size == 0 )
+	 || ( (off64_t) allocation_group_index > ( ( (off64_t) INT64_MAX - ( 2 * io_handle->sector_size ) ) / allocation_group_size ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of records value out of bounds.",
-		 function );
+		 "%s: invalid allocation group: %" PRIu32 " offset value out of bounds.",
+		 function,
+		 allocation_group_index );
 
 		return( -1 );
 	}
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
-	{
-		byte_stream_copy_to_uint32_big_endian(
-		 &( records_data[ records_data_offset ] ),
-		 relative_key_inode_number );
+	/* The inode information (AGI) is stored in the third sector of the allocation group
+	 */
+	*file_offset = ( (off64_t) allocation_group_index * allocation_group_size ) + ( 2 * io_handle->sector_size );
 
-		records_data_offset += 4;
+	return( 1 );
+}
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: inode number\t\t: %" PRIu32 "\n",
-			 function,
-			 relative_key_inode_number );
-		}
-#endif
-		if( relative_inode_number < relative_key_inode_number )
-		{
-			break;
-		}
-	}
-	if( ( record_index > 0 )
-	 && ( record_index <= number_of_records ) )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+
+/* Reads the inode information of the allocation groups assigned to a thread
+ * The inode information is stored in the slot of its allocation group
+ * Returns 1 to the thread, the result and error are stored in the read context
+ */
+int libfsxfs_inode_btree_read_inode_information_thread_function(
+     void *arguments )
+{
+	libfsxfs_inode_btree_read_context_t *read_context = NULL;
+	libfsxfs_inode_information_t *inode_information   = NULL;
+	static char *function                             = "libfsxfs_inode_btree_read_inode_information_thread_function";
+	off64_t allocation_group_size                     = 0;
+	off64_t file_offset                               = 0;
+	uint32_t allocation_group_index                   = 0;
+
+	if( arguments == NULL )
 	{
-		records_data_offset = ( number_of_key_value_pairs + record_index - 1 ) * 4;
+		return( 1 );
+	}
+	read_context = (libfsxfs_inode_btree_read_context_t *) arguments;
 
-		byte_stream_copy_to_uint32_big_endian(
-		 &( records_data[ records_data_offset ] ),
-		 relative_sub_block_number );
+	read_context->result = 1;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+	allocation_group_size = (off64_t) read_context->io_handle->allocation_group_size * read_context->io_handle->block_size;
+
+	for( allocation_group_index = read_context->first_allocation_group_index;
+	     allocation_group_index < read_context->number_of_allocation_groups;
+	     allocation_group_index += read_context->allocation_group_index_increment )
+	{
+		if( read_context->io_handle->abort != 0 )
 		{
-			libcnotify_printf(
-			 "%s: sub block number\t: %" PRIu32 "\n",
-			 function,
-			 relative_sub_block_number );
+			read_context->failed_allocation_group_index = allocation_group_index;
+			read_context->result                        = -1;
 
-			libcnotify_printf(
-			 "\n" );
+			break;
 		}
-#endif
-		result = libfsxfs_inode_btree_get_inode_from_node(
-		          inode_btree,
-		          io_handle,
-		          file_io_handle,
-		          allocation_group_block_number,
-		          relative_sub_block_number,
-		          relative_inode_number,
-		          recursion_depth + 1,
-		          error );
+		/* The offset was validated for the last allocation group before the threads were started
+		 */
+		file_offset = ( (off64_t) allocation_group_index * allocation_group_size ) + ( 2 * read_context->io_handle->sector_size );
 
-		if( result == -1 )
+		if( libfsxfs_inode_information_initialize(
+		     &inode_information,
+		     &( read_context->error ) ) != 1 )
 		{
 			libcerror_error_set(
-			 error,
+			 &( read_context->error ),
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode from node.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode information.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( libfsxfs_inode_information_read_file_io_handle(
+		     inode_information,
+		     read_context->io_handle,
+		     read_context->file_io_handle,
+		     file_offset,
+		     &( read_context->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( read_context->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode information: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 allocation_group_index,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
 		}
+		read_context->inode_information[ allocation_group_index ] = inode_information;
+
+		inode_information = NULL;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	else if( libcnotify_verbose != 0 )
+	return( 1 );
+
+on_error:
+	if( inode_information != NULL )
 	{
-		libcnotify_printf(
-		 "\n" );
+		libfsxfs_inode_information_free(
+		 &inode_information,
+		 NULL );
 	}
-#endif
-	return( result );
+	read_context->failed_allocation_group_index = allocation_group_index;
+	read_context->result                        = -1;
+
+	return( 1 );
 }
 
-/* Retrieves the inode from the inode B+ tree leaf node
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
+/* Reads the inode information of all allocation groups
+ * If multi-threading is supported the inode information is read by multiple threads,
+ * each with its own file IO handle, and stored in allocation group order once all reads completed
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_inode_btree_get_inode_from_leaf_node(
+int libfsxfs_inode_btree_read_all_inode_information(
      libfsxfs_inode_btree_t *inode_btree,
-     uint16_t number_of_records,
-     const uint8_t *records_data,
-     size_t records_data_size,
-     uint64_t inode_number,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     int number_of_threads,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_btree_record_t *inode_btree_record = NULL;
-	static char *function                             = "libfsxfs_inode_btree_get_inode_from_leaf_node";
-	size_t records_data_offset                        = 0;
-	uint16_t record_index                             = 0;
-	int result                                        = 0;
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libfsxfs_inode_btree_read_context_t *read_contexts = NULL;
+	libfsxfs_inode_information_t **inode_information   = NULL;
+	int entry_index                                    = 0;
+	int thread_index                                   = 0;
+	int result                                         = 1;
+#endif
+	static char *function                              = "libfsxfs_inode_btree_read_all_inode_information";
+	off64_t file_offset                                = 0;
+	uint32_t allocation_group_index                    = 0;
+	int number_of_entries                              = 0;
 
 	if( inode_btree == NULL )
 	{
@@ -442,132 +493,1329 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
 
 		return( -1 );
 	}
-	if( records_data == NULL )
+	if( ( number_of_allocation_groups == 0 )
+	 || ( number_of_allocation_groups > (uint32_t) INT_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid records data.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of allocation groups value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( records_data_size == 0 )
-	 || ( records_data_size > (size_t) SSIZE_MAX ) )
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBFSXFS_MAXIMUM_NUMBER_OF_READ_THREADS ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid records data size value out of bounds.",
+		 "%s: invalid number of threads value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( (size_t) number_of_records > ( records_data_size / 16 ) )
+	if( libcdata_array_get_number_of_entries(
+	     inode_btree->inode_information_array,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of records value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of inode information entries.",
 		 function );
 
 		return( -1 );
 	}
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
+	if( number_of_entries != 0 )
 	{
-		if( libfsxfs_inode_btree_record_initialize(
-		     &inode_btree_record,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode B+ tree - inode information already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Validates the offset of the last allocation group, which is the largest
+	 */
+	if( libfsxfs_inode_btree_get_inode_information_offset(
+	     inode_btree,
+	     io_handle,
+	     number_of_allocation_groups - 1,
+	     &file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine inode information offset of last allocation group.",
+		 function );
+
+		return( -1 );
+	}
+	if( (uint32_t) number_of_threads > number_of_allocation_groups )
+	{
+		number_of_threads = (int) number_of_allocation_groups;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		if( ( (size_t) number_of_allocation_groups * sizeof( libfsxfs_inode_information_t * ) ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create inode B+ tree record: %" PRIu16 ".",
-			 function,
-			 record_index );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocation groups value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		inode_information = (libfsxfs_inode_information_t **) memory_allocate(
+		                                                       sizeof( libfsxfs_inode_information_t * ) * number_of_allocation_groups );
+
+		if( inode_information == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create inode information.",
+			 function );
 
 			goto on_error;
 		}
-		if( libfsxfs_inode_btree_record_read_data(
-		     inode_btree_record,
-		     &( records_data[ records_data_offset ] ),
-		     16,
-		     error ) != 1 )
+		if( memory_set(
+		     inode_information,
+		     0,
+		     sizeof( libfsxfs_inode_information_t * ) * number_of_allocation_groups ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read inode B+ tree record: %" PRIu16 ".",
-			 function,
-			 record_index );
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear inode information.",
+			 function );
 
 			goto on_error;
 		}
-		records_data_offset += 16;
+		read_contexts = (libfsxfs_inode_btree_read_context_t *) memory_allocate(
+		                                                         sizeof( libfsxfs_inode_btree_read_context_t ) * number_of_threads );
 
-		if( ( inode_number >= inode_btree_record->inode_number )
-		 && ( inode_number < ( inode_btree_record->inode_number + 64 ) ) )
+		if( read_contexts == NULL )
 		{
-/* TODO check bitmap */
-			result = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read contexts.",
+			 function );
+
+			goto on_error;
 		}
-/* TODO cache records in block */
-		if( libfsxfs_inode_btree_record_free(
-		     &inode_btree_record,
-		     error ) != 1 )
+		if( memory_set(
+		     read_contexts,
+		     0,
+		     sizeof( libfsxfs_inode_btree_read_context_t ) * number_of_threads ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free inode B+ tree record: %" PRIu16 ".",
-			 function,
-			 record_index );
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear read contexts.",
+			 function );
 
 			goto on_error;
 		}
-		if( result != 0 )
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
 		{
-			break;
+			read_contexts[ thread_index ].io_handle                        = io_handle;
+			read_contexts[ thread_index ].inode_information                = inode_information;
+			read_contexts[ thread_index ].number_of_allocation_groups      = number_of_allocation_groups;
+			read_contexts[ thread_index ].first_allocation_group_index     = (uint32_t) thread_index;
+			read_contexts[ thread_index ].allocation_group_index_increment = (uint32_t) number_of_threads;
+
+			if( libbfio_handle_clone(
+			     &( read_contexts[ thread_index ].file_io_handle ),
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to clone file IO handle: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( read_contexts[ thread_index ].thread ),
+			     NULL,
+			     &libfsxfs_inode_btree_read_inode_information_thread_function,
+			     (void *) &( read_contexts[ thread_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 thread_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+		/* Join all threads that were created, also when creating a thread failed
+		 */
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( read_contexts[ thread_index ].thread == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_join(
+			     &( read_contexts[ thread_index ].thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 thread_index );
+
+				result = -1;
+			}
+			else if( ( result == 1 )
+			      && ( read_contexts[ thread_index ].result != 1 ) )
+			{
+				/* The error of the first thread that failed is returned to the caller
+				 */
+				if( error != NULL )
+				{
+					*error = read_contexts[ thread_index ].error;
+
+					read_contexts[ thread_index ].error = NULL;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode information: %" PRIu32 ".",
+				 function,
+				 read_contexts[ thread_index ].failed_allocation_group_index );
+
+				result = -1;
+			}
+		}
+		if( result != 1 )
+		{
+			goto on_error;
 		}
+		for( allocation_group_index = 0;
+		     allocation_group_index < number_of_allocation_groups;
+		     allocation_group_index++ )
+		{
+			if( libcdata_array_append_entry(
+			     inode_btree->inode_information_array,
+			     &entry_index,
+			     (intptr_t *) inode_information[ allocation_group_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append inode information: %" PRIu32 " to array.",
+				 function,
+				 allocation_group_index );
+
+				goto on_error;
+			}
+			inode_information[ allocation_group_index ] = NULL;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libbfio_handle_free(
+			     &( read_contexts[ thread_index ].file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 read_contexts );
+
+		memory_free(
+		 inode_information );
+
+		return( 1 );
 	}
-	return( result );
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
 
-on_error:
-	if( inode_btree_record != NULL )
+	for( allocation_group_index = 0;
+	     allocation_group_index < number_of_allocation_groups;
+	     allocation_group_index++ )
 	{
-		libfsxfs_inode_btree_record_free(
-		 &inode_btree_record,
-		 NULL );
-	}
-	return( -1 );
-}
+		if( libfsxfs_inode_btree_get_inode_information_offset(
+		     inode_btree,
+		     io_handle,
+		     allocation_group_index,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine inode information: %" PRIu32 " offset.",
+			 function,
+			 allocation_group_index );
 
-/* Retrieves the inode from the inode B+ tree node
- * Returns 1 if successful or -1 on error
- */
+			goto on_error;
+		}
+		if( libfsxfs_inode_btree_read_inode_information(
+		     inode_btree,
+		     io_handle,
+		     file_io_handle,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode information: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( read_contexts != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( read_contexts[ thread_index ].file_io_handle != NULL )
+			{
+				libbfio_handle_free(
+				 &( read_contexts[ thread_index ].file_io_handle ),
+				 NULL );
+			}
+			if( read_contexts[ thread_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( read_contexts[ thread_index ].error ) );
+			}
+		}
+		memory_free(
+		 read_contexts );
+	}
+	if( inode_information != NULL )
+	{
+		for( allocation_group_index = 0;
+		     allocation_group_index < number_of_allocation_groups;
+		     allocation_group_index++ )
+		{
+			if( inode_information[ allocation_group_index ] != NULL )
+			{
+				libfsxfs_inode_information_free(
+				 &( inode_information[ allocation_group_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 inode_information );
+	}
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
+	libcdata_array_empty(
+	 inode_btree->inode_information_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_information_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Sets the number of allocation groups
+ * This allows the inode information of an allocation group to be read on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_set_number_of_allocation_groups(
+     libfsxfs_inode_btree_t *inode_btree,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_btree_set_number_of_allocation_groups";
+	int number_of_entries = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_allocation_groups == 0 )
+	 || ( number_of_allocation_groups > (uint32_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of allocation groups value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     inode_btree->inode_information_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of inode information entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode B+ tree - inode information already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_resize(
+	     inode_btree->inode_information_array,
+	     (int) number_of_allocation_groups,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_information_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize inode information array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the inode information of a specific allocation group
+ * The inode information is read on demand if not available
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_get_inode_information(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int allocation_group_index,
+     libfsxfs_inode_information_t **inode_information,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_information_t *safe_inode_information = NULL;
+	static char *function                                = "libfsxfs_inode_btree_get_inode_information";
+	off64_t file_offset                                  = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode information.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     inode_btree->inode_information_array,
+	     allocation_group_index,
+	     (intptr_t **) &safe_inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %d.",
+		 function,
+		 allocation_group_index );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_read(
+		 inode_btree->read_write_lock,
+		 NULL );
+#endif
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( safe_inode_information != NULL )
+	{
+		*inode_information = safe_inode_information;
+
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have read the inode information while the lock was not held
+	 */
+	if( libcdata_array_get_entry_by_index(
+	     inode_btree->inode_information_array,
+	     allocation_group_index,
+	     (intptr_t **) &safe_inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %d.",
+		 function,
+		 allocation_group_index );
+
+		safe_inode_information = NULL;
+
+		goto on_error;
+	}
+	if( safe_inode_information == NULL )
+	{
+		if( libfsxfs_inode_btree_get_inode_information_offset(
+		     inode_btree,
+		     io_handle,
+		     (uint32_t) allocation_group_index,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine inode information: %d offset.",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading inode information: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 allocation_group_index,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		if( libfsxfs_inode_information_initialize(
+		     &safe_inode_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode information.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_inode_information_read_file_io_handle(
+		     safe_inode_information,
+		     io_handle,
+		     file_io_handle,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode information: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 allocation_group_index,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     inode_btree->inode_information_array,
+		     allocation_group_index,
+		     (intptr_t *) safe_inode_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set inode information: %d in array.",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*inode_information = safe_inode_information;
+
+	return( 1 );
+
+on_error:
+	if( safe_inode_information != NULL )
+	{
+		libfsxfs_inode_information_free(
+		 &safe_inode_information,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 inode_btree->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the inode from the inode B+ tree branch node
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsxfs_inode_btree_get_inode_from_branch_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint16_t number_of_records,
+     const uint8_t *records_data,
+     size_t records_data_size,
+     uint64_t relative_inode_number,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	static char *function              = "libfsxfs_inode_btree_get_inode_from_branch_node";
+	size_t number_of_key_value_pairs   = 0;
+	size_t records_data_offset         = 0;
+	uint32_t relative_key_inode_number = 0;
+	uint32_t relative_sub_block_number = 0;
+	uint16_t record_index              = 0;
+	uint16_t record_index_lower        = 0;
+	uint16_t record_index_upper        = 0;
+	int result                         = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( records_data_size == 0 )
+	 || ( records_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid records data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_key_value_pairs = records_data_size / 8;
+
+	if( (size_t) number_of_records > number_of_key_value_pairs )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The keys are stored in ascending order, search for the first key that is
+	 * greater than the relative inode number, the sub node preceding it contains
+	 * the inode
+	 */
+	record_index_upper = number_of_records;
+
+	while( record_index_lower < record_index_upper )
+	{
+		record_index        = record_index_lower + ( ( record_index_upper - record_index_lower ) / 2 );
+		records_data_offset = (size_t) record_index * 4;
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( records_data[ records_data_offset ] ),
+		 relative_key_inode_number );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: inode number\t\t: %" PRIu32 "\n",
+			 function,
+			 relative_key_inode_number );
+		}
+#endif
+		if( relative_inode_number < relative_key_inode_number )
+		{
+			record_index_upper = record_index;
+		}
+		else
+		{
+			record_index_lower = record_index + 1;
+		}
+	}
+	record_index = record_index_lower;
+
+	if( ( record_index > 0 )
+	 && ( record_index <= number_of_records ) )
+	{
+		records_data_offset = ( number_of_key_value_pairs + record_index - 1 ) * 4;
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( records_data[ records_data_offset ] ),
+		 relative_sub_block_number );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: sub block number\t: %" PRIu32 "\n",
+			 function,
+			 relative_sub_block_number );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		result = libfsxfs_inode_btree_get_inode_from_node(
+		          inode_btree,
+		          io_handle,
+		          file_io_handle,
+		          allocation_group_block_number,
+		          relative_sub_block_number,
+		          relative_inode_number,
+		          recursion_depth + 1,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode from node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	else if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the inode from the inode B+ tree leaf node
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsxfs_inode_btree_get_inode_from_leaf_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     uint16_t number_of_records,
+     const uint8_t *records_data,
+     size_t records_data_size,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfsxfs_inode_btree_get_inode_from_leaf_node";
+	size_t records_data_offset   = 0;
+	uint64_t free_inode_bitmap   = 0;
+	uint32_t record_inode_number = 0;
+	uint16_t record_index        = 0;
+	uint16_t record_index_lower  = 0;
+	uint16_t record_index_upper  = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( records_data_size == 0 )
+	 || ( records_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid records data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( records_data_size / sizeof( fsxfs_inode_btree_record_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The records are stored in ascending order of their first inode number,
+	 * search for the first record that starts after the inode number, the record
+	 * preceding it is the only one that can contain the inode
+	 */
+	record_index_upper = number_of_records;
+
+	while( record_index_lower < record_index_upper )
+	{
+		record_index        = record_index_lower + ( ( record_index_upper - record_index_lower ) / 2 );
+		records_data_offset = (size_t) record_index * sizeof( fsxfs_inode_btree_record_t );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_inode_btree_record_t *) &( records_data[ records_data_offset ] ) )->inode_number,
+		 record_inode_number );
+
+		if( inode_number < (uint64_t) record_inode_number )
+		{
+			record_index_upper = record_index;
+		}
+		else
+		{
+			record_index_lower = record_index + 1;
+		}
+	}
+	if( record_index_lower == 0 )
+	{
+		return( 0 );
+	}
+	records_data_offset = (size_t) ( record_index_lower - 1 ) * sizeof( fsxfs_inode_btree_record_t );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_inode_btree_record_t *) &( records_data[ records_data_offset ] ) )->inode_number,
+	 record_inode_number );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_inode_btree_record_t *) &( records_data[ records_data_offset ] ) )->chunk_allocation_bitmap,
+	 free_inode_bitmap );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: record: %" PRIu16 " inode number\t: %" PRIu32 "\n",
+		 function,
+		 record_index_lower - 1,
+		 record_inode_number );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( inode_number >= ( (uint64_t) record_inode_number + 64 ) )
+	{
+		return( 0 );
+	}
+	/* A bit set in the chunk allocation bitmap indicates the inode is free
+	 */
+	if( ( free_inode_bitmap & ( (uint64_t) 1 << ( inode_number - record_inode_number ) ) ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads an inode B+ tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_read_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint64_t relative_block_number,
+     libfsxfs_btree_block_t **btree_block,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsxfs_inode_btree_read_node";
+	off64_t btree_block_offset = 0;
+	int compare_result         = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_block_number > (uint64_t) ( INT64_MAX / io_handle->block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_block_number > ( (uint64_t) ( INT64_MAX / io_handle->block_size ) - allocation_group_block_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid relative block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B+ tree block.",
+		 function );
+
+		return( -1 );
+	}
+	btree_block_offset = ( allocation_group_block_number + relative_block_number ) * io_handle->block_size;
+
+	if( libfsxfs_btree_block_initialize(
+	     btree_block,
+	     io_handle->block_size,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create B+ tree block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_btree_block_read_file_io_handle(
+	     *btree_block,
+	     io_handle,
+	     file_io_handle,
+	     btree_block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode B+ tree block: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 relative_block_number,
+		 btree_block_offset,
+		 btree_block_offset );
+
+		goto on_error;
+	}
+	if( io_handle->format_version == 5 )
+	{
+		compare_result = memory_compare(
+		                  ( *btree_block )->header->signature,
+		                  "IAB3",
+		                  4 );
+	}
+	else
+	{
+		compare_result = memory_compare(
+		                  ( *btree_block )->header->signature,
+		                  "IABT",
+		                  4 );
+	}
+	if( compare_result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block signature.",
+		 function );
+
+		goto on_error;
+	}
+/* TODO
+	if( ( *btree_block )->header->level > inode_btree->maximum_depth )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported B+ tree node level.",
+		 function );
+
+		goto on_error;
+	}
+*/
+	return( 1 );
+
+on_error:
+	if( *btree_block != NULL )
+	{
+		libfsxfs_btree_block_free(
+		 btree_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the inode from the inode B+ tree node
+ * Returns 1 if successful or -1 on error
+ */
 int libfsxfs_inode_btree_get_inode_from_node(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint64_t allocation_group_block_number,
      uint64_t relative_block_number,
-     uint64_t relative_inode_number,
+     uint64_t relative_inode_number,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsxfs_btree_block_t *btree_block = NULL;
+	static char *function               = "libfsxfs_inode_btree_get_inode_from_node";
+	int result                          = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_btree_read_node(
+	     inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     allocation_group_block_number,
+	     relative_block_number,
+	     &btree_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode B+ tree node: %" PRIu64 ".",
+		 function,
+		 relative_block_number );
+
+		goto on_error;
+	}
+	if( btree_block->header->level == 0 )
+	{
+		result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+		          inode_btree,
+		          btree_block->header->number_of_records,
+		          btree_block->records_data,
+		          btree_block->records_data_size,
+		          relative_inode_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode from leaf node.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		result = libfsxfs_inode_btree_get_inode_from_branch_node(
+		          inode_btree,
+		          io_handle,
+		          file_io_handle,
+		          allocation_group_block_number,
+		          btree_block->header->number_of_records,
+		          btree_block->records_data,
+		          btree_block->records_data_size,
+		          relative_inode_number,
+		          recursion_depth,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode from branch node.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsxfs_btree_block_free(
+	     &btree_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free B+ tree block.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( btree_block != NULL )
+	{
+		libfsxfs_btree_block_free(
+		 &btree_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the inode chunks of an inode B+ tree node into the inode chunk index
+ * Returns 1 if successful, 0 if the inode chunk index is incomplete or -1 on error
+ */
+int libfsxfs_inode_btree_read_chunk_index_from_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint64_t relative_block_number,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
      int recursion_depth,
      libcerror_error_t **error )
 {
 	libfsxfs_btree_block_t *btree_block = NULL;
-	static char *function               = "libfsxfs_inode_btree_get_inode_from_node";
-	off64_t btree_block_offset          = 0;
-	int compare_result                  = 0;
-	int result                          = 0;
+	static char *function               = "libfsxfs_inode_btree_read_chunk_index_from_node";
+	size_t number_of_key_value_pairs    = 0;
+	size_t records_data_offset          = 0;
+	uint64_t free_inode_bitmap          = 0;
+	uint32_t record_inode_number        = 0;
+	uint32_t relative_sub_block_number  = 0;
+	uint16_t record_index               = 0;
+	int result                          = 1;
 
 	if( inode_btree == NULL )
 	{
@@ -580,194 +1828,388 @@ int libfsxfs_inode_btree_get_inode_from_node(
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( inode_chunk_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid inode chunk index.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle->block_size == 0 )
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - block size value out of bounds.",
+		 "%s: invalid recursion depth value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( allocation_group_block_number > (uint64_t) ( INT64_MAX / io_handle->block_size ) )
+	if( libfsxfs_inode_btree_read_node(
+	     inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     allocation_group_block_number,
+	     relative_block_number,
+	     &btree_block,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid allocation group block number value out of bounds.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode B+ tree node: %" PRIu64 ".",
+		 function,
+		 relative_block_number );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( relative_block_number > ( (uint64_t) ( INT64_MAX / io_handle->block_size ) - allocation_group_block_number ) )
+	if( btree_block->header->level == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid relative block number value out of bounds.",
-		 function );
+		if( (size_t) btree_block->header->number_of_records > ( btree_block->records_data_size / sizeof( fsxfs_inode_btree_record_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of records value out of bounds.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < btree_block->header->number_of_records;
+		     record_index++ )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 ( (fsxfs_inode_btree_record_t *) &( btree_block->records_data[ records_data_offset ] ) )->inode_number,
+			 record_inode_number );
+
+			byte_stream_copy_to_uint64_big_endian(
+			 ( (fsxfs_inode_btree_record_t *) &( btree_block->records_data[ records_data_offset ] ) )->chunk_allocation_bitmap,
+			 free_inode_bitmap );
+
+			records_data_offset += sizeof( fsxfs_inode_btree_record_t );
+
+			result = libfsxfs_inode_chunk_index_append_chunk(
+			          inode_chunk_index,
+			          record_inode_number,
+			          free_inode_bitmap,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append inode chunk: %" PRIu16 " to index.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
 	}
-	btree_block_offset = ( allocation_group_block_number + relative_block_number ) * io_handle->block_size;
+	else
+	{
+		number_of_key_value_pairs = btree_block->records_data_size / 8;
 
-	if( libfsxfs_btree_block_initialize(
+		if( (size_t) btree_block->header->number_of_records > number_of_key_value_pairs )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of records value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < btree_block->header->number_of_records;
+		     record_index++ )
+		{
+			records_data_offset = ( number_of_key_value_pairs + record_index ) * 4;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( btree_block->records_data[ records_data_offset ] ),
+			 relative_sub_block_number );
+
+			result = libfsxfs_inode_btree_read_chunk_index_from_node(
+			          inode_btree,
+			          io_handle,
+			          file_io_handle,
+			          allocation_group_block_number,
+			          relative_sub_block_number,
+			          inode_chunk_index,
+			          recursion_depth + 1,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode chunk index from node: %" PRIu32 ".",
+				 function,
+				 relative_sub_block_number );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+	}
+	if( libfsxfs_btree_block_free(
 	     &btree_block,
-	     io_handle->block_size,
-	     4,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create B+ tree block.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free B+ tree block.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfsxfs_btree_block_read_file_io_handle(
-	     btree_block,
-	     io_handle,
-	     file_io_handle,
-	     btree_block_offset,
-	     error ) != 1 )
+	return( result );
+
+on_error:
+	if( btree_block != NULL )
+	{
+		libfsxfs_btree_block_free(
+		 &btree_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the inode chunk index of an allocation group
+ * The inode chunk index is read from the inode B+ tree on first use
+ * Returns 1 if successful, 0 if the allocation group has too many inode chunks to index or -1 on error
+ */
+int libfsxfs_inode_btree_get_chunk_index(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     libfsxfs_inode_information_t *inode_information,
+     libfsxfs_inode_chunk_index_t **inode_chunk_index,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_chunk_index_t *cached_inode_chunk_index = NULL;
+	libfsxfs_inode_chunk_index_t *safe_inode_chunk_index   = NULL;
+	static char *function                                  = "libfsxfs_inode_btree_get_chunk_index";
+
+	if( inode_btree == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read inode B+ tree block: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 relative_block_number,
-		 btree_block_offset,
-		 btree_block_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( io_handle->format_version == 5 )
+	if( inode_information == NULL )
 	{
-		compare_result = memory_compare(
-		                  btree_block->header->signature,
-		                  "IAB3",
-		                  4 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode information.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( inode_chunk_index == NULL )
 	{
-		compare_result = memory_compare(
-		                  btree_block->header->signature,
-		                  "IABT",
-		                  4 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
 	}
-	if( compare_result != 0 )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported block signature.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-/* TODO
-	if( btree_block->header->level > inode_btree->maximum_depth )
+#endif
+	cached_inode_chunk_index = inode_information->inode_chunk_index;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported B+ tree node level.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-*/
-	if( btree_block->header->level == 0 )
+#endif
+	if( cached_inode_chunk_index == NULL )
 	{
-		result = libfsxfs_inode_btree_get_inode_from_leaf_node(
-		          inode_btree,
-		          btree_block->header->number_of_records,
-		          btree_block->records_data,
-		          btree_block->records_data_size,
-		          relative_inode_number,
-		          error );
-
-		if( result == -1 )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     inode_btree->read_write_lock,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode from leaf node.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-	else
-	{
-		result = libfsxfs_inode_btree_get_inode_from_branch_node(
-		          inode_btree,
-		          io_handle,
-		          file_io_handle,
-		          allocation_group_block_number,
-		          btree_block->header->number_of_records,
-		          btree_block->records_data,
-		          btree_block->records_data_size,
-		          relative_inode_number,
-		          recursion_depth,
-		          error );
+#endif
+		/* Another thread could have read the inode chunk index while the lock was not held
+		 */
+		if( inode_information->inode_chunk_index == NULL )
+		{
+			if( libfsxfs_inode_chunk_index_initialize(
+			     &safe_inode_chunk_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create inode chunk index.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_inode_btree_read_chunk_index_from_node(
+			     inode_btree,
+			     io_handle,
+			     file_io_handle,
+			     allocation_group_block_number,
+			     inode_information->inode_btree_root_block_number,
+			     safe_inode_chunk_index,
+			     0,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode chunk index from root node: %" PRIu32 ".",
+				 function,
+				 inode_information->inode_btree_root_block_number );
+
+				goto on_error;
+			}
+			/* An incomplete inode chunk index is kept to prevent it from being read again
+			 */
+			if( safe_inode_chunk_index->is_incomplete != 0 )
+			{
+				if( libfsxfs_inode_chunk_index_free(
+				     &safe_inode_chunk_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free inode chunk index.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfsxfs_inode_chunk_index_initialize(
+				     &safe_inode_chunk_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create inode chunk index.",
+					 function );
+
+					goto on_error;
+				}
+				safe_inode_chunk_index->is_incomplete = 1;
+			}
+			inode_information->inode_chunk_index = safe_inode_chunk_index;
+			safe_inode_chunk_index               = NULL;
+		}
+		cached_inode_chunk_index = inode_information->inode_chunk_index;
 
-		if( result == -1 )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     inode_btree->read_write_lock,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode from branch node.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
+#endif
 	}
-	if( libfsxfs_btree_block_free(
-	     &btree_block,
-	     error ) != 1 )
+	/* The inode chunk index is not modified once it has been set
+	 */
+	if( cached_inode_chunk_index->is_incomplete != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free B+ tree block.",
-		 function );
-
-		goto on_error;
+		return( 0 );
 	}
-	return( result );
+	*inode_chunk_index = cached_inode_chunk_index;
+
+	return( 1 );
 
 on_error:
-	if( btree_block != NULL )
+	if( safe_inode_chunk_index != NULL )
 	{
-		libfsxfs_btree_block_free(
-		 &btree_block,
+		libfsxfs_inode_chunk_index_free(
+		 &safe_inode_chunk_index,
 		 NULL );
 	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 inode_btree->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
@@ -782,6 +2224,7 @@ int libfsxfs_inode_btree_get_inode_by_number(
      off64_t *file_offset,
      libcerror_error_t **error )
 {
+	libfsxfs_inode_chunk_index_t *inode_chunk_index = NULL;
 	libfsxfs_inode_information_t *inode_information = NULL;
 	static char *function                           = "libfsxfs_inode_btree_get_inode_by_number";
 	uint64_t allocation_group_block_number          = 0;
@@ -844,6 +2287,17 @@ int libfsxfs_inode_btree_get_inode_by_number(
 
 		return( -1 );
 	}
+	if( ( absolute_inode_number >> io_handle->number_of_relative_inode_number_bits ) > (uint64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	allocation_group_index = (int) ( absolute_inode_number >> io_handle->number_of_relative_inode_number_bits );
 	relative_inode_number  = absolute_inode_number & ( ( (uint64_t) 1 << io_handle->number_of_relative_inode_number_bits ) - 1 );
 
@@ -865,10 +2319,12 @@ int libfsxfs_inode_btree_get_inode_by_number(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( libcdata_array_get_entry_by_index(
-	     inode_btree->inode_information_array,
+	if( libfsxfs_inode_btree_get_inode_information(
+	     inode_btree,
+	     io_handle,
+	     file_io_handle,
 	     allocation_group_index,
-	     (intptr_t **) &inode_information,
+	     &inode_information,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -883,27 +2339,48 @@ int libfsxfs_inode_btree_get_inode_by_number(
 	}
 	allocation_group_block_number = (uint64_t) allocation_group_index * io_handle->allocation_group_size;
 
-	if( inode_information == NULL )
+	result = libfsxfs_inode_btree_get_chunk_index(
+	          inode_btree,
+	          io_handle,
+	          file_io_handle,
+	          allocation_group_block_number,
+	          inode_information,
+	          &inode_chunk_index,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing inode information.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode chunk index: %d.",
+		 function,
+		 allocation_group_index );
 
 		return( -1 );
 	}
-	result = libfsxfs_inode_btree_get_inode_from_node(
-	          inode_btree,
-	          io_handle,
-	          file_io_handle,
-	          allocation_group_block_number,
-	          inode_information->inode_btree_root_block_number,
-	          relative_inode_number,
-	          0,
-	          error );
-
+	else if( result != 0 )
+	{
+		result = libfsxfs_inode_chunk_index_is_allocated(
+		          inode_chunk_index,
+		          relative_inode_number,
+		          error );
+	}
+	else
+	{
+		/* Fall back to the inode B+ tree if the allocation group has too many chunks to index
+		 */
+		result = libfsxfs_inode_btree_get_inode_from_node(
+		          inode_btree,
+		          io_handle,
+		          file_io_handle,
+		          allocation_group_block_number,
+		          inode_information->inode_btree_root_block_number,
+		          relative_inode_number,
+		          0,
+		          error );
+	}
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -25,12 +25,15 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_btree_block.h"
 #include "libfsxfs_inode_btree_record.h"
+#include "libfsxfs_inode_chunk_index.h"
 #include "libfsxfs_inode_information.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -38,11 +41,66 @@ extern "C" {
 
 typedef struct libfsxfs_inode_btree libfsxfs_inode_btree_t;
 
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+
+typedef struct libfsxfs_inode_btree_read_context libfsxfs_inode_btree_read_context_t;
+
+struct libfsxfs_inode_btree_read_context
+{
+	/* The IO handle
+	 */
+	libfsxfs_io_handle_t *io_handle;
+
+	/* The file IO handle, cloned for the thread
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The inode information per allocation group
+	 */
+	libfsxfs_inode_information_t **inode_information;
+
+	/* The number of allocation groups
+	 */
+	uint32_t number_of_allocation_groups;
+
+	/* The index of the first allocation group read by the thread
+	 */
+	uint32_t first_allocation_group_index;
+
+	/* The allocation group index increment
+	 */
+	uint32_t allocation_group_index_increment;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The index of the allocation group that could not be read
+	 */
+	uint32_t failed_allocation_group_index;
+
+	/* The result of the thread
+	 */
+	int result;
+
+	/* The error of the thread
+	 */
+	libcerror_error_t *error;
+};
+
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
 struct libfsxfs_inode_btree
 {
 	/* Inode information array
 	 */
 	libcdata_array_t *inode_information_array;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsxfs_inode_btree_initialize(
@@ -60,6 +118,41 @@ int libfsxfs_inode_btree_read_inode_information(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libfsxfs_inode_btree_get_inode_information_offset(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     uint32_t allocation_group_index,
+     off64_t *file_offset,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+
+int libfsxfs_inode_btree_read_inode_information_thread_function(
+     void *arguments );
+
+#endif
+
+int libfsxfs_inode_btree_read_all_inode_information(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_set_number_of_allocation_groups(
+     libfsxfs_inode_btree_t *inode_btree,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_get_inode_information(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int allocation_group_index,
+     libfsxfs_inode_information_t **inode_information,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_btree_get_inode_from_branch_node(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
@@ -80,6 +173,15 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
      uint64_t relative_inode_number,
      libcerror_error_t **error );
 
+int libfsxfs_inode_btree_read_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint64_t relative_block_number,
+     libfsxfs_btree_block_t **btree_block,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_btree_get_inode_from_node(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
@@ -90,6 +192,25 @@ int libfsxfs_inode_btree_get_inode_from_node(
      int recursion_depth,
      libcerror_error_t **error );
 
+int libfsxfs_inode_btree_read_chunk_index_from_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint64_t relative_block_number,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_get_chunk_index(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     libfsxfs_inode_information_t *inode_information,
+     libfsxfs_inode_chunk_index_t **inode_chunk_index,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_btree_get_inode_by_number(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
@@ -0,0 +1,318 @@
+/*
+ * Inode chunk index functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_inode_chunk_index.h"
+#include "libfsxfs_libcerror.h"
+
+/* Creates an inode chunk index
+ * Make sure the value inode_chunk_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_chunk_index_initialize(
+     libfsxfs_inode_chunk_index_t **inode_chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_chunk_index_initialize";
+
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_chunk_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode chunk index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*inode_chunk_index = memory_allocate_structure(
+	                      libfsxfs_inode_chunk_index_t );
+
+	if( *inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode chunk index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *inode_chunk_index,
+	     0,
+	     sizeof( libfsxfs_inode_chunk_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode chunk index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *inode_chunk_index != NULL )
+	{
+		memory_free(
+		 *inode_chunk_index );
+
+		*inode_chunk_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an inode chunk index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_chunk_index_free(
+     libfsxfs_inode_chunk_index_t **inode_chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_chunk_index_free";
+
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_chunk_index != NULL )
+	{
+		if( ( *inode_chunk_index )->free_inode_bitmaps != NULL )
+		{
+			memory_free(
+			 ( *inode_chunk_index )->free_inode_bitmaps );
+		}
+		if( ( *inode_chunk_index )->inode_numbers != NULL )
+		{
+			memory_free(
+			 ( *inode_chunk_index )->inode_numbers );
+		}
+		memory_free(
+		 *inode_chunk_index );
+
+		*inode_chunk_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a chunk to the inode chunk index
+ * Chunks must be appended in ascending order of their first inode number
+ * Returns 1 if successful, 0 if the maximum number of chunks was reached or -1 on error
+ */
+int libfsxfs_inode_chunk_index_append_chunk(
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     uint32_t inode_number,
+     uint64_t free_inode_bitmap,
+     libcerror_error_t **error )
+{
+	uint64_t *reallocation_free_inode_bitmaps = NULL;
+	uint32_t *reallocation_inode_numbers      = NULL;
+	static char *function                     = "libfsxfs_inode_chunk_index_append_chunk";
+	int number_of_allocated_chunks            = 0;
+
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_chunk_index->number_of_chunks > 0 )
+	{
+		if( inode_number <= inode_chunk_index->inode_numbers[ inode_chunk_index->number_of_chunks - 1 ] )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid inode number: %" PRIu32 " value out of order.",
+			 function,
+			 inode_number );
+
+			return( -1 );
+		}
+	}
+	if( inode_chunk_index->number_of_chunks >= LIBFSXFS_MAXIMUM_NUMBER_OF_INDEXED_INODE_CHUNKS )
+	{
+		inode_chunk_index->is_incomplete = 1;
+
+		return( 0 );
+	}
+	if( inode_chunk_index->number_of_chunks >= inode_chunk_index->number_of_allocated_chunks )
+	{
+		if( inode_chunk_index->number_of_allocated_chunks == 0 )
+		{
+			number_of_allocated_chunks = 64;
+		}
+		else
+		{
+			number_of_allocated_chunks = inode_chunk_index->number_of_allocated_chunks * 2;
+		}
+		if( number_of_allocated_chunks > LIBFSXFS_MAXIMUM_NUMBER_OF_INDEXED_INODE_CHUNKS )
+		{
+			number_of_allocated_chunks = LIBFSXFS_MAXIMUM_NUMBER_OF_INDEXED_INODE_CHUNKS;
+		}
+		reallocation_inode_numbers = (uint32_t *) memory_reallocate(
+		                                           inode_chunk_index->inode_numbers,
+		                                           sizeof( uint32_t ) * number_of_allocated_chunks );
+
+		if( reallocation_inode_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize inode numbers.",
+			 function );
+
+			return( -1 );
+		}
+		inode_chunk_index->inode_numbers = reallocation_inode_numbers;
+
+		reallocation_free_inode_bitmaps = (uint64_t *) memory_reallocate(
+		                                                inode_chunk_index->free_inode_bitmaps,
+		                                                sizeof( uint64_t ) * number_of_allocated_chunks );
+
+		if( reallocation_free_inode_bitmaps == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize free inode bitmaps.",
+			 function );
+
+			return( -1 );
+		}
+		inode_chunk_index->free_inode_bitmaps         = reallocation_free_inode_bitmaps;
+		inode_chunk_index->number_of_allocated_chunks = number_of_allocated_chunks;
+	}
+	inode_chunk_index->inode_numbers[ inode_chunk_index->number_of_chunks ]      = inode_number;
+	inode_chunk_index->free_inode_bitmaps[ inode_chunk_index->number_of_chunks ] = free_inode_bitmap;
+
+	inode_chunk_index->number_of_chunks += 1;
+
+	return( 1 );
+}
+
+/* Determines if a specific inode is allocated according to the inode chunk index
+ * Returns 1 if allocated, 0 if not or -1 on error
+ */
+int libfsxfs_inode_chunk_index_is_allocated(
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     uint64_t relative_inode_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_chunk_index_is_allocated";
+	uint64_t inode_index  = 0;
+	int chunk_index       = 0;
+	int chunk_index_lower = 0;
+	int chunk_index_upper = 0;
+
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_chunk_index->is_incomplete != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode chunk index - index is incomplete.",
+		 function );
+
+		return( -1 );
+	}
+	/* Search for the first chunk that starts after the inode number,
+	 * the chunk preceding it is the only one that can contain the inode
+	 */
+	chunk_index_upper = inode_chunk_index->number_of_chunks;
+
+	while( chunk_index_lower < chunk_index_upper )
+	{
+		chunk_index = chunk_index_lower + ( ( chunk_index_upper - chunk_index_lower ) / 2 );
+
+		if( relative_inode_number < (uint64_t) inode_chunk_index->inode_numbers[ chunk_index ] )
+		{
+			chunk_index_upper = chunk_index;
+		}
+		else
+		{
+			chunk_index_lower = chunk_index + 1;
+		}
+	}
+	if( chunk_index_lower == 0 )
+	{
+		return( 0 );
+	}
+	chunk_index = chunk_index_lower - 1;
+	inode_index = relative_inode_number - inode_chunk_index->inode_numbers[ chunk_index ];
+
+	if( inode_index >= 64 )
+	{
+		return( 0 );
+	}
+	if( ( inode_chunk_index->free_inode_bitmaps[ chunk_index ] & ( (uint64_t) 1 << inode_index ) ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
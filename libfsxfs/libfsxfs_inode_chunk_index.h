@@ -0,0 +1,84 @@
+/*
+ * Inode chunk index functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_INODE_CHUNK_INDEX_H )
+#define _LIBFSXFS_INODE_CHUNK_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_inode_chunk_index libfsxfs_inode_chunk_index_t;
+
+struct libfsxfs_inode_chunk_index
+{
+	/* The relative inode number of the first inode of each chunk
+	 * stored in ascending order
+	 */
+	uint32_t *inode_numbers;
+
+	/* The free inode bitmap of each chunk
+	 */
+	uint64_t *free_inode_bitmaps;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The number of allocated chunks
+	 */
+	int number_of_allocated_chunks;
+
+	/* Value to indicate the index is incomplete and should not be used
+	 */
+	uint8_t is_incomplete;
+};
+
+int libfsxfs_inode_chunk_index_initialize(
+     libfsxfs_inode_chunk_index_t **inode_chunk_index,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_chunk_index_free(
+     libfsxfs_inode_chunk_index_t **inode_chunk_index,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_chunk_index_append_chunk(
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     uint32_t inode_number,
+     uint64_t free_inode_bitmap,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_chunk_index_is_allocated(
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     uint64_t relative_inode_number,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_INODE_CHUNK_INDEX_H ) */
+
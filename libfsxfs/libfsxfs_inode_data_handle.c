@@ -0,0 +1,505 @@
+/*
+ * Inode data handle functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_inode_data_handle.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libfdata.h"
+#include "libfsxfs_unused.h"
+
+/* Creates an inode data handle
+ * Make sure the value data_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_data_handle_initialize(
+     libfsxfs_inode_data_handle_t **data_handle,
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_data_handle_initialize";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	*data_handle = memory_allocate_structure(
+	                libfsxfs_inode_data_handle_t );
+
+	if( *data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_handle,
+	     0,
+	     sizeof( libfsxfs_inode_data_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *data_handle )->io_handle              = io_handle;
+	( *data_handle )->inode                  = inode;
+	( *data_handle )->data_size              = data_size;
+	( *data_handle )->maximum_readahead_size = io_handle->maximum_readahead_size;
+
+	return( 1 );
+
+on_error:
+	if( *data_handle != NULL )
+	{
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an inode data handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_data_handle_free(
+     libfsxfs_inode_data_handle_t **data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_data_handle_free";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		if( ( *data_handle )->readahead_buffer != NULL )
+		{
+			memory_free(
+			 ( *data_handle )->readahead_buffer );
+		}
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Fills the readahead buffer with the data at the current offset
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_data_handle_fill_readahead_buffer(
+     libfsxfs_inode_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "libfsxfs_inode_data_handle_fill_readahead_buffer";
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_handle->maximum_readahead_size == 0 )
+	 || ( data_handle->maximum_readahead_size > (size_t) LIBFSXFS_MAXIMUM_READAHEAD_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data handle - maximum readahead size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_handle->readahead_buffer_offset    = data_handle->current_offset;
+	data_handle->readahead_buffer_data_size = 0;
+
+	if( (size64_t) data_handle->current_offset >= data_handle->data_size )
+	{
+		return( 1 );
+	}
+	read_size = data_handle->readahead_size;
+
+	if( (size64_t) read_size > ( data_handle->data_size - (size64_t) data_handle->current_offset ) )
+	{
+		read_size = (size_t) ( data_handle->data_size - (size64_t) data_handle->current_offset );
+	}
+	if( read_size > data_handle->maximum_readahead_size )
+	{
+		read_size = data_handle->maximum_readahead_size;
+	}
+	/* The readahead buffer grows with the readahead window up to the size of the remaining data
+	 */
+	if( read_size > data_handle->readahead_buffer_size )
+	{
+		reallocation = memory_reallocate(
+		                data_handle->readahead_buffer,
+		                sizeof( uint8_t ) * read_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize readahead buffer.",
+			 function );
+
+			return( -1 );
+		}
+		data_handle->readahead_buffer      = (uint8_t *) reallocation;
+		data_handle->readahead_buffer_size = read_size;
+	}
+	read_count = libfsxfs_inode_read_data_buffer_at_offset(
+	              data_handle->inode,
+	              data_handle->io_handle,
+	              file_io_handle,
+	              data_handle->readahead_buffer,
+	              read_size,
+	              data_handle->current_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read readahead data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 data_handle->current_offset,
+		 data_handle->current_offset );
+
+		return( -1 );
+	}
+	data_handle->readahead_buffer_data_size = (size_t) read_count;
+
+	return( 1 );
+}
+
+/* Reads data from the current offset into a buffer
+ * Callback for the inode data stream
+ * The current offset is a logical offset that is mapped onto the data extents of the inode
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_inode_data_handle_read_segment_data(
+         libfsxfs_inode_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index LIBFSXFS_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBFSXFS_ATTRIBUTE_UNUSED,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags LIBFSXFS_ATTRIBUTE_UNUSED,
+         uint8_t read_flags LIBFSXFS_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function          = "libfsxfs_inode_data_handle_read_segment_data";
+	size_t readahead_buffer_offset = 0;
+	size_t read_size               = 0;
+	size_t segment_data_offset     = 0;
+	ssize_t read_count             = 0;
+
+	LIBFSXFS_UNREFERENCED_PARAMETER( segment_index )
+	LIBFSXFS_UNREFERENCED_PARAMETER( segment_file_index )
+	LIBFSXFS_UNREFERENCED_PARAMETER( segment_flags )
+	LIBFSXFS_UNREFERENCED_PARAMETER( read_flags )
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) data_handle->current_offset >= data_handle->data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) segment_data_size > ( data_handle->data_size - (size64_t) data_handle->current_offset ) )
+	{
+		segment_data_size = (size_t) ( data_handle->data_size - (size64_t) data_handle->current_offset );
+	}
+	/* A read that does not continue where the previous read ended disables readahead
+	 * until the access is sequential again
+	 */
+	if( data_handle->current_offset != data_handle->sequential_offset )
+	{
+		data_handle->readahead_size = 0;
+	}
+	while( segment_data_offset < segment_data_size )
+	{
+		read_size = segment_data_size - segment_data_offset;
+
+		if( ( data_handle->readahead_buffer_data_size > 0 )
+		 && ( data_handle->current_offset >= data_handle->readahead_buffer_offset )
+		 && ( (size64_t) ( data_handle->current_offset - data_handle->readahead_buffer_offset ) < (size64_t) data_handle->readahead_buffer_data_size ) )
+		{
+			readahead_buffer_offset = (size_t) ( data_handle->current_offset - data_handle->readahead_buffer_offset );
+
+			if( read_size > ( data_handle->readahead_buffer_data_size - readahead_buffer_offset ) )
+			{
+				read_size = data_handle->readahead_buffer_data_size - readahead_buffer_offset;
+			}
+			if( memory_copy(
+			     &( segment_data[ segment_data_offset ] ),
+			     &( data_handle->readahead_buffer[ readahead_buffer_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy readahead data.",
+				 function );
+
+				return( -1 );
+			}
+			read_count = (ssize_t) read_size;
+		}
+		else if( ( data_handle->maximum_readahead_size > 0 )
+		      && ( data_handle->current_offset == data_handle->sequential_offset )
+		      && ( read_size < data_handle->maximum_readahead_size ) )
+		{
+			/* Grow the readahead window on every refill while the access remains sequential
+			 */
+			if( data_handle->readahead_size == 0 )
+			{
+				data_handle->readahead_size = LIBFSXFS_INITIAL_READAHEAD_SIZE;
+			}
+			else if( data_handle->readahead_size <= ( data_handle->maximum_readahead_size / 2 ) )
+			{
+				data_handle->readahead_size *= 2;
+			}
+			else
+			{
+				data_handle->readahead_size = data_handle->maximum_readahead_size;
+			}
+			if( data_handle->readahead_size > data_handle->maximum_readahead_size )
+			{
+				data_handle->readahead_size = data_handle->maximum_readahead_size;
+			}
+			if( libfsxfs_inode_data_handle_fill_readahead_buffer(
+			     data_handle,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to fill readahead buffer.",
+				 function );
+
+				return( -1 );
+			}
+			if( data_handle->readahead_buffer_data_size == 0 )
+			{
+				break;
+			}
+			continue;
+		}
+		else
+		{
+			read_count = libfsxfs_inode_read_data_buffer_at_offset(
+			              data_handle->inode,
+			              data_handle->io_handle,
+			              file_io_handle,
+			              &( segment_data[ segment_data_offset ] ),
+			              read_size,
+			              data_handle->current_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read segment data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 data_handle->current_offset,
+				 data_handle->current_offset );
+
+				return( -1 );
+			}
+			if( read_count == 0 )
+			{
+				break;
+			}
+		}
+		segment_data_offset         += (size_t) read_count;
+		data_handle->current_offset += (off64_t) read_count;
+
+		data_handle->sequential_offset = data_handle->current_offset;
+	}
+
+	return( (ssize_t) segment_data_offset );
+}
+
+/* Seeks a certain offset of the data
+ * Callback for the inode data stream
+ * Only the offset of the data handle is set, the file IO handle is not changed
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfsxfs_inode_data_handle_seek_segment_offset(
+         libfsxfs_inode_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle LIBFSXFS_ATTRIBUTE_UNUSED,
+         int segment_index LIBFSXFS_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBFSXFS_ATTRIBUTE_UNUSED,
+         off64_t segment_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_data_handle_seek_segment_offset";
+
+	LIBFSXFS_UNREFERENCED_PARAMETER( file_io_handle )
+	LIBFSXFS_UNREFERENCED_PARAMETER( segment_index )
+	LIBFSXFS_UNREFERENCED_PARAMETER( segment_file_index )
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_handle->current_offset = segment_offset;
+
+	return( segment_offset );
+}
+
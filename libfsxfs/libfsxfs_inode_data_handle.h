@@ -0,0 +1,127 @@
+/*
+ * Inode data handle functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_INODE_DATA_HANDLE_H )
+#define _LIBFSXFS_INODE_DATA_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_inode_data_handle libfsxfs_inode_data_handle_t;
+
+struct libfsxfs_inode_data_handle
+{
+	/* The IO handle
+	 */
+	libfsxfs_io_handle_t *io_handle;
+
+	/* The inode
+	 */
+	libfsxfs_inode_t *inode;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The offset at which a read is considered sequential
+	 */
+	off64_t sequential_offset;
+
+	/* The maximum readahead size, 0 if readahead is disabled
+	 */
+	size_t maximum_readahead_size;
+
+	/* The readahead window size
+	 */
+	size_t readahead_size;
+
+	/* The readahead buffer
+	 */
+	uint8_t *readahead_buffer;
+
+	/* The allocated size of the readahead buffer
+	 */
+	size_t readahead_buffer_size;
+
+	/* The offset of the data in the readahead buffer
+	 */
+	off64_t readahead_buffer_offset;
+
+	/* The size of the data in the readahead buffer
+	 */
+	size_t readahead_buffer_data_size;
+};
+
+int libfsxfs_inode_data_handle_initialize(
+     libfsxfs_inode_data_handle_t **data_handle,
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_data_handle_free(
+     libfsxfs_inode_data_handle_t **data_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_data_handle_fill_readahead_buffer(
+     libfsxfs_inode_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_inode_data_handle_read_segment_data(
+         libfsxfs_inode_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags,
+         uint8_t read_flags,
+         libcerror_error_t **error );
+
+off64_t libfsxfs_inode_data_handle_seek_segment_offset(
+         libfsxfs_inode_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         off64_t segment_offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_INODE_DATA_HANDLE_H ) */
+
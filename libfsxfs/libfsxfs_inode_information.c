@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "libfsxfs_debug.h"
+#include "libfsxfs_inode_chunk_index.h"
 #include "libfsxfs_inode_information.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
@@ -115,6 +116,7 @@ int libfsxfs_inode_information_free(
      libcerror_error_t **error )
 {
 	static char *function = "libfsxfs_inode_information_free";
+	int result            = 1;
 
 	if( inode_information == NULL )
 	{
@@ -129,12 +131,28 @@ int libfsxfs_inode_information_free(
 	}
 	if( *inode_information != NULL )
 	{
+		if( ( *inode_information )->inode_chunk_index != NULL )
+		{
+			if( libfsxfs_inode_chunk_index_free(
+			     &( ( *inode_information )->inode_chunk_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free inode chunk index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *inode_information );
 
 		*inode_information = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Reads the inode information data
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_inode_chunk_index.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
@@ -48,6 +49,11 @@ struct libfsxfs_inode_information
 	/* Last allocated chunk
 	 */
 	uint32_t last_allocated_chunk;
+
+	/* The inode chunk index
+	 * NULL if not yet read from the inode B+ tree
+	 */
+	libfsxfs_inode_chunk_index_t *inode_chunk_index;
 };
 
 int libfsxfs_inode_information_initialize(
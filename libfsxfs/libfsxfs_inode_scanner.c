@@ -0,0 +1,1136 @@
+/*
+ * Parallel inode scanner functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_inode_chunk_index.h"
+#include "libfsxfs_inode_scanner.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+/* Creates an inode scanner
+ * Make sure the value inode_scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_initialize(
+     libfsxfs_inode_scanner_t **inode_scanner,
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     int (*callback_function)(
+            uint64_t inode_number,
+            libfsxfs_inode_t *inode,
+            libbfio_handle_t *file_io_handle,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_scanner_initialize";
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	*inode_scanner = memory_allocate_structure(
+	                  libfsxfs_inode_scanner_t );
+
+	if( *inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *inode_scanner,
+	     0,
+	     sizeof( libfsxfs_inode_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode scanner.",
+		 function );
+
+		memory_free(
+		 *inode_scanner );
+
+		*inode_scanner = NULL;
+
+		return( -1 );
+	}
+	( *inode_scanner )->file_system       = file_system;
+	( *inode_scanner )->io_handle         = io_handle;
+	( *inode_scanner )->callback_function = callback_function;
+	( *inode_scanner )->callback_data     = callback_data;
+	( *inode_scanner )->result            = 1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *inode_scanner )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *inode_scanner )->task_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create task condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *inode_scanner != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( ( *inode_scanner )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *inode_scanner )->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *inode_scanner );
+
+		*inode_scanner = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an inode scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_free(
+     libfsxfs_inode_scanner_t **inode_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_scanner_free";
+	int result            = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_scanner != NULL )
+	{
+		/* The file system, IO handle and callback data are not managed by the inode scanner
+		 */
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *inode_scanner )->task_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free task condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *inode_scanner )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *inode_scanner )->tasks != NULL )
+		{
+			memory_free(
+			 ( *inode_scanner )->tasks );
+		}
+		memory_free(
+		 *inode_scanner );
+
+		*inode_scanner = NULL;
+	}
+	return( result );
+}
+
+/* Pushes a task onto the pending tasks
+ * A task without an inode chunk index covers the entire allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_push_task(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     int first_chunk_index,
+     int number_of_chunks,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_scan_task_t *reallocation = NULL;
+	static char *function                    = "libfsxfs_inode_scanner_push_task";
+	size_t tasks_size                        = 0;
+	int number_of_allocated_tasks            = 0;
+	int result                               = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_chunk_index < 0 )
+	 || ( number_of_chunks < 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode chunk range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     inode_scanner->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( inode_scanner->number_of_tasks >= inode_scanner->number_of_allocated_tasks )
+	{
+		if( inode_scanner->number_of_allocated_tasks == 0 )
+		{
+			number_of_allocated_tasks = 64;
+		}
+		else if( inode_scanner->number_of_allocated_tasks <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_tasks = inode_scanner->number_of_allocated_tasks * 2;
+		}
+		tasks_size = sizeof( libfsxfs_inode_scan_task_t ) * number_of_allocated_tasks;
+
+		if( ( number_of_allocated_tasks == 0 )
+		 || ( tasks_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of tasks value exceeds maximum.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			reallocation = (libfsxfs_inode_scan_task_t *) memory_reallocate(
+			                                               inode_scanner->tasks,
+			                                               tasks_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize tasks.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				inode_scanner->tasks                     = reallocation;
+				inode_scanner->number_of_allocated_tasks = number_of_allocated_tasks;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		inode_scanner->tasks[ inode_scanner->number_of_tasks ].allocation_group_index = allocation_group_index;
+		inode_scanner->tasks[ inode_scanner->number_of_tasks ].inode_chunk_index      = inode_chunk_index;
+		inode_scanner->tasks[ inode_scanner->number_of_tasks ].first_chunk_index      = first_chunk_index;
+		inode_scanner->tasks[ inode_scanner->number_of_tasks ].number_of_chunks       = number_of_chunks;
+
+		inode_scanner->number_of_tasks += 1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( result == 1 )
+	{
+		if( libcthreads_condition_broadcast(
+		     inode_scanner->task_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast task condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     inode_scanner->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Pops a task from the pending tasks
+ * The most recently pushed task is popped first, so that the inode chunk ranges
+ * of a split allocation group are taken by idle threads while the thread that split it continues
+ * If multi-threading is supported this function waits while there are no pending tasks
+ * but other tasks are still being processed, since these can push new tasks
+ * Returns 1 if successful, 0 if there are no more tasks or -1 on error
+ */
+int libfsxfs_inode_scanner_pop_task(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     libfsxfs_inode_scan_task_t *task,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_scanner_pop_task";
+	int result            = 0;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     inode_scanner->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( inode_scanner->result == 1 )
+	    && ( inode_scanner->number_of_tasks == 0 )
+	    && ( inode_scanner->number_of_busy_tasks > 0 ) )
+	{
+		if( libcthreads_condition_wait(
+		     inode_scanner->task_condition,
+		     inode_scanner->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for task condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 inode_scanner->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( ( inode_scanner->result == 1 )
+	 && ( inode_scanner->number_of_tasks > 0 ) )
+	{
+		inode_scanner->number_of_tasks -= 1;
+
+		*task = inode_scanner->tasks[ inode_scanner->number_of_tasks ];
+
+		inode_scanner->number_of_busy_tasks += 1;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     inode_scanner->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Marks a popped task as completed
+ * The first task that stops or fails the scan determines the result of the scan
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_complete_task(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     libfsxfs_inode_scan_task_t *task,
+     int task_result,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_scanner_complete_task";
+	int result            = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     inode_scanner->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	inode_scanner->number_of_busy_tasks -= 1;
+
+	if( ( inode_scanner->result == 1 )
+	 && ( task_result != 1 ) )
+	{
+		inode_scanner->result = task_result;
+
+		if( task_result == -1 )
+		{
+			inode_scanner->failed_allocation_group_index = task->allocation_group_index;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* Wake the waiting threads so that they can stop when the last task completed
+	 * or when the scan was stopped
+	 */
+	if( libcthreads_condition_broadcast(
+	     inode_scanner->task_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast task condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     inode_scanner->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Runs a task
+ * A task that covers an allocation group with more than LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_CHUNKS_PER_SCAN_TASK
+ * inode chunks scans the first range of inode chunks and pushes the remaining ranges as new tasks
+ * Returns 1 if all inodes of the task were scanned, 0 if the scan was stopped or -1 on error
+ */
+int libfsxfs_inode_scanner_run_task(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_scan_task_t *task,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_chunk_index_t *inode_chunk_index = NULL;
+	static char *function                           = "libfsxfs_inode_scanner_run_task";
+	int first_chunk_index                           = 0;
+	int number_of_chunks                            = 0;
+	int split_chunk_index                           = 0;
+	int split_number_of_chunks                      = 0;
+	int result                                      = 0;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	inode_chunk_index = task->inode_chunk_index;
+	first_chunk_index = task->first_chunk_index;
+	number_of_chunks  = task->number_of_chunks;
+
+	if( inode_chunk_index == NULL )
+	{
+		if( libfsxfs_file_system_get_inode_chunk_index(
+		     inode_scanner->file_system,
+		     inode_scanner->io_handle,
+		     file_io_handle,
+		     task->allocation_group_index,
+		     &inode_chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode chunk index: %" PRIu32 ".",
+			 function,
+			 task->allocation_group_index );
+
+			return( -1 );
+		}
+		first_chunk_index = 0;
+		number_of_chunks  = inode_chunk_index->number_of_chunks;
+
+		if( number_of_chunks > LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_CHUNKS_PER_SCAN_TASK )
+		{
+			/* The ranges are pushed in descending order so that they are popped in ascending order
+			 */
+			split_chunk_index = ( ( number_of_chunks - 1 ) / LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_CHUNKS_PER_SCAN_TASK )
+			                  * LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_CHUNKS_PER_SCAN_TASK;
+
+			while( split_chunk_index > 0 )
+			{
+				split_number_of_chunks = number_of_chunks - split_chunk_index;
+
+				if( split_number_of_chunks > LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_CHUNKS_PER_SCAN_TASK )
+				{
+					split_number_of_chunks = LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_CHUNKS_PER_SCAN_TASK;
+				}
+				if( libfsxfs_inode_scanner_push_task(
+				     inode_scanner,
+				     task->allocation_group_index,
+				     inode_chunk_index,
+				     split_chunk_index,
+				     split_number_of_chunks,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push task for inode chunks: %d - %d of allocation group: %" PRIu32 ".",
+					 function,
+					 split_chunk_index,
+					 split_chunk_index + split_number_of_chunks - 1,
+					 task->allocation_group_index );
+
+					return( -1 );
+				}
+				split_chunk_index -= LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_CHUNKS_PER_SCAN_TASK;
+			}
+			number_of_chunks = LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_CHUNKS_PER_SCAN_TASK;
+		}
+	}
+	result = libfsxfs_file_system_iterate_inodes_in_inode_chunks(
+	          inode_scanner->file_system,
+	          inode_scanner->io_handle,
+	          file_io_handle,
+	          task->allocation_group_index,
+	          inode_chunk_index,
+	          first_chunk_index,
+	          number_of_chunks,
+	          inode_scanner->callback_function,
+	          inode_scanner->callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to iterate inodes in inode chunks: %d - %d of allocation group: %" PRIu32 ".",
+		 function,
+		 first_chunk_index,
+		 first_chunk_index + number_of_chunks - 1,
+		 task->allocation_group_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Processes pending tasks until there are no more tasks or the scan was stopped
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_process_tasks(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_scan_task_t task;
+
+	static char *function = "libfsxfs_inode_scanner_process_tasks";
+	int result            = 0;
+
+	do
+	{
+		result = libfsxfs_inode_scanner_pop_task(
+		          inode_scanner,
+		          &task,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop task.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		result = libfsxfs_inode_scanner_run_task(
+		          inode_scanner,
+		          file_io_handle,
+		          &task,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run task of allocation group: %" PRIu32 ".",
+			 function,
+			 task.allocation_group_index );
+		}
+		if( libfsxfs_inode_scanner_complete_task(
+		     inode_scanner,
+		     &task,
+		     result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to complete task of allocation group: %" PRIu32 ".",
+			 function,
+			 task.allocation_group_index );
+
+			return( -1 );
+		}
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+	}
+	while( result == 1 );
+
+	return( 1 );
+}
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+
+/* Processes the pending tasks of the inode scanner using the file IO handle of the thread
+ * Returns 1 to the thread, the result is stored in the inode scanner and the error in the thread context
+ */
+int libfsxfs_inode_scanner_thread_function(
+     void *arguments )
+{
+	libfsxfs_inode_scanner_thread_context_t *thread_context = NULL;
+
+	if( arguments == NULL )
+	{
+		return( 1 );
+	}
+	thread_context = (libfsxfs_inode_scanner_thread_context_t *) arguments;
+
+	libfsxfs_inode_scanner_process_tasks(
+	 thread_context->inode_scanner,
+	 thread_context->file_io_handle,
+	 &( thread_context->error ) );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
+/* Scans the allocated inodes of all allocation groups
+ * Every allocation group is scanned as an independent task. If multi-threading is supported
+ * the tasks are processed by number_of_threads threads, each with its own file IO handle,
+ * otherwise or if number_of_threads is 0 or 1 the tasks are processed sequentially
+ * The callback function can be called by multiple threads concurrently
+ * Returns 1 if all inodes were scanned, 0 if the scan was stopped or -1 on error
+ */
+int libfsxfs_inode_scanner_scan(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libfsxfs_inode_scanner_thread_context_t *thread_contexts = NULL;
+	int thread_index                                         = 0;
+#endif
+	static char *function                                    = "libfsxfs_inode_scanner_scan";
+	uint32_t allocation_group_index                          = 0;
+	int result                                               = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBFSXFS_MAXIMUM_NUMBER_OF_READ_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The allocation groups are pushed in descending order so that they are popped in ascending order
+	 */
+	allocation_group_index = number_of_allocation_groups;
+
+	while( allocation_group_index > 0 )
+	{
+		allocation_group_index--;
+
+		if( libfsxfs_inode_scanner_push_task(
+		     inode_scanner,
+		     allocation_group_index,
+		     NULL,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push task for allocation group: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		thread_contexts = (libfsxfs_inode_scanner_thread_context_t *) memory_allocate(
+		                                                               sizeof( libfsxfs_inode_scanner_thread_context_t ) * number_of_threads );
+
+		if( thread_contexts == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create thread contexts.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     thread_contexts,
+		     0,
+		     sizeof( libfsxfs_inode_scanner_thread_context_t ) * number_of_threads ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear thread contexts.",
+			 function );
+
+			goto on_error;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			thread_contexts[ thread_index ].inode_scanner = inode_scanner;
+
+			if( libbfio_handle_clone(
+			     &( thread_contexts[ thread_index ].file_io_handle ),
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to clone file IO handle: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( thread_contexts[ thread_index ].thread ),
+			     NULL,
+			     &libfsxfs_inode_scanner_thread_function,
+			     (void *) &( thread_contexts[ thread_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 thread_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+		/* Join all threads that were created, also when creating a thread failed
+		 */
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( thread_contexts[ thread_index ].thread == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_join(
+			     &( thread_contexts[ thread_index ].thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 thread_index );
+
+				result = -1;
+			}
+			if( thread_contexts[ thread_index ].error != NULL )
+			{
+				/* The error of the first thread that failed is returned to the caller
+				 */
+				if( ( result == 1 )
+				 && ( error != NULL ) )
+				{
+					*error = thread_contexts[ thread_index ].error;
+
+					thread_contexts[ thread_index ].error = NULL;
+
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to process tasks in thread: %d.",
+					 function,
+					 thread_index );
+				}
+				else
+				{
+					libcerror_error_free(
+					 &( thread_contexts[ thread_index ].error ) );
+				}
+				result = -1;
+			}
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libbfio_handle_free(
+			     &( thread_contexts[ thread_index ].file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 thread_contexts );
+
+		thread_contexts = NULL;
+
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	else
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+	if( libfsxfs_inode_scanner_process_tasks(
+	     inode_scanner,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process tasks.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_scanner->result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan inodes in allocation group: %" PRIu32 ".",
+		 function,
+		 inode_scanner->failed_allocation_group_index );
+
+		return( -1 );
+	}
+	return( inode_scanner->result );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_contexts != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( thread_contexts[ thread_index ].file_io_handle != NULL )
+			{
+				libbfio_handle_free(
+				 &( thread_contexts[ thread_index ].file_io_handle ),
+				 NULL );
+			}
+			if( thread_contexts[ thread_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( thread_contexts[ thread_index ].error ) );
+			}
+		}
+		memory_free(
+		 thread_contexts );
+	}
+	return( -1 );
+#endif
+}
+
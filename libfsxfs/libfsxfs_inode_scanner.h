@@ -0,0 +1,212 @@
+/*
+ * Parallel inode scanner functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_INODE_SCANNER_H )
+#define _LIBFSXFS_INODE_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_inode_chunk_index.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_inode_scan_task libfsxfs_inode_scan_task_t;
+
+struct libfsxfs_inode_scan_task
+{
+	/* The allocation group index
+	 */
+	uint32_t allocation_group_index;
+
+	/* The inode chunk index, NULL if the task covers the entire allocation group
+	 */
+	libfsxfs_inode_chunk_index_t *inode_chunk_index;
+
+	/* The index of the first inode chunk
+	 */
+	int first_chunk_index;
+
+	/* The number of inode chunks
+	 */
+	int number_of_chunks;
+};
+
+typedef struct libfsxfs_inode_scanner libfsxfs_inode_scanner_t;
+
+struct libfsxfs_inode_scanner
+{
+	/* The file system
+	 */
+	libfsxfs_file_system_t *file_system;
+
+	/* The IO handle
+	 */
+	libfsxfs_io_handle_t *io_handle;
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       uint64_t inode_number,
+	       libfsxfs_inode_t *inode,
+	       libbfio_handle_t *file_io_handle,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The callback data
+	 */
+	void *callback_data;
+
+	/* The pending tasks
+	 */
+	libfsxfs_inode_scan_task_t *tasks;
+
+	/* The number of pending tasks
+	 */
+	int number_of_tasks;
+
+	/* The number of allocated tasks
+	 */
+	int number_of_allocated_tasks;
+
+	/* The number of tasks that are being processed
+	 */
+	int number_of_busy_tasks;
+
+	/* The result of the scan, 1 if all inodes were scanned, 0 if the scan was stopped or -1 on error
+	 */
+	int result;
+
+	/* The index of the allocation group that could not be scanned
+	 */
+	uint32_t failed_allocation_group_index;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the tasks and the result
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a task is pushed or completed
+	 */
+	libcthreads_condition_t *task_condition;
+#endif
+};
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+
+typedef struct libfsxfs_inode_scanner_thread_context libfsxfs_inode_scanner_thread_context_t;
+
+struct libfsxfs_inode_scanner_thread_context
+{
+	/* The inode scanner
+	 */
+	libfsxfs_inode_scanner_t *inode_scanner;
+
+	/* The file IO handle, cloned for the thread
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The error of the thread
+	 */
+	libcerror_error_t *error;
+};
+
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
+int libfsxfs_inode_scanner_initialize(
+     libfsxfs_inode_scanner_t **inode_scanner,
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     int (*callback_function)(
+            uint64_t inode_number,
+            libfsxfs_inode_t *inode,
+            libbfio_handle_t *file_io_handle,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scanner_free(
+     libfsxfs_inode_scanner_t **inode_scanner,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scanner_push_task(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     int first_chunk_index,
+     int number_of_chunks,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scanner_pop_task(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     libfsxfs_inode_scan_task_t *task,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scanner_complete_task(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     libfsxfs_inode_scan_task_t *task,
+     int task_result,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scanner_run_task(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_scan_task_t *task,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scanner_process_tasks(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+
+int libfsxfs_inode_scanner_thread_function(
+     void *arguments );
+
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
+int libfsxfs_inode_scanner_scan(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_INODE_SCANNER_H ) */
+
@@ -25,8 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_block_cache.h"
+#include "libfsxfs_file_io_handle_pool.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
+#include "libfsxfs_memory_mapped_file.h"
+#include "libfsxfs_read_queue.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -40,10 +44,18 @@ struct libfsxfs_io_handle
 	 */
 	int format_version;
 
+	/* Feature flags
+	 */
+	uint16_t feature_flags;
+
 	/* Secondary feature flags
 	 */
 	uint32_t secondary_feature_flags;
 
+	/* The sector size
+	 */
+	uint16_t sector_size;
+
 	/* The block size
 	 */
 	uint32_t block_size;
@@ -56,6 +68,10 @@ struct libfsxfs_io_handle
 	 */
 	uint16_t inode_size;
 
+	/* The inode cluster size, 0 if inodes are not read per cluster
+	 */
+	uint32_t inode_cluster_size;
+
 	/* Directory block size
 	 */
 	uint32_t directory_block_size;
@@ -68,6 +84,35 @@ struct libfsxfs_io_handle
 	 */
 	uint8_t number_of_relative_inode_number_bits;
 
+	/* The metadata block cache
+	 * The cache is not managed by the IO handle
+	 */
+	libfsxfs_block_cache_t *metadata_block_cache;
+
+	/* The inode cluster cache
+	 * The cache is not managed by the IO handle
+	 */
+	libfsxfs_block_cache_t *inode_cluster_cache;
+
+	/* The file IO handle pool
+	 * The pool is not managed by the IO handle
+	 */
+	libfsxfs_file_io_handle_pool_t *file_io_handle_pool;
+
+	/* The memory mapped file
+	 * The memory mapped file is not managed by the IO handle
+	 */
+	libfsxfs_memory_mapped_file_t *memory_mapped_file;
+
+	/* The read queue used for asynchronous reads of file entry data
+	 * The read queue is not managed by the IO handle
+	 */
+	libfsxfs_read_queue_t *read_queue;
+
+	/* The maximum readahead size used for sequential reads of file entry data
+	 */
+	size_t maximum_readahead_size;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -0,0 +1,557 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_memory_mapped_file.h"
+
+#if defined( HAVE_ERRNO_H ) && defined( HAVE_FCNTL_H ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && !defined( WINAPI )
+#define LIBFSXFS_HAVE_MEMORY_MAPPED_FILE_SUPPORT
+#endif
+
+/* Creates a memory mapped file
+ * Make sure the value memory_mapped_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_memory_mapped_file_initialize(
+     libfsxfs_memory_mapped_file_t **memory_mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_memory_mapped_file_initialize";
+
+	if( memory_mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_mapped_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory mapped file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_mapped_file = memory_allocate_structure(
+	                       libfsxfs_memory_mapped_file_t );
+
+	if( *memory_mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *memory_mapped_file,
+	     0,
+	     sizeof( libfsxfs_memory_mapped_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *memory_mapped_file != NULL )
+	{
+		memory_free(
+		 *memory_mapped_file );
+
+		*memory_mapped_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a memory mapped file
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_memory_mapped_file_free(
+     libfsxfs_memory_mapped_file_t **memory_mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_memory_mapped_file_free";
+	int result            = 1;
+
+	if( memory_mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_mapped_file != NULL )
+	{
+		if( ( *memory_mapped_file )->data != NULL )
+		{
+			if( libfsxfs_memory_mapped_file_close(
+			     *memory_mapped_file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close memory mapped file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *memory_mapped_file );
+
+		*memory_mapped_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a memory mapped file
+ * The file is mapped read-only
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_memory_mapped_file_open(
+     libfsxfs_memory_mapped_file_t *memory_mapped_file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( LIBFSXFS_HAVE_MEMORY_MAPPED_FILE_SUPPORT )
+	struct stat file_statistics;
+
+	void *mapped_data     = NULL;
+	int file_descriptor   = -1;
+#endif
+	static char *function = "libfsxfs_memory_mapped_file_open";
+
+	if( memory_mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_mapped_file->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory mapped file - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBFSXFS_HAVE_MEMORY_MAPPED_FILE_SUPPORT )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only regular files are mapped, devices are read using the file IO handle
+	 */
+	if( S_ISREG( file_statistics.st_mode ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type not a regular file.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_statistics.st_size <= 0 )
+	 || ( (size64_t) file_statistics.st_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	mapped_data = mmap(
+	               NULL,
+	               (size_t) file_statistics.st_size,
+	               PROT_READ,
+	               MAP_SHARED,
+	               file_descriptor,
+	               0 );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 filename );
+
+		munmap(
+		 mapped_data,
+		 (size_t) file_statistics.st_size );
+
+		return( -1 );
+	}
+	memory_mapped_file->data      = (uint8_t *) mapped_data;
+	memory_mapped_file->data_size = (size64_t) file_statistics.st_size;
+
+	return( 1 );
+
+on_error:
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory mapped files are not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( LIBFSXFS_HAVE_MEMORY_MAPPED_FILE_SUPPORT ) */
+}
+
+/* Closes a memory mapped file
+ * Returns 0 if successful or -1 on error
+ */
+int libfsxfs_memory_mapped_file_close(
+     libfsxfs_memory_mapped_file_t *memory_mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_memory_mapped_file_close";
+	int result            = 0;
+
+	if( memory_mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory mapped file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBFSXFS_HAVE_MEMORY_MAPPED_FILE_SUPPORT )
+	if( memory_mapped_file->data != NULL )
+	{
+		if( munmap(
+		     (void *) memory_mapped_file->data,
+		     (size_t) memory_mapped_file->data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	memory_mapped_file->data      = NULL;
+	memory_mapped_file->data_size = 0;
+
+	return( result );
+}
+
+/* Retrieves a pointer to the mapped data at a specific offset
+ * The data remains valid until the memory mapped file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_memory_mapped_file_get_data_at_offset(
+     libfsxfs_memory_mapped_file_t *memory_mapped_file,
+     off64_t file_offset,
+     size_t data_size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_memory_mapped_file_get_data_at_offset";
+
+	if( memory_mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_mapped_file->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory mapped file - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_offset < 0 )
+	 || ( (size64_t) file_offset >= memory_mapped_file->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) data_size > ( memory_mapped_file->data_size - (size64_t) file_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	*data = &( memory_mapped_file->data[ file_offset ] );
+
+	return( 1 );
+}
+
+/* Reads a buffer from the mapped data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_memory_mapped_file_read_buffer_at_offset(
+         libfsxfs_memory_mapped_file_t *memory_mapped_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t file_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_memory_mapped_file_read_buffer_at_offset";
+
+	if( memory_mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_mapped_file->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory mapped file - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) file_offset >= memory_mapped_file->data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( memory_mapped_file->data_size - (size64_t) file_offset ) )
+	{
+		buffer_size = (size_t) ( memory_mapped_file->data_size - (size64_t) file_offset );
+	}
+	if( memory_copy(
+	     buffer,
+	     &( memory_mapped_file->data[ file_offset ] ),
+	     buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) buffer_size );
+}
+
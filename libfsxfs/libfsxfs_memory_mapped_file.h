@@ -0,0 +1,84 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFSXFS_MEMORY_MAPPED_FILE_H )
+#define _LIBFSXFS_MEMORY_MAPPED_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_memory_mapped_file libfsxfs_memory_mapped_file_t;
+
+struct libfsxfs_memory_mapped_file
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size64_t data_size;
+};
+
+int libfsxfs_memory_mapped_file_initialize(
+     libfsxfs_memory_mapped_file_t **memory_mapped_file,
+     libcerror_error_t **error );
+
+int libfsxfs_memory_mapped_file_free(
+     libfsxfs_memory_mapped_file_t **memory_mapped_file,
+     libcerror_error_t **error );
+
+int libfsxfs_memory_mapped_file_open(
+     libfsxfs_memory_mapped_file_t *memory_mapped_file,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libfsxfs_memory_mapped_file_close(
+     libfsxfs_memory_mapped_file_t *memory_mapped_file,
+     libcerror_error_t **error );
+
+int libfsxfs_memory_mapped_file_get_data_at_offset(
+     libfsxfs_memory_mapped_file_t *memory_mapped_file,
+     off64_t file_offset,
+     size_t data_size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_memory_mapped_file_read_buffer_at_offset(
+         libfsxfs_memory_mapped_file_t *memory_mapped_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t file_offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_MEMORY_MAPPED_FILE_H ) */
+
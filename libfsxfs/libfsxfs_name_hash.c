@@ -0,0 +1,229 @@
+/*
+ * Name hash functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libuna.h"
+#include "libfsxfs_name_hash.h"
+
+/* Calculates the name hash of a group of 4 bytes
+ */
+#define libfsxfs_name_hash_calculate_group( name_hash, data ) \
+	( ( (uint32_t) ( data )[ 0 ] << 21 ) \
+	^ ( (uint32_t) ( data )[ 1 ] << 14 ) \
+	^ ( (uint32_t) ( data )[ 2 ] << 7 ) \
+	^ (uint32_t) ( data )[ 3 ] \
+	^ ( ( name_hash << 28 ) | ( name_hash >> 4 ) ) )
+
+/* Calculates the name hash of the remaining 1 to 3 bytes
+ */
+#define libfsxfs_name_hash_calculate_remainder( name_hash, data, data_size ) \
+	( ( data_size == 3 ) ? ( ( (uint32_t) ( data )[ 0 ] << 14 ) ^ ( (uint32_t) ( data )[ 1 ] << 7 ) ^ (uint32_t) ( data )[ 2 ] ^ ( ( name_hash << 21 ) | ( name_hash >> 11 ) ) ) \
+	: ( data_size == 2 ) ? ( ( (uint32_t) ( data )[ 0 ] << 7 ) ^ (uint32_t) ( data )[ 1 ] ^ ( ( name_hash << 14 ) | ( name_hash >> 18 ) ) ) \
+	: ( data_size == 1 ) ? ( (uint32_t) ( data )[ 0 ] ^ ( ( name_hash << 7 ) | ( name_hash >> 25 ) ) ) \
+	: name_hash )
+
+/* Calculates the name hash of an UTF-8 encoded name
+ * The name hash is the directory and extended attribute name hash (xfs_da_hashname)
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_name_hash_calculate_from_utf8_string(
+     uint32_t *name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsxfs_name_hash_calculate_from_utf8_string";
+	size_t utf8_string_index = 0;
+	uint32_t safe_name_hash  = 0;
+
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( utf8_string_length - utf8_string_index ) >= 4 )
+	{
+		safe_name_hash = libfsxfs_name_hash_calculate_group(
+		                  safe_name_hash,
+		                  &( utf8_string[ utf8_string_index ] ) );
+
+		utf8_string_index += 4;
+	}
+	safe_name_hash = libfsxfs_name_hash_calculate_remainder(
+	                  safe_name_hash,
+	                  &( utf8_string[ utf8_string_index ] ),
+	                  utf8_string_length - utf8_string_index );
+
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Calculates the name hash of an UTF-16 encoded name
+ * The name hash is calculated over the UTF-8 representation of the name
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_name_hash_calculate_from_utf16_string(
+     uint32_t *name_hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	uint8_t name_data[ 8 ];
+
+	static char *function                        = "libfsxfs_name_hash_calculate_from_utf16_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t name_data_index                       = 0;
+	size_t name_data_size                        = 0;
+	size_t utf16_string_index                    = 0;
+	uint32_t safe_name_hash                      = 0;
+
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name data buffer holds the bytes of the current incomplete group
+	 * followed by the UTF-8 representation of the next Unicode character
+	 */
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     name_data,
+		     8,
+		     &name_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy Unicode character to UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+		if( name_data_size >= 4 )
+		{
+			safe_name_hash = libfsxfs_name_hash_calculate_group(
+			                  safe_name_hash,
+			                  name_data );
+
+			name_data_size -= 4;
+
+			for( name_data_index = 0;
+			     name_data_index < name_data_size;
+			     name_data_index++ )
+			{
+				name_data[ name_data_index ] = name_data[ name_data_index + 4 ];
+			}
+		}
+	}
+	safe_name_hash = libfsxfs_name_hash_calculate_remainder(
+	                  safe_name_hash,
+	                  name_data,
+	                  name_data_size );
+
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
@@ -0,0 +1,834 @@
+/*
+ * Asynchronous read queue functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_file_entry.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_read_queue.h"
+
+/* Creates a read request
+ * Make sure the value read_request is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_request_initialize(
+     libfsxfs_read_request_t **read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_read_request_initialize";
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_request != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read request value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*read_request = memory_allocate_structure(
+	                 libfsxfs_read_request_t );
+
+	if( *read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read request.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_request,
+	     0,
+	     sizeof( libfsxfs_read_request_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read request.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *read_request != NULL )
+	{
+		memory_free(
+		 *read_request );
+
+		*read_request = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read request
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_request_free(
+     libfsxfs_read_request_t **read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_read_request_free";
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_request != NULL )
+	{
+		/* The file entry, file IO handle, buffer and user value are not managed by the read request
+		 */
+		if( ( *read_request )->read_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *read_request )->read_error ) );
+		}
+		memory_free(
+		 *read_request );
+
+		*read_request = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates a read queue
+ * The requests are processed by queue_depth threads if multi-threading is supported
+ * otherwise the requests are processed when they are pushed
+ * Make sure the value read_queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_queue_initialize(
+     libfsxfs_read_queue_t **read_queue,
+     int queue_depth,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_read_queue_initialize";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue_depth <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid queue depth value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*read_queue = memory_allocate_structure(
+	               libfsxfs_read_queue_t );
+
+	if( *read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_queue,
+	     0,
+	     sizeof( libfsxfs_read_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read queue.",
+		 function );
+
+		memory_free(
+		 *read_queue );
+
+		*read_queue = NULL;
+
+		return( -1 );
+	}
+	( *read_queue )->queue_depth = queue_depth;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *read_queue )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *read_queue )->completed_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create completed condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( ( *read_queue )->thread_pool ),
+	     NULL,
+	     queue_depth,
+	     queue_depth,
+	     (int (*)(intptr_t *, void *)) &libfsxfs_read_queue_process_request,
+	     (void *) *read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *read_queue != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( ( *read_queue )->completed_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *read_queue )->completed_condition ),
+			 NULL );
+		}
+		if( ( *read_queue )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *read_queue )->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *read_queue );
+
+		*read_queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read queue
+ * Waits for the requests that are being processed to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_queue_free(
+     libfsxfs_read_queue_t **read_queue,
+     libcerror_error_t **error )
+{
+	libfsxfs_read_request_t *read_request = NULL;
+	static char *function                 = "libfsxfs_read_queue_free";
+	int result                            = 1;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		/* Joining the thread pool processes the remaining requests
+		 */
+		if( ( *read_queue )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *read_queue )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		while( ( *read_queue )->first_completed_request != NULL )
+		{
+			read_request = ( *read_queue )->first_completed_request;
+
+			( *read_queue )->first_completed_request = read_request->next_request;
+
+			if( libfsxfs_read_request_free(
+			     &read_request,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read request.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *read_queue )->completed_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completed condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *read_queue )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *read_queue );
+
+		*read_queue = NULL;
+	}
+	return( result );
+}
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+
+/* Marks a read request as failed
+ * The error is stored in the request, unless the request already contains an error
+ */
+void libfsxfs_read_queue_fail_request(
+      libfsxfs_read_request_t *read_request,
+      libcerror_error_t **error )
+{
+	if( read_request->read_error == NULL )
+	{
+		read_request->read_error = *error;
+		*error                   = NULL;
+	}
+	else
+	{
+		libcerror_error_free(
+		 error );
+	}
+	read_request->read_count = -1;
+}
+
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
+/* Processes a read request
+ * Callback function for the thread pool
+ * The result of the read is stored in the request, after which the request is appended to the completed requests
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_queue_process_request(
+     libfsxfs_read_request_t *read_request,
+     libfsxfs_read_queue_t *read_queue )
+{
+	static char *function    = "libfsxfs_read_queue_process_request";
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *error = NULL;
+#endif
+
+	if( ( read_request == NULL )
+	 || ( read_queue == NULL ) )
+	{
+		return( -1 );
+	}
+	read_request->read_count = libfsxfs_internal_file_entry_pread_buffer(
+	                            (libfsxfs_internal_file_entry_t *) read_request->file_entry,
+	                            read_request->file_io_handle,
+	                            read_request->buffer,
+	                            read_request->buffer_size,
+	                            read_request->offset,
+	                            &( read_request->read_error ) );
+
+	if( read_request->read_count < 0 )
+	{
+		libcerror_error_set(
+		 &( read_request->read_error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 read_request->offset,
+		 read_request->offset );
+
+		read_request->read_count = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The request must always be completed, otherwise a caller that waits for it
+	 * would block indefinitely. Hence if the mutex cannot be grabbed the request
+	 * fails and grabbing the mutex is retried.
+	 */
+	while( libcthreads_mutex_grab(
+	        read_queue->mutex,
+	        &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		libfsxfs_read_queue_fail_request(
+		 read_request,
+		 &error );
+	}
+#endif
+	if( read_queue->last_completed_request == NULL )
+	{
+		read_queue->first_completed_request = read_request;
+	}
+	else
+	{
+		read_queue->last_completed_request->next_request = read_request;
+	}
+	read_queue->last_completed_request = read_request;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* A caller that waits for the request is only woken up by the broadcast
+	 */
+	while( libcthreads_condition_broadcast(
+	        read_queue->completed_condition,
+	        &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast completed condition.",
+		 function );
+
+		libfsxfs_read_queue_fail_request(
+		 read_request,
+		 &error );
+	}
+	if( libcthreads_mutex_release(
+	     read_queue->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Pushes a read request onto the queue
+ * The buffer must remain valid until the request has been popped from the completed requests
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_queue_push_request(
+     libfsxfs_read_queue_t *read_queue,
+     libfsxfs_file_entry_t *file_entry,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     intptr_t *user_value,
+     libcerror_error_t **error )
+{
+	libfsxfs_read_request_t *read_request = NULL;
+	static char *function                 = "libfsxfs_read_queue_push_request";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_read_request_initialize(
+	     &read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read request.",
+		 function );
+
+		goto on_error;
+	}
+	read_request->file_entry     = file_entry;
+	read_request->file_io_handle = file_io_handle;
+	read_request->buffer         = buffer;
+	read_request->buffer_size    = buffer_size;
+	read_request->offset         = offset;
+	read_request->user_value     = user_value;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	read_queue->number_of_pending_requests += 1;
+
+	if( libcthreads_mutex_release(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	/* The push blocks while queue depth requests are waiting to be processed
+	 */
+	if( libcthreads_thread_pool_push(
+	     read_queue->thread_pool,
+	     (intptr_t *) read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push read request onto thread pool.",
+		 function );
+
+		if( libcthreads_mutex_grab(
+		     read_queue->mutex,
+		     NULL ) == 1 )
+		{
+			read_queue->number_of_pending_requests -= 1;
+
+			libcthreads_mutex_release(
+			 read_queue->mutex,
+			 NULL );
+		}
+		goto on_error;
+	}
+#else
+	read_queue->number_of_pending_requests += 1;
+
+	if( libfsxfs_read_queue_process_request(
+	     read_request,
+	     read_queue ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process read request.",
+		 function );
+
+		read_queue->number_of_pending_requests -= 1;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( read_request != NULL )
+	{
+		libfsxfs_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Pops a completed read request from the queue
+ * If wait_for_completion is set the function waits until a pending request has completed
+ * Returns 1 if successful, 0 if no completed request is available or -1 on error
+ */
+int libfsxfs_read_queue_pop_completed_request(
+     libfsxfs_read_queue_t *read_queue,
+     uint8_t wait_for_completion,
+     libfsxfs_read_request_t **read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_read_queue_pop_completed_request";
+	int result            = 0;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_request != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read request value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( wait_for_completion != 0 )
+	    && ( read_queue->first_completed_request == NULL )
+	    && ( read_queue->number_of_pending_requests > 0 ) )
+	{
+		if( libcthreads_condition_wait(
+		     read_queue->completed_condition,
+		     read_queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for completed condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 read_queue->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( read_queue->first_completed_request != NULL )
+	{
+		*read_request = read_queue->first_completed_request;
+
+		read_queue->first_completed_request = ( *read_request )->next_request;
+
+		if( read_queue->first_completed_request == NULL )
+		{
+			read_queue->last_completed_request = NULL;
+		}
+		( *read_request )->next_request = NULL;
+
+		read_queue->number_of_pending_requests -= 1;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,163 @@
+/*
+ * Asynchronous read queue functions
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_READ_QUEUE_H )
+#define _LIBFSXFS_READ_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_read_request libfsxfs_read_request_t;
+
+struct libfsxfs_read_request
+{
+	/* The file entry
+	 */
+	libfsxfs_file_entry_t *file_entry;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The user value
+	 */
+	intptr_t *user_value;
+
+	/* The number of bytes read or -1 on error
+	 */
+	ssize_t read_count;
+
+	/* The error of a failed read
+	 */
+	libcerror_error_t *read_error;
+
+	/* The next completed request
+	 */
+	libfsxfs_read_request_t *next_request;
+};
+
+typedef struct libfsxfs_read_queue libfsxfs_read_queue_t;
+
+struct libfsxfs_read_queue
+{
+	/* The queue depth
+	 */
+	int queue_depth;
+
+	/* The number of requests that were pushed and not yet popped
+	 */
+	int number_of_pending_requests;
+
+	/* The first completed request
+	 */
+	libfsxfs_read_request_t *first_completed_request;
+
+	/* The last completed request
+	 */
+	libfsxfs_read_request_t *last_completed_request;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The thread pool that processes the requests
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex that protects the completed requests
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a request completes
+	 */
+	libcthreads_condition_t *completed_condition;
+#endif
+};
+
+int libfsxfs_read_request_initialize(
+     libfsxfs_read_request_t **read_request,
+     libcerror_error_t **error );
+
+int libfsxfs_read_request_free(
+     libfsxfs_read_request_t **read_request,
+     libcerror_error_t **error );
+
+int libfsxfs_read_queue_initialize(
+     libfsxfs_read_queue_t **read_queue,
+     int queue_depth,
+     libcerror_error_t **error );
+
+int libfsxfs_read_queue_free(
+     libfsxfs_read_queue_t **read_queue,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+
+void libfsxfs_read_queue_fail_request(
+      libfsxfs_read_request_t *read_request,
+      libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
+int libfsxfs_read_queue_process_request(
+     libfsxfs_read_request_t *read_request,
+     libfsxfs_read_queue_t *read_queue );
+
+int libfsxfs_read_queue_push_request(
+     libfsxfs_read_queue_t *read_queue,
+     libfsxfs_file_entry_t *file_entry,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     intptr_t *user_value,
+     libcerror_error_t **error );
+
+int libfsxfs_read_queue_pop_completed_request(
+     libfsxfs_read_queue_t *read_queue,
+     uint8_t wait_for_completion,
+     libfsxfs_read_request_t **read_request,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_READ_QUEUE_H ) */
+
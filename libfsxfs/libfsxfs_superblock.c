@@ -259,6 +259,10 @@ int libfsxfs_superblock_read_data(
 	 ( (fsxfs_superblock_t *) data )->inode_size,
 	 superblock->inode_size );
 
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_superblock_t *) data )->inode_chunk_alignment_size,
+	 superblock->inode_chunk_alignment_size );
+
 	byte_stream_copy_to_uint16_big_endian(
 	 ( (fsxfs_superblock_t *) data )->number_of_inodes_per_block,
 	 number_of_inodes_per_block );
@@ -543,13 +547,10 @@ int libfsxfs_superblock_read_data(
 		 function,
 		 ( (fsxfs_superblock_t *) data )->unknown1 );
 
-		byte_stream_copy_to_uint32_big_endian(
-		 ( (fsxfs_superblock_t *) data )->inode_chunk_alignment_size,
-		 value_32bit );
 		libcnotify_printf(
 		 "%s: inode chunk alignment size\t\t: %" PRIu32 " blocks\n",
 		 function,
-		 value_32bit );
+		 superblock->inode_chunk_alignment_size );
 
 		byte_stream_copy_to_uint32_big_endian(
 		 ( (fsxfs_superblock_t *) data )->raid_unit_size,
@@ -78,6 +78,10 @@ struct libfsxfs_superblock
 	 */
 	uint16_t inode_size;
 
+	/* Inode chunk alignment size in blocks
+	 */
+	uint32_t inode_chunk_alignment_size;
+
 	/* Directory block size
 	 */
 	uint32_t directory_block_size;
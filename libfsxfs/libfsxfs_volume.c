@@ -25,12 +25,14 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libfsxfs_block_cache.h"
 #include "libfsxfs_debug.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_file_entry.h"
 #include "libfsxfs_file_system.h"
 #include "libfsxfs_inode.h"
+#include "libfsxfs_inode_scanner.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
@@ -132,6 +134,10 @@ int libfsxfs_volume_initialize(
 		goto on_error;
 	}
 #endif
+	internal_volume->maximum_number_of_cached_inodes            = LIBFSXFS_DEFAULT_MAXIMUM_NUMBER_OF_CACHED_INODES;
+	internal_volume->maximum_number_of_cached_directory_entries = LIBFSXFS_DEFAULT_MAXIMUM_NUMBER_OF_CACHED_DIRECTORY_ENTRIES;
+	internal_volume->maximum_readahead_size                     = LIBFSXFS_DEFAULT_MAXIMUM_READAHEAD_SIZE;
+
 	*volume = (libfsxfs_volume_t *) internal_volume;
 
 	return( 1 );
@@ -268,18 +274,18 @@ int libfsxfs_volume_signal_abort(
 	return( 1 );
 }
 
-/* Opens a volume
+/* Sets the maximum number of cached inodes
+ * A value of 0 disables the inode cache
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_open(
+int libfsxfs_volume_set_maximum_number_of_cached_inodes(
      libfsxfs_volume_t *volume,
-     const char *filename,
-     int access_flags,
+     int maximum_number_of_cached_inodes,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle            = NULL;
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_open";
+	static char *function                       = "libfsxfs_volume_set_maximum_number_of_cached_inodes";
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -294,100 +300,101 @@ int libfsxfs_volume_open(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( filename == NULL )
+	if( maximum_number_of_cached_inodes < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of cached inodes value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBFSXFS_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) == 0 ) )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) != 0 )
+#endif
+	if( internal_volume->file_system != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file system value already set.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
-		 function );
-
-		goto on_error;
+		internal_volume->maximum_number_of_cached_inodes = maximum_number_of_cached_inodes;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set track offsets read in file IO handle.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     narrow_string_length(
-	      filename ) + 1,
-	     error ) != 1 )
+	return( result );
+}
+
+/* Sets the maximum number of cached directory entries used for path resolution
+ * A value of 0 disables the directory entry cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_maximum_number_of_cached_directory_entries(
+     libfsxfs_volume_t *volume,
+     int maximum_number_of_cached_directory_entries,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_maximum_number_of_cached_directory_entries";
+	int result                                  = 1;
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set filename in file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsxfs_volume_open_file_io_handle(
-	     volume,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( maximum_number_of_cached_directory_entries < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open volume: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of cached directory entries value less than zero.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -401,11 +408,24 @@ int libfsxfs_volume_open(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	internal_volume->file_io_handle_created_in_library = 1;
+	if( internal_volume->file_system != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file system value already set.",
+		 function );
 
+		result = -1;
+	}
+	else
+	{
+		internal_volume->maximum_number_of_cached_directory_entries = maximum_number_of_cached_directory_entries;
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -418,37 +438,24 @@ int libfsxfs_volume_open(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		internal_volume->file_io_handle_created_in_library = 0;
-
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
+	return( result );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Opens a volume
+/* Sets if the allocation group inode information should be read on demand
+ * This function must be called before the volume is opened
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_open_wide(
+int libfsxfs_volume_set_read_allocation_groups_on_demand(
      libfsxfs_volume_t *volume,
-     const wchar_t *filename,
-     int access_flags,
+     uint8_t read_on_demand,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle            = NULL;
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_open_wide";
+	static char *function                       = "libfsxfs_volume_set_read_allocation_groups_on_demand";
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -463,100 +470,92 @@ int libfsxfs_volume_open_wide(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( filename == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( ( access_flags & LIBFSXFS_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) == 0 ) )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) != 0 )
+#endif
+	if( internal_volume->file_system != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file system value already set.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
-		 function );
-
-		goto on_error;
+		internal_volume->read_allocation_groups_on_demand = read_on_demand;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set track offsets read in file IO handle.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     wide_string_length(
-	      filename ) + 1,
-	     error ) != 1 )
+	return( result );
+}
+
+/* Sets the number of threads used to read the allocation group inode information
+ * A value of 0 or 1 reads the inode information sequentially
+ * This function must be called before the volume is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_number_of_read_threads(
+     libfsxfs_volume_t *volume,
+     int number_of_read_threads,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_number_of_read_threads";
+	int result                                  = 1;
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set filename in file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsxfs_volume_open_file_io_handle(
-	     volume,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( ( number_of_read_threads < 0 )
+	 || ( number_of_read_threads > LIBFSXFS_MAXIMUM_NUMBER_OF_READ_THREADS ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open volume: %ls.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of read threads value out of bounds.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -570,11 +569,24 @@ int libfsxfs_volume_open_wide(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	internal_volume->file_io_handle_created_in_library = 1;
+	if( internal_volume->file_system != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file system value already set.",
+		 function );
 
+		result = -1;
+	}
+	else
+	{
+		internal_volume->number_of_read_threads = number_of_read_threads;
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -587,39 +599,25 @@ int libfsxfs_volume_open_wide(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		internal_volume->file_io_handle_created_in_library = 0;
-
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
+	return( result );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Opens a volume using a Basic File IO (bfio) handle
+/* Sets the number of file IO handles used to read file entry data
+ * A value of 0 or 1 reads all file entry data using the file IO handle of the volume
+ * This function must be called before the volume is opened
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_open_file_io_handle(
+int libfsxfs_volume_set_number_of_file_io_handles(
      libfsxfs_volume_t *volume,
-     libbfio_handle_t *file_io_handle,
-     int access_flags,
+     int number_of_file_io_handles,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_open_file_io_handle";
-	uint8_t file_io_handle_opened_in_library    = 0;
-	int bfio_access_flags                       = 0;
-	int file_io_handle_is_open                  = 0;
+	static char *function                       = "libfsxfs_volume_set_number_of_file_io_handles";
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -634,102 +632,180 @@ int libfsxfs_volume_open_file_io_handle(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( internal_volume->file_io_handle != NULL )
+	if( ( number_of_file_io_handles < 0 )
+	 || ( number_of_file_io_handles > LIBFSXFS_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of file IO handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - file IO handle already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+#endif
+	if( internal_volume->file_system != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file system value already set.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_volume->number_of_file_io_handles = number_of_file_io_handles;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBFSXFS_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) == 0 ) )
+#endif
+	return( result );
+}
+
+/* Sets the maximum readahead size used for sequential reads of file entry data
+ * A value of 0 disables readahead
+ * This function must be called before the volume is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_maximum_readahead_size(
+     libfsxfs_volume_t *volume,
+     size_t maximum_readahead_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_maximum_readahead_size";
+	int result                                  = 1;
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) != 0 )
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( maximum_readahead_size > (size_t) LIBFSXFS_MAXIMUM_READAHEAD_SIZE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum readahead size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_READ ) != 0 )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-	if( file_io_handle_is_open == -1 )
+		return( -1 );
+	}
+#endif
+	if( internal_volume->file_system != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open volume.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file system value already set.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	else if( file_io_handle_is_open == 0 )
+	else
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
-
-			goto on_error;
-		}
-		file_io_handle_opened_in_library = 1;
+		internal_volume->maximum_readahead_size = maximum_readahead_size;
 	}
-	if( libfsxfs_internal_volume_open_read(
-	     internal_volume,
-	     file_io_handle,
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets if the volume should be memory mapped when it is opened by filename
+ * Memory mapping is only used for regular files opened with libfsxfs_volume_open,
+ * other files are read using the file IO handle
+ * This function must be called before the volume is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_use_memory_mapping(
+     libfsxfs_volume_t *volume,
+     uint8_t use_memory_mapping,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_use_memory_mapping";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
 	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -742,12 +818,24 @@ int libfsxfs_volume_open_file_io_handle(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	internal_volume->file_io_handle                   = file_io_handle;
-	internal_volume->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	if( internal_volume->file_system != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file system value already set.",
+		 function );
 
+		result = -1;
+	}
+	else
+	{
+		internal_volume->use_memory_mapping = use_memory_mapping;
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -760,34 +848,25 @@ int libfsxfs_volume_open_file_io_handle(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		internal_volume->file_io_handle                   = NULL;
-		internal_volume->file_io_handle_opened_in_library = 0;
-
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	return( 1 );
-
-on_error:
-	if( file_io_handle_opened_in_library != 0 )
-	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
-	}
-	return( -1 );
+	return( result );
 }
 
-/* Closes a volume
- * Returns 0 if successful or -1 on error
+/* Sets the number of asynchronous reads of file entry data that are processed concurrently
+ * A value of 0 disables asynchronous reads
+ * This function must be called before the volume is opened
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_close(
+int libfsxfs_volume_set_read_queue_depth(
      libfsxfs_volume_t *volume,
+     int read_queue_depth,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_close";
-	int result                                  = 0;
+	static char *function                       = "libfsxfs_volume_set_read_queue_depth";
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -802,13 +881,14 @@ int libfsxfs_volume_close(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( internal_volume->file_io_handle == NULL )
+	if( ( read_queue_depth < 0 )
+	 || ( read_queue_depth > LIBFSXFS_MAXIMUM_READ_QUEUE_DEPTH ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read queue depth value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -828,109 +908,2091 @@ int libfsxfs_volume_close(
 		return( -1 );
 	}
 #endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( internal_volume->file_system != NULL )
 	{
-		if( internal_volume->file_io_handle_created_in_library != 0 )
-		{
-			if( libfsxfs_debug_print_read_offsets(
-			     internal_volume->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file system value already set.",
+		 function );
 
-				result = -1;
-			}
-		}
+		result = -1;
 	}
-#endif
-	if( internal_volume->file_io_handle_opened_in_library != 0 )
+	else
 	{
-		if( libbfio_handle_close(
-		     internal_volume->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
-
-			result = -1;
-		}
-		internal_volume->file_io_handle_opened_in_library = 0;
+		internal_volume->read_queue_depth = read_queue_depth;
 	}
-	if( internal_volume->file_io_handle_created_in_library != 0 )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_free(
-		     &( internal_volume->file_io_handle ),
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_open(
+     libfsxfs_volume_t *volume,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle            = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_open";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBFSXFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set track offsets read in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     narrow_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_volume->use_memory_mapping != 0 )
+	{
+		if( internal_volume->memory_mapped_file != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid volume - memory mapped file value already set.",
+			 function );
+
+			libbfio_handle_free(
+			 &file_io_handle,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libfsxfs_memory_mapped_file_initialize(
+		     &( internal_volume->memory_mapped_file ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create memory mapped file.",
 			 function );
 
-			result = -1;
-		}
-		internal_volume->file_io_handle_created_in_library = 0;
+			goto on_error;
+		}
+		/* Fall back to the file IO handle if the file cannot be memory mapped
+		 */
+		if( libfsxfs_memory_mapped_file_open(
+		     internal_volume->memory_mapped_file,
+		     filename,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to memory map file: %s.\n",
+				 function,
+				 filename );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			if( libfsxfs_memory_mapped_file_free(
+			     &( internal_volume->memory_mapped_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free memory mapped file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libfsxfs_volume_open_file_io_handle(
+	     volume,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_volume->file_io_handle_created_in_library = 1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_volume->file_io_handle_created_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( internal_volume->memory_mapped_file != NULL )
+	{
+		libfsxfs_memory_mapped_file_free(
+		 &( internal_volume->memory_mapped_file ),
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_open_wide(
+     libfsxfs_volume_t *volume,
+     const wchar_t *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle            = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_open_wide";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBFSXFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set track offsets read in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_volume_open_file_io_handle(
+	     volume,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_volume->file_io_handle_created_in_library = 1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_volume->file_io_handle_created_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a volume using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_open_file_io_handle(
+     libfsxfs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_open_file_io_handle";
+	uint8_t file_io_handle_opened_in_library    = 0;
+	int bfio_access_flags                       = 0;
+	int file_io_handle_is_open                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBFSXFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libfsxfs_internal_volume_open_read(
+	     internal_volume,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_volume->file_io_handle                   = file_io_handle;
+	internal_volume->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_volume->file_io_handle                   = NULL;
+		internal_volume->file_io_handle_opened_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Closes a volume
+ * Returns 0 if successful or -1 on error
+ */
+int libfsxfs_volume_close(
+     libfsxfs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_close";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_volume->file_io_handle_created_in_library != 0 )
+		{
+			if( libfsxfs_debug_print_read_offsets(
+			     internal_volume->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_volume->read_queue != NULL )
+	{
+		/* The read queue must be freed before the file IO handle pool
+		 * since pending reads use the file IO handles of the pool
+		 */
+		if( libfsxfs_read_queue_free(
+		     &( internal_volume->read_queue ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->file_io_handle_pool != NULL )
+	{
+		/* The cloned file IO handles must be freed before the file IO handle is closed
+		 */
+		if( libfsxfs_file_io_handle_pool_free(
+		     &( internal_volume->file_io_handle_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_volume->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_volume->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_volume->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_volume->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_volume->file_io_handle_created_in_library = 0;
+	}
+	internal_volume->file_io_handle = NULL;
+
+	if( internal_volume->metadata_block_cache != NULL )
+	{
+		if( libfsxfs_block_cache_free(
+		     &( internal_volume->metadata_block_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata block cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->inode_cluster_cache != NULL )
+	{
+		if( libfsxfs_block_cache_free(
+		     &( internal_volume->inode_cluster_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode cluster cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libfsxfs_io_handle_clear(
+	     internal_volume->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_volume->superblock != NULL )
+	{
+		if( libfsxfs_superblock_free(
+		     &( internal_volume->superblock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free superblock.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->file_system != NULL )
+	{
+		if( libfsxfs_file_system_free(
+		     &( internal_volume->file_system ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file system.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->memory_mapped_file != NULL )
+	{
+		if( libfsxfs_memory_mapped_file_free(
+		     &( internal_volume->memory_mapped_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory mapped file.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a volume for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_open_read(
+     libfsxfs_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsxfs_superblock_t *superblock   = NULL;
+	static char *function               = "libfsxfs_internal_volume_open_read";
+	off64_t allocation_group_size       = 0;
+	off64_t inode_information_offset    = 0;
+	off64_t superblock_offset           = 0;
+	uint64_t inode_chunk_alignment_size = 0;
+	uint32_t allocation_group_index     = 0;
+	uint32_t inode_cluster_size         = 0;
+	uint32_t maximum_block_size         = 0;
+	int maximum_number_of_cached_blocks = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - superblock value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_system != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file system value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->metadata_block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - metadata block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->inode_cluster_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - inode cluster cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_io_handle_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->read_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - read queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume->io_handle->memory_mapped_file = internal_volume->memory_mapped_file;
+
+	do
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading superblock: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 allocation_group_index,
+			 superblock_offset,
+			 superblock_offset );
+		}
+#endif
+		if( libfsxfs_superblock_initialize(
+		     &superblock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create superblock: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+		if( libfsxfs_superblock_read_file_io_handle(
+		     superblock,
+		     file_io_handle,
+		     superblock_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read superblock: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 allocation_group_index,
+			 superblock_offset,
+			 superblock_offset );
+
+			goto on_error;
+		}
+		if( internal_volume->superblock == NULL )
+		{
+			internal_volume->superblock                                      = superblock;
+			internal_volume->io_handle->format_version                       = superblock->format_version;
+			internal_volume->io_handle->feature_flags                        = superblock->feature_flags;
+			internal_volume->io_handle->secondary_feature_flags              = superblock->secondary_feature_flags;
+			internal_volume->io_handle->sector_size                          = superblock->sector_size;
+			internal_volume->io_handle->block_size                           = superblock->block_size;
+			internal_volume->io_handle->allocation_group_size                = superblock->allocation_group_size;
+			internal_volume->io_handle->inode_size                           = superblock->inode_size;
+			internal_volume->io_handle->directory_block_size                 = superblock->directory_block_size;
+			internal_volume->io_handle->number_of_relative_block_number_bits = superblock->number_of_relative_block_number_bits;
+			internal_volume->io_handle->number_of_relative_inode_number_bits = superblock->number_of_relative_inode_number_bits;
+
+			superblock = NULL;
+
+			maximum_block_size = internal_volume->io_handle->block_size;
+
+			if( internal_volume->io_handle->directory_block_size > maximum_block_size )
+			{
+				maximum_block_size = internal_volume->io_handle->directory_block_size;
+			}
+			maximum_number_of_cached_blocks = (int) ( LIBFSXFS_MAXIMUM_METADATA_BLOCK_CACHE_SIZE / maximum_block_size );
+
+			if( maximum_number_of_cached_blocks == 0 )
+			{
+				maximum_number_of_cached_blocks = 1;
+			}
+			if( libfsxfs_block_cache_initialize(
+			     &( internal_volume->metadata_block_cache ),
+			     maximum_number_of_cached_blocks,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create metadata block cache.",
+				 function );
+
+				goto on_error;
+			}
+			internal_volume->io_handle->metadata_block_cache = internal_volume->metadata_block_cache;
+
+			/* Inodes are only read per cluster if the inode chunks are aligned
+			 * to the inode cluster size
+			 */
+			if( ( internal_volume->io_handle->feature_flags & LIBFSXFS_FEATURE_FLAG_INODE_CHUNK_ALIGNMENT ) != 0 )
+			{
+				inode_chunk_alignment_size = (uint64_t) internal_volume->superblock->inode_chunk_alignment_size * internal_volume->io_handle->block_size;
+				inode_cluster_size         = LIBFSXFS_INODE_CLUSTER_SIZE;
+
+				/* In format version 5 the inode cluster size scales with the inode size
+				 */
+				if( ( internal_volume->io_handle->format_version == 5 )
+				 && ( inode_chunk_alignment_size >= (uint64_t) ( LIBFSXFS_INODE_CLUSTER_SIZE / 256 ) * internal_volume->io_handle->inode_size ) )
+				{
+					inode_cluster_size = ( LIBFSXFS_INODE_CLUSTER_SIZE / 256 ) * internal_volume->io_handle->inode_size;
+				}
+				if( inode_cluster_size < internal_volume->io_handle->block_size )
+				{
+					inode_cluster_size = internal_volume->io_handle->block_size;
+				}
+				if( inode_chunk_alignment_size < (uint64_t) inode_cluster_size )
+				{
+					inode_cluster_size = 0;
+				}
+			}
+			if( inode_cluster_size != 0 )
+			{
+				maximum_number_of_cached_blocks = (int) ( LIBFSXFS_MAXIMUM_INODE_CLUSTER_CACHE_SIZE / inode_cluster_size );
+
+				if( maximum_number_of_cached_blocks == 0 )
+				{
+					maximum_number_of_cached_blocks = 1;
+				}
+				if( libfsxfs_block_cache_initialize(
+				     &( internal_volume->inode_cluster_cache ),
+				     maximum_number_of_cached_blocks,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create inode cluster cache.",
+					 function );
+
+					goto on_error;
+				}
+				internal_volume->io_handle->inode_cluster_size  = inode_cluster_size;
+				internal_volume->io_handle->inode_cluster_cache = internal_volume->inode_cluster_cache;
+			}
+		}
+		if( internal_volume->file_system == NULL )
+		{
+			if( libfsxfs_file_system_initialize(
+			     &( internal_volume->file_system ),
+			     internal_volume->superblock->root_directory_inode_number,
+			     internal_volume->maximum_number_of_cached_inodes,
+			     internal_volume->maximum_number_of_cached_directory_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create file system.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( internal_volume->read_allocation_groups_on_demand != 0 )
+		{
+			/* The inode information of the allocation groups is read on demand
+			 */
+			if( libfsxfs_file_system_set_number_of_allocation_groups(
+			     internal_volume->file_system,
+			     internal_volume->superblock->number_of_allocation_groups,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set number of allocation groups.",
+				 function );
+
+				goto on_error;
+			}
+			allocation_group_index = internal_volume->superblock->number_of_allocation_groups;
+
+			break;
+		}
+		if( internal_volume->number_of_read_threads > 1 )
+		{
+			if( libfsxfs_file_system_read_all_inode_information(
+			     internal_volume->file_system,
+			     internal_volume->io_handle,
+			     file_io_handle,
+			     internal_volume->superblock->number_of_allocation_groups,
+			     internal_volume->number_of_read_threads,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode information of all allocation groups.",
+				 function );
+
+				goto on_error;
+			}
+			allocation_group_index = internal_volume->superblock->number_of_allocation_groups;
+
+			break;
+		}
+		inode_information_offset = superblock_offset + 2 * internal_volume->superblock->sector_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading inode information: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 allocation_group_index,
+			 inode_information_offset,
+			 inode_information_offset );
+		}
+#endif
+		if( libfsxfs_file_system_read_inode_information(
+		     internal_volume->file_system,
+		     internal_volume->io_handle,
+		     file_io_handle,
+		     inode_information_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode B+ tree.",
+			 function );
+
+			goto on_error;
+		}
+		if( superblock != NULL )
+		{
+			if( libfsxfs_superblock_free(
+			     &superblock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free superblock.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		allocation_group_size = (off64_t) internal_volume->io_handle->allocation_group_size * internal_volume->io_handle->block_size;
+
+		if( ( allocation_group_size == 0 )
+		 || ( superblock_offset > ( (off64_t) INT64_MAX - allocation_group_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid next superblock offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		superblock_offset += allocation_group_size;
+
+		allocation_group_index++;
+	}
+	while( allocation_group_index < internal_volume->superblock->number_of_allocation_groups );
+
+	if( allocation_group_index != internal_volume->superblock->number_of_allocation_groups )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid last allocation group index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_volume->number_of_file_io_handles > 1 )
+	{
+		if( libfsxfs_file_io_handle_pool_initialize(
+		     &( internal_volume->file_io_handle_pool ),
+		     file_io_handle,
+		     internal_volume->number_of_file_io_handles,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle pool.",
+			 function );
+
+			goto on_error;
+		}
+		internal_volume->io_handle->file_io_handle_pool = internal_volume->file_io_handle_pool;
+	}
+	if( internal_volume->read_queue_depth > 0 )
+	{
+		if( libfsxfs_read_queue_initialize(
+		     &( internal_volume->read_queue ),
+		     internal_volume->read_queue_depth,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read queue.",
+			 function );
+
+			goto on_error;
+		}
+		internal_volume->io_handle->read_queue = internal_volume->read_queue;
+	}
+	internal_volume->io_handle->maximum_readahead_size = internal_volume->maximum_readahead_size;
+
+	return( 1 );
+
+on_error:
+	if( internal_volume->file_system != NULL )
+	{
+		libfsxfs_file_system_free(
+		 &( internal_volume->file_system ),
+		 NULL );
+	}
+	internal_volume->io_handle->memory_mapped_file = NULL;
+
+	if( internal_volume->read_queue != NULL )
+	{
+		libfsxfs_read_queue_free(
+		 &( internal_volume->read_queue ),
+		 NULL );
+
+		internal_volume->io_handle->read_queue = NULL;
+	}
+	if( internal_volume->file_io_handle_pool != NULL )
+	{
+		libfsxfs_file_io_handle_pool_free(
+		 &( internal_volume->file_io_handle_pool ),
+		 NULL );
+
+		internal_volume->io_handle->file_io_handle_pool = NULL;
+	}
+	if( internal_volume->metadata_block_cache != NULL )
+	{
+		libfsxfs_block_cache_free(
+		 &( internal_volume->metadata_block_cache ),
+		 NULL );
+
+		internal_volume->io_handle->metadata_block_cache = NULL;
+	}
+	if( internal_volume->inode_cluster_cache != NULL )
+	{
+		libfsxfs_block_cache_free(
+		 &( internal_volume->inode_cluster_cache ),
+		 NULL );
+
+		internal_volume->io_handle->inode_cluster_cache = NULL;
+	}
+	if( internal_volume->superblock != NULL )
+	{
+		libfsxfs_superblock_free(
+		 &( internal_volume->superblock ),
+		 NULL );
+	}
+	if( superblock != NULL )
+	{
+		libfsxfs_superblock_free(
+		 &superblock,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_format_version(
+     libfsxfs_volume_t *volume,
+     uint8_t *format_version,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_format_version";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*format_version = internal_volume->io_handle->format_version;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded label
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_utf8_label_size(
+     libfsxfs_volume_t *volume,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_utf8_label_size";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_superblock_get_utf8_volume_label_size(
+	     internal_volume->superblock,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 volume label string size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded label
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_utf8_label(
+     libfsxfs_volume_t *volume,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_utf8_label";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_superblock_get_utf8_volume_label(
+	     internal_volume->superblock,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 volume label string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded label
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_utf16_label_size(
+     libfsxfs_volume_t *volume,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_utf16_label_size";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_superblock_get_utf16_volume_label_size(
+	     internal_volume->superblock,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 volume label string size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded label
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_utf16_label(
+     libfsxfs_volume_t *volume,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_utf16_label";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_superblock_get_utf16_volume_label(
+	     internal_volume->superblock,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 volume label string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the root directory file entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_root_directory(
+     libfsxfs_volume_t *volume,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *inode                     = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_root_directory";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_file_system_get_inode_by_number(
+	     internal_volume->file_system,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->superblock->root_directory_inode_number,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 ".",
+		 function,
+		 internal_volume->superblock->root_directory_inode_number );
+
+		result = -1;
+	}
+	else if( libfsxfs_file_entry_initialize(
+	          file_entry,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->file_system,
+	          internal_volume->superblock->root_directory_inode_number,
+	          inode,
+	          NULL,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libfsxfs_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry of a specific inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_get_file_entry_by_inode(
+     libfsxfs_internal_volume_t *internal_volume,
+     uint64_t inode_number,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *inode = NULL;
+	static char *function   = "libfsxfs_internal_volume_get_file_entry_by_inode";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_file_system_get_inode_by_number(
+	     internal_volume->file_system,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     inode_number,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	/* libfsxfs_file_entry_initialize takes over management of inode
+	 */
+	if( libfsxfs_file_entry_initialize(
+	     file_entry,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->file_system,
+	     inode_number,
+	     inode,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file entry of a specific inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_file_entry_by_inode(
+     libfsxfs_volume_t *volume,
+     uint64_t inode_number,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_file_entry_by_inode";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
 	}
-	internal_volume->file_io_handle = NULL;
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( libfsxfs_io_handle_clear(
-	     internal_volume->io_handle,
-	     error ) != 1 )
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( internal_volume->superblock != NULL )
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libfsxfs_superblock_free(
-		     &( internal_volume->superblock ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free superblock.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( internal_volume->file_system != NULL )
+#endif
+	if( libfsxfs_internal_volume_get_file_entry_by_inode(
+	     internal_volume,
+	     inode_number,
+	     file_entry,
+	     error ) != 1 )
 	{
-		if( libfsxfs_file_system_free(
-		     &( internal_volume->file_system ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file system.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
 
-			result = -1;
-		}
+		result = -1;
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
@@ -942,26 +3004,31 @@ int libfsxfs_volume_close(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		libfsxfs_file_entry_free(
+		 file_entry,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
 	return( result );
 }
 
-/* Opens a volume for reading
+/* Retrieves the file entries of multiple inodes
+ * The inodes are read in order of their location in the volume
+ * The file entries are set to NULL for inodes that are not allocated
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_internal_volume_open_read(
+int libfsxfs_internal_volume_get_file_entries_by_inodes(
      libfsxfs_internal_volume_t *internal_volume,
-     libbfio_handle_t *file_io_handle,
+     const uint64_t *inode_numbers,
+     int number_of_inodes,
+     libfsxfs_file_entry_t **file_entries,
      libcerror_error_t **error )
 {
-	libfsxfs_superblock_t *superblock = NULL;
-	static char *function             = "libfsxfs_internal_volume_open_read";
-	off64_t allocation_group_size     = 0;
-	off64_t inode_information_offset  = 0;
-	off64_t superblock_offset         = 0;
-	uint32_t allocation_group_index   = 0;
+	libfsxfs_inode_t **inodes = NULL;
+	static char *function     = "libfsxfs_internal_volume_get_file_entries_by_inodes";
+	int inode_index           = 0;
 
 	if( internal_volume == NULL )
 	{
@@ -969,228 +3036,378 @@ int libfsxfs_internal_volume_open_read(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal volume.",
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->io_handle == NULL )
+	if( ( number_of_inodes < 0 )
+	 || ( (size_t) number_of_inodes > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_inode_t * ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal volume - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of inodes value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->superblock != NULL )
+	if( file_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - superblock value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entries.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->file_system != NULL )
+	if( number_of_inodes == 0 )
+	{
+		return( 1 );
+	}
+	inodes = (libfsxfs_inode_t **) memory_allocate(
+	                                sizeof( libfsxfs_inode_t * ) * number_of_inodes );
+
+	if( inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_file_system_get_inodes_by_numbers(
+	     internal_volume->file_system,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     inode_numbers,
+	     number_of_inodes,
+	     inodes,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - file system value already set.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inodes.",
 		 function );
 
+		memory_free(
+		 inodes );
+
 		return( -1 );
 	}
-	do
+	for( inode_index = 0;
+	     inode_index < number_of_inodes;
+	     inode_index++ )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( inodes[ inode_index ] == NULL )
 		{
-			libcnotify_printf(
-			 "Reading superblock: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 allocation_group_index,
-			 superblock_offset,
-			 superblock_offset );
+			continue;
 		}
-#endif
-		if( libfsxfs_superblock_initialize(
-		     &superblock,
+		/* libfsxfs_file_entry_initialize takes over management of inode
+		 */
+		if( libfsxfs_file_entry_initialize(
+		     &( file_entries[ inode_index ] ),
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     inode_numbers[ inode_index ],
+		     inodes[ inode_index ],
+		     NULL,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create superblock: %" PRIu32 ".",
-			 function,
-			 allocation_group_index );
-
-			goto on_error;
-		}
-		if( libfsxfs_superblock_read_file_io_handle(
-		     superblock,
-		     file_io_handle,
-		     superblock_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read superblock: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 "%s: unable to create file entry: %d.",
 			 function,
-			 allocation_group_index,
-			 superblock_offset,
-			 superblock_offset );
+			 inode_index );
 
 			goto on_error;
 		}
-		if( internal_volume->superblock == NULL )
-		{
-			internal_volume->superblock                                      = superblock;
-			internal_volume->io_handle->format_version                       = superblock->format_version;
-			internal_volume->io_handle->secondary_feature_flags              = superblock->secondary_feature_flags;
-			internal_volume->io_handle->block_size                           = superblock->block_size;
-			internal_volume->io_handle->allocation_group_size                = superblock->allocation_group_size;
-			internal_volume->io_handle->inode_size                           = superblock->inode_size;
-			internal_volume->io_handle->directory_block_size                 = superblock->directory_block_size;
-			internal_volume->io_handle->number_of_relative_block_number_bits = superblock->number_of_relative_block_number_bits;
-			internal_volume->io_handle->number_of_relative_inode_number_bits = superblock->number_of_relative_inode_number_bits;
+		inodes[ inode_index ] = NULL;
+	}
+	memory_free(
+	 inodes );
 
-			superblock = NULL;
-		}
-		inode_information_offset = superblock_offset + 2 * internal_volume->superblock->sector_size;
+	return( 1 );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+on_error:
+	for( inode_index = 0;
+	     inode_index < number_of_inodes;
+	     inode_index++ )
+	{
+		if( file_entries[ inode_index ] != NULL )
 		{
-			libcnotify_printf(
-			 "Reading inode information: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 allocation_group_index,
-			 inode_information_offset,
-			 inode_information_offset );
+			libfsxfs_file_entry_free(
+			 &( file_entries[ inode_index ] ),
+			 NULL );
 		}
-#endif
-		if( internal_volume->file_system == NULL )
+		if( inodes[ inode_index ] != NULL )
 		{
-			if( libfsxfs_file_system_initialize(
-			     &( internal_volume->file_system ),
-			     internal_volume->superblock->root_directory_inode_number,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create file system.",
-				 function );
-
-				goto on_error;
-			}
+			libfsxfs_inode_free(
+			 &( inodes[ inode_index ] ),
+			 NULL );
 		}
-		if( libfsxfs_file_system_read_inode_information(
-		     internal_volume->file_system,
-		     internal_volume->io_handle,
-		     file_io_handle,
-		     inode_information_offset,
-		     error ) != 1 )
+	}
+	memory_free(
+	 inodes );
+
+	return( -1 );
+}
+
+/* Retrieves the file entries of multiple inodes
+ * The inodes are read in order of their location in the volume, where nearby inodes are read at once
+ * The file entries must be set to NULL and are set to NULL for inodes that are not allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_file_entries_by_inodes(
+     libfsxfs_volume_t *volume,
+     const uint64_t *inode_numbers,
+     int number_of_inodes,
+     libfsxfs_file_entry_t **file_entries,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_file_entries_by_inodes";
+	int inode_index                             = 0;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( inode_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_inodes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of inodes value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( inode_index = 0;
+	     inode_index < number_of_inodes;
+	     inode_index++ )
+	{
+		if( file_entries[ inode_index ] != NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read inode B+ tree.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid file entry: %d value already set.",
+			 function,
+			 inode_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( superblock != NULL )
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_volume_get_file_entries_by_inodes(
+	     internal_volume,
+	     inode_numbers,
+	     number_of_inodes,
+	     file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		for( inode_index = 0;
+		     inode_index < number_of_inodes;
+		     inode_index++ )
 		{
-			if( libfsxfs_superblock_free(
-			     &superblock,
-			     error ) != 1 )
+			if( file_entries[ inode_index ] != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free superblock.",
-				 function );
-
-				goto on_error;
+				libfsxfs_file_entry_free(
+				 &( file_entries[ inode_index ] ),
+				 NULL );
 			}
 		}
-		allocation_group_size = (off64_t) internal_volume->io_handle->allocation_group_size * internal_volume->io_handle->block_size;
+		return( -1 );
+	}
+#endif
+	return( result );
+}
 
-		if( ( allocation_group_size == 0 )
-		 || ( superblock_offset > ( (off64_t) INT64_MAX - allocation_group_size ) ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid next superblock offset value out of bounds.",
-			 function );
+/* Retrieves the file entry for an UTF-8 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsxfs_internal_volume_get_file_entry_by_utf8_path(
+     libfsxfs_internal_volume_t *internal_volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	libfsxfs_inode_t *inode                     = NULL;
+	static char *function                       = "libfsxfs_internal_volume_get_file_entry_by_utf8_path";
+	uint64_t inode_number                       = 0;
+	int result                                  = 0;
 
-			goto on_error;
-		}
-		superblock_offset += allocation_group_size;
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
 
-		allocation_group_index++;
+		return( -1 );
 	}
-	while( allocation_group_index < internal_volume->superblock->number_of_allocation_groups );
+	result = libfsxfs_file_system_get_directory_entry_by_utf8_path(
+	          internal_volume->file_system,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          utf8_string,
+	          utf8_string_length,
+	          &inode_number,
+	          &inode,
+	          &directory_entry,
+	          error );
 
-	if( allocation_group_index != internal_volume->superblock->number_of_allocation_groups )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid last allocation group index value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-8 path.",
 		 function );
 
 		goto on_error;
 	}
-	return( 1 );
-
-on_error:
-	if( internal_volume->file_system != NULL )
+	else if( result != 0 )
 	{
-		libfsxfs_file_system_free(
-		 &( internal_volume->file_system ),
-		 NULL );
+		/* libfsxfs_file_entry_initialize takes over management of inode and directory_entry
+		 */
+		if( libfsxfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     inode_number,
+		     inode,
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	if( internal_volume->superblock != NULL )
+	return( result );
+
+on_error:
+	if( inode != NULL )
 	{
-		libfsxfs_superblock_free(
-		 &( internal_volume->superblock ),
+		libfsxfs_inode_free(
+		 &inode,
 		 NULL );
 	}
-	if( superblock != NULL )
+	if( directory_entry != NULL )
 	{
-		libfsxfs_superblock_free(
-		 &superblock,
+		libfsxfs_directory_entry_free(
+		 &directory_entry,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the format version
- * Returns 1 if successful or -1 on error
+/* Retrieves the file entry for an UTF-8 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-int libfsxfs_volume_get_format_version(
+int libfsxfs_volume_get_file_entry_by_utf8_path(
      libfsxfs_volume_t *volume,
-     uint8_t *format_version,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_format_version";
+	static char *function                       = "libfsxfs_volume_get_file_entry_by_utf8_path";
+	int result                                  = 0;
 
 	if( volume == NULL )
 	{
@@ -1205,30 +3422,30 @@ int libfsxfs_volume_get_format_version(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( internal_volume->io_handle == NULL )
+	if( file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_version == NULL )
+	if( *file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format version.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1236,16 +3453,32 @@ int libfsxfs_volume_get_format_version(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	*format_version = internal_volume->io_handle->format_version;
+	result = libfsxfs_internal_volume_get_file_entry_by_utf8_path(
+	          internal_volume,
+	          utf8_string,
+	          utf8_string_length,
+	          file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry by UTF-8 encoded path.",
+		 function );
 
+		result = -1;
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1253,29 +3486,36 @@ int libfsxfs_volume_get_format_version(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		libfsxfs_file_entry_free(
+		 file_entry,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the size of the UTF-8 encoded label
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves the file entry for an UTF-16 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-int libfsxfs_volume_get_utf8_label_size(
-     libfsxfs_volume_t *volume,
-     size_t *utf8_string_size,
+int libfsxfs_internal_volume_get_file_entry_by_utf16_path(
+     libfsxfs_internal_volume_t *internal_volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_utf8_label_size";
-	int result                                  = 1;
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	libfsxfs_inode_t *inode                     = NULL;
+	static char *function                       = "libfsxfs_internal_volume_get_file_entry_by_utf16_path";
+	uint64_t inode_number                       = 0;
+	int result                                  = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1286,79 +3526,83 @@ int libfsxfs_volume_get_utf8_label_size(
 
 		return( -1 );
 	}
-	internal_volume = (libfsxfs_internal_volume_t *) volume;
+	result = libfsxfs_file_system_get_directory_entry_by_utf16_path(
+	          internal_volume->file_system,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          utf16_string,
+	          utf16_string_length,
+	          &inode_number,
+	          &inode,
+	          &directory_entry,
+	          error );
 
-	if( internal_volume->superblock == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal volume - missing superblock.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-16 path.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	else if( result != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		/* libfsxfs_file_entry_initialize takes over management of inode and directory_entry
+		 */
+		if( libfsxfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     inode_number,
+		     inode,
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
 	}
-#endif
-	if( libfsxfs_superblock_get_utf8_volume_label_size(
-	     internal_volume->superblock,
-	     utf8_string_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 volume label string size.",
-		 function );
+	return( result );
 
-		result = -1;
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( directory_entry != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
-
-		return( -1 );
+		libfsxfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
 	}
-#endif
-	return( result );
+	return( -1 );
 }
 
-/* Retrieves the UTF-8 encoded label
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves the file entry for an UTF-16 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-int libfsxfs_volume_get_utf8_label(
+int libfsxfs_volume_get_file_entry_by_utf16_path(
      libfsxfs_volume_t *volume,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_utf8_label";
-	int result                                  = 1;
+	static char *function                       = "libfsxfs_volume_get_file_entry_by_utf16_path";
+	int result                                  = 0;
 
 	if( volume == NULL )
 	{
@@ -1373,19 +3617,30 @@ int libfsxfs_volume_get_utf8_label(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( internal_volume->superblock == NULL )
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal volume - missing superblock.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1393,29 +3648,32 @@ int libfsxfs_volume_get_utf8_label(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_superblock_get_utf8_volume_label(
-	     internal_volume->superblock,
-	     utf8_string,
-	     utf8_string_size,
-	     error ) != 1 )
+	result = libfsxfs_internal_volume_get_file_entry_by_utf16_path(
+	          internal_volume,
+	          utf16_string,
+	          utf16_string_length,
+	          file_entry,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 volume label string.",
+		 "%s: unable to retrieve file entry by UTF-16 encoded path.",
 		 function );
 
 		result = -1;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1423,29 +3681,36 @@ int libfsxfs_volume_get_utf8_label(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		libfsxfs_file_entry_free(
+		 file_entry,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
 	return( result );
 }
 
-/* Retrieves the size of the UTF-16 encoded label
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves a completed asynchronous read
+ * If wait_for_completion is set the function waits until a pending read has completed
+ * If the read failed, read_count is set to -1 and the error of the read is returned
+ * Returns 1 if successful, 0 if no completed read is available or -1 on error
  */
-int libfsxfs_volume_get_utf16_label_size(
-     libfsxfs_volume_t *volume,
-     size_t *utf16_string_size,
+int libfsxfs_internal_volume_get_completed_read(
+     libfsxfs_internal_volume_t *internal_volume,
+     uint8_t wait_for_completion,
+     intptr_t **user_value,
+     ssize_t *read_count,
      libcerror_error_t **error )
 {
-	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_utf16_label_size";
-	int result                                  = 1;
+	libfsxfs_read_request_t *read_request = NULL;
+	static char *function                 = "libfsxfs_internal_volume_get_completed_read";
+	int result                            = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1456,79 +3721,121 @@ int libfsxfs_volume_get_utf16_label_size(
 
 		return( -1 );
 	}
-	internal_volume = (libfsxfs_internal_volume_t *) volume;
-
-	if( internal_volume->superblock == NULL )
+	if( internal_volume->read_queue == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal volume - missing superblock.",
+		 "%s: invalid volume - missing read queue.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( user_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid user value.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libfsxfs_superblock_get_utf16_volume_label_size(
-	     internal_volume->superblock,
-	     utf16_string_size,
-	     error ) != 1 )
+	if( read_count == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 volume label string size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read count.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	result = libfsxfs_read_queue_pop_completed_request(
+	          internal_volume->read_queue,
+	          wait_for_completion,
+	          &read_request,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve completed read request.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		*user_value = read_request->user_value;
+		*read_count = read_request->read_count;
+
+		if( read_request->read_count < 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = read_request->read_error;
+
+				read_request->read_error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_request->offset,
+			 read_request->offset );
+
+			result = -1;
+		}
+		if( libfsxfs_read_request_free(
+		     &read_request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read request.",
+			 function );
+
+			goto on_error;
+		}
 	}
-#endif
 	return( result );
+
+on_error:
+	if( read_request != NULL )
+	{
+		libfsxfs_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the UTF-16 encoded label
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves a completed asynchronous read without waiting
+ * The user value is the value that was passed to libfsxfs_file_entry_read_async
+ * If the read failed, read_count is set to -1 and -1 is returned
+ * Returns 1 if successful, 0 if no completed read is available or -1 on error
  */
-int libfsxfs_volume_get_utf16_label(
+int libfsxfs_volume_poll_read(
      libfsxfs_volume_t *volume,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     intptr_t **user_value,
+     ssize_t *read_count,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_utf16_label";
-	int result                                  = 1;
+	static char *function                       = "libfsxfs_volume_poll_read";
+	int result                                  = 0;
 
 	if( volume == NULL )
 	{
@@ -1536,24 +3843,13 @@ int libfsxfs_volume_get_utf16_label(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
-		 function );
-
-		return( -1 );
-	}
-	internal_volume = (libfsxfs_internal_volume_t *) volume;
-
-	if( internal_volume->superblock == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal volume - missing superblock.",
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
@@ -1569,17 +3865,20 @@ int libfsxfs_volume_get_utf16_label(
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_superblock_get_utf16_volume_label(
-	     internal_volume->superblock,
-	     utf16_string,
-	     utf16_string_size,
-	     error ) != 1 )
+	result = libfsxfs_internal_volume_get_completed_read(
+	          internal_volume,
+	          0,
+	          user_value,
+	          read_count,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 volume label string.",
+		 "%s: unable to retrieve completed read.",
 		 function );
 
 		result = -1;
@@ -1602,18 +3901,21 @@ int libfsxfs_volume_get_utf16_label(
 	return( result );
 }
 
-/* Retrieves the root directory file entry
- * Returns 1 if successful or -1 on error
+/* Retrieves a completed asynchronous read
+ * The function waits until a pending read has completed
+ * The user value is the value that was passed to libfsxfs_file_entry_read_async
+ * If the read failed, read_count is set to -1 and -1 is returned
+ * Returns 1 if successful, 0 if no reads are pending or -1 on error
  */
-int libfsxfs_volume_get_root_directory(
+int libfsxfs_volume_wait_for_read(
      libfsxfs_volume_t *volume,
-     libfsxfs_file_entry_t **file_entry,
+     intptr_t **user_value,
+     ssize_t *read_count,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_t *inode                     = NULL;
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_root_directory";
-	int result                                  = 1;
+	static char *function                       = "libfsxfs_volume_wait_for_read";
+	int result                                  = 0;
 
 	if( volume == NULL )
 	{
@@ -1628,41 +3930,8 @@ int libfsxfs_volume_get_root_directory(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( internal_volume->superblock == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal volume - missing superblock.",
-		 function );
-
-		return( -1 );
-	}
-	if( file_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1670,55 +3939,32 @@ int libfsxfs_volume_get_root_directory(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_file_system_get_inode_by_number(
-	     internal_volume->file_system,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     internal_volume->superblock->root_directory_inode_number,
-	     &inode,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 ".",
-		 function,
-		 internal_volume->superblock->root_directory_inode_number );
+	result = libfsxfs_internal_volume_get_completed_read(
+	          internal_volume,
+	          1,
+	          user_value,
+	          read_count,
+	          error );
 
-		result = -1;
-	}
-	else if( libfsxfs_file_entry_initialize(
-	          file_entry,
-	          internal_volume->io_handle,
-	          internal_volume->file_io_handle,
-	          internal_volume->file_system,
-	          internal_volume->superblock->root_directory_inode_number,
-	          inode,
-	          NULL,
-	          error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve completed read.",
 		 function );
 
-		libfsxfs_inode_free(
-		 &inode,
-		 NULL );
-
 		result = -1;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1726,89 +3972,75 @@ int libfsxfs_volume_get_root_directory(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		libfsxfs_file_entry_free(
-		 file_entry,
-		 NULL );
-
 		return( -1 );
 	}
 #endif
 	return( result );
 }
 
-/* Retrieves the file entry of a specific inode
- * Returns 1 if successful or -1 on error
+/* Creates a file entry for an inode and passes it to the callback function of the inode iteration
+ * The file entry uses the file IO handle the inode was read with, which is the file IO handle
+ * of the thread when the inodes are scanned by multiple threads
+ * This function takes over management of the inode
+ * Returns 1 to continue, 0 to stop or -1 on error
  */
-int libfsxfs_internal_volume_get_file_entry_by_inode(
-     libfsxfs_internal_volume_t *internal_volume,
+int libfsxfs_internal_volume_iterate_inodes_callback(
      uint64_t inode_number,
-     libfsxfs_file_entry_t **file_entry,
+     libfsxfs_inode_t *inode,
+     libbfio_handle_t *file_io_handle,
+     void *callback_data,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_t *inode = NULL;
-	static char *function   = "libfsxfs_internal_volume_get_file_entry_by_inode";
+	libfsxfs_file_entry_t *file_entry                 = NULL;
+	libfsxfs_volume_iterate_inodes_context_t *context = NULL;
+	static char *function                             = "libfsxfs_internal_volume_iterate_inodes_callback";
+	int result                                        = 0;
 
-	if( internal_volume == NULL )
+	if( callback_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 "%s: invalid callback data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( file_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
+	context = (libfsxfs_volume_iterate_inodes_context_t *) callback_data;
 
-		return( -1 );
-	}
-	if( *file_entry != NULL )
+	if( context->internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid callback data - missing internal volume.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfsxfs_file_system_get_inode_by_number(
-	     internal_volume->file_system,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     inode_number,
-	     &inode,
-	     error ) != 1 )
+	if( context->callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 ".",
-		 function,
-		 inode_number );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid callback data - missing callback function.",
+		 function );
 
 		goto on_error;
 	}
 	/* libfsxfs_file_entry_initialize takes over management of inode
 	 */
 	if( libfsxfs_file_entry_initialize(
-	     file_entry,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     internal_volume->file_system,
+	     &file_entry,
+	     context->internal_volume->io_handle,
+	     file_io_handle,
+	     context->internal_volume->file_system,
 	     inode_number,
 	     inode,
 	     NULL,
@@ -1818,139 +4050,60 @@ int libfsxfs_internal_volume_get_file_entry_by_inode(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry.",
-		 function );
+		 "%s: unable to create file entry: %" PRIu64 ".",
+		 function,
+		 inode_number );
 
 		goto on_error;
 	}
-	return( 1 );
-
-on_error:
-	if( inode != NULL )
-	{
-		libfsxfs_inode_free(
-		 &inode,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Retrieves the file entry of a specific inode
- * Returns 1 if successful or -1 on error
- */
-int libfsxfs_volume_get_file_entry_by_inode(
-     libfsxfs_volume_t *volume,
-     uint64_t inode_number,
-     libfsxfs_file_entry_t **file_entry,
-     libcerror_error_t **error )
-{
-	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_file_entry_by_inode";
-	int result                                  = 1;
-
-	if( volume == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
-		 function );
-
-		return( -1 );
-	}
-	internal_volume = (libfsxfs_internal_volume_t *) volume;
-
-	if( file_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
+	inode = NULL;
 
-		return( -1 );
-	}
-#endif
-	if( libfsxfs_internal_volume_get_file_entry_by_inode(
-	     internal_volume,
-	     inode_number,
-	     file_entry,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 ".",
-		 function,
-		 inode_number );
+	result = context->callback_function(
+	          file_entry,
+	          context->callback_data,
+	          error );
 
-		result = -1;
-	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
+	if( libfsxfs_file_entry_free(
+	     &file_entry,
 	     error ) != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
-
-		libfsxfs_file_entry_free(
-		 file_entry,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry: %" PRIu64 ".",
+		 function,
+		 inode_number );
 
-		return( -1 );
+		result = -1;
 	}
-#endif
 	return( result );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the file entry for an UTF-8 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Iterates the file entries of all allocated inodes
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_internal_volume_get_file_entry_by_utf8_path(
+int libfsxfs_internal_volume_iterate_inodes(
      libfsxfs_internal_volume_t *internal_volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsxfs_file_entry_t **file_entry,
+     int (*callback_function)(
+            libfsxfs_file_entry_t *file_entry,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_entry_t *directory_entry = NULL;
-	libfsxfs_inode_t *inode                     = NULL;
-	static char *function                       = "libfsxfs_internal_volume_get_file_entry_by_utf8_path";
-	uint64_t inode_number                       = 0;
-	int result                                  = 0;
+	libfsxfs_volume_iterate_inodes_context_t context;
+
+	static char *function = "libfsxfs_internal_volume_iterate_inodes";
 
 	if( internal_volume == NULL )
 	{
@@ -1963,83 +4116,61 @@ int libfsxfs_internal_volume_get_file_entry_by_utf8_path(
 
 		return( -1 );
 	}
-	result = libfsxfs_file_system_get_directory_entry_by_utf8_path(
-	          internal_volume->file_system,
-	          internal_volume->io_handle,
-	          internal_volume->file_io_handle,
-	          utf8_string,
-	          utf8_string_length,
-	          &inode_number,
-	          &inode,
-	          &directory_entry,
-	          error );
-
-	if( result == -1 )
+	if( internal_volume->superblock == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry by UTF-8 path.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
 		 function );
 
-		goto on_error;
-	}
-	else if( result != 0 )
-	{
-		/* libfsxfs_file_entry_initialize takes over management of inode and directory_entry
-		 */
-		if( libfsxfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->file_system,
-		     inode_number,
-		     inode,
-		     directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
-
-			goto on_error;
-		}
+		return( -1 );
 	}
-	return( result );
+	context.internal_volume   = internal_volume;
+	context.callback_function = callback_function;
+	context.callback_data     = callback_data;
 
-on_error:
-	if( inode != NULL )
-	{
-		libfsxfs_inode_free(
-		 &inode,
-		 NULL );
-	}
-	if( directory_entry != NULL )
+	if( libfsxfs_file_system_iterate_inodes(
+	     internal_volume->file_system,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->superblock->number_of_allocation_groups,
+	     &libfsxfs_internal_volume_iterate_inodes_callback,
+	     (void *) &context,
+	     error ) == -1 )
 	{
-		libfsxfs_directory_entry_free(
-		 &directory_entry,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to iterate inodes.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves the file entry for an UTF-8 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Iterates the file entries of all allocated inodes
+ * The inodes are read per inode chunk in order of the inode B+ trees of the allocation groups
+ * The callback function is called with the file entry of each allocated inode and returns
+ * 1 to continue, 0 to stop or -1 on error. The file entry is freed after the callback function
+ * returns and the callback function must not call other volume functions
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_get_file_entry_by_utf8_path(
+int libfsxfs_volume_iterate_inodes(
      libfsxfs_volume_t *volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsxfs_file_entry_t **file_entry,
+     int (*callback_function)(
+            libfsxfs_file_entry_t *file_entry,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_file_entry_by_utf8_path";
-	int result                                  = 0;
+	static char *function                       = "libfsxfs_volume_iterate_inodes";
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -2054,24 +4185,13 @@ int libfsxfs_volume_get_file_entry_by_utf8_path(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
+	if( callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 "%s: invalid callback function.",
 		 function );
 
 		return( -1 );
@@ -2091,20 +4211,17 @@ int libfsxfs_volume_get_file_entry_by_utf8_path(
 		return( -1 );
 	}
 #endif
-	result = libfsxfs_internal_volume_get_file_entry_by_utf8_path(
-	          internal_volume,
-	          utf8_string,
-	          utf8_string_length,
-	          file_entry,
-	          error );
-
-	if( result == -1 )
+	if( libfsxfs_internal_volume_iterate_inodes(
+	     internal_volume,
+	     callback_function,
+	     callback_data,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry by UTF-8 encoded path.",
+		 "%s: unable to iterate inodes.",
 		 function );
 
 		result = -1;
@@ -2121,31 +4238,29 @@ int libfsxfs_volume_get_file_entry_by_utf8_path(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		libfsxfs_file_entry_free(
-		 file_entry,
-		 NULL );
-
 		return( -1 );
 	}
 #endif
 	return( result );
 }
 
-/* Retrieves the file entry for an UTF-16 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Iterates the file entries of all allocated inodes using multiple threads
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_internal_volume_get_file_entry_by_utf16_path(
+int libfsxfs_internal_volume_iterate_inodes_parallel(
      libfsxfs_internal_volume_t *internal_volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfsxfs_file_entry_t **file_entry,
+     int number_of_threads,
+     int (*callback_function)(
+            libfsxfs_file_entry_t *file_entry,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_entry_t *directory_entry = NULL;
-	libfsxfs_inode_t *inode                     = NULL;
-	static char *function                       = "libfsxfs_internal_volume_get_file_entry_by_utf16_path";
-	uint64_t inode_number                       = 0;
-	int result                                  = 0;
+	libfsxfs_volume_iterate_inodes_context_t context;
+
+	libfsxfs_inode_scanner_t *inode_scanner = NULL;
+	static char *function                   = "libfsxfs_internal_volume_iterate_inodes_parallel";
 
 	if( internal_volume == NULL )
 	{
@@ -2158,83 +4273,103 @@ int libfsxfs_internal_volume_get_file_entry_by_utf16_path(
 
 		return( -1 );
 	}
-	result = libfsxfs_file_system_get_directory_entry_by_utf16_path(
-	          internal_volume->file_system,
-	          internal_volume->io_handle,
-	          internal_volume->file_io_handle,
-	          utf16_string,
-	          utf16_string_length,
-	          &inode_number,
-	          &inode,
-	          &directory_entry,
-	          error );
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	context.internal_volume   = internal_volume;
+	context.callback_function = callback_function;
+	context.callback_data     = callback_data;
+
+	if( libfsxfs_inode_scanner_initialize(
+	     &inode_scanner,
+	     internal_volume->file_system,
+	     internal_volume->io_handle,
+	     &libfsxfs_internal_volume_iterate_inodes_callback,
+	     (void *) &context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_scanner_scan(
+	     inode_scanner,
+	     internal_volume->file_io_handle,
+	     internal_volume->superblock->number_of_allocation_groups,
+	     number_of_threads,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry by UTF-16 path.",
+		 "%s: unable to scan inodes.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	if( libfsxfs_inode_scanner_free(
+	     &inode_scanner,
+	     error ) != 1 )
 	{
-		/* libfsxfs_file_entry_initialize takes over management of inode and directory_entry
-		 */
-		if( libfsxfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->file_system,
-		     inode_number,
-		     inode,
-		     directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free inode scanner.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	return( result );
+	return( 1 );
 
 on_error:
-	if( inode != NULL )
-	{
-		libfsxfs_inode_free(
-		 &inode,
-		 NULL );
-	}
-	if( directory_entry != NULL )
+	if( inode_scanner != NULL )
 	{
-		libfsxfs_directory_entry_free(
-		 &directory_entry,
+		libfsxfs_inode_scanner_free(
+		 &inode_scanner,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the file entry for an UTF-16 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Iterates the file entries of all allocated inodes using multiple threads
+ * Every allocation group is scanned as an independent task and large allocation groups
+ * are split into ranges of inode chunks. The tasks are processed by number_of_threads threads,
+ * each with its own file IO handle. Without multi-threading support or if number_of_threads
+ * is 0 or 1 the inodes are iterated sequentially
+ * The callback function is called concurrently from multiple threads, in no particular order,
+ * and must be thread-safe. It returns 1 to continue, 0 to stop or -1 on error. The file entry
+ * is freed after the callback function returns and the callback function must not call other
+ * volume functions
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_get_file_entry_by_utf16_path(
+int libfsxfs_volume_iterate_inodes_parallel(
      libfsxfs_volume_t *volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfsxfs_file_entry_t **file_entry,
+     int number_of_threads,
+     int (*callback_function)(
+            libfsxfs_file_entry_t *file_entry,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_file_entry_by_utf16_path";
-	int result                                  = 0;
+	static char *function                       = "libfsxfs_volume_iterate_inodes_parallel";
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -2249,24 +4384,25 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBFSXFS_MAXIMUM_NUMBER_OF_READ_THREADS ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+	if( callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
 		 function );
 
 		return( -1 );
@@ -2286,20 +4422,18 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
 		return( -1 );
 	}
 #endif
-	result = libfsxfs_internal_volume_get_file_entry_by_utf16_path(
-	          internal_volume,
-	          utf16_string,
-	          utf16_string_length,
-	          file_entry,
-	          error );
-
-	if( result == -1 )
+	if( libfsxfs_internal_volume_iterate_inodes_parallel(
+	     internal_volume,
+	     number_of_threads,
+	     callback_function,
+	     callback_data,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry by UTF-16 encoded path.",
+		 "%s: unable to iterate inodes.",
 		 function );
 
 		result = -1;
@@ -2316,10 +4450,6 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		libfsxfs_file_entry_free(
-		 file_entry,
-		 NULL );
-
 		return( -1 );
 	}
 #endif
@@ -25,7 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_block_cache.h"
 #include "libfsxfs_extern.h"
+#include "libfsxfs_file_io_handle_pool.h"
 #include "libfsxfs_file_system.h"
 #include "libfsxfs_inode_btree.h"
 #include "libfsxfs_io_handle.h"
@@ -33,6 +35,8 @@
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcthreads.h"
+#include "libfsxfs_memory_mapped_file.h"
+#include "libfsxfs_read_queue.h"
 #include "libfsxfs_superblock.h"
 #include "libfsxfs_types.h"
 
@@ -60,6 +64,58 @@ struct libfsxfs_internal_volume
 	 */
 	libfsxfs_io_handle_t *io_handle;
 
+	/* The metadata block cache
+	 */
+	libfsxfs_block_cache_t *metadata_block_cache;
+
+	/* The inode cluster cache
+	 */
+	libfsxfs_block_cache_t *inode_cluster_cache;
+
+	/* The maximum number of cached inodes
+	 */
+	int maximum_number_of_cached_inodes;
+
+	/* The maximum number of cached directory entries used for path resolution
+	 */
+	int maximum_number_of_cached_directory_entries;
+
+	/* Value to indicate if the allocation group inode information should be read on demand
+	 */
+	uint8_t read_allocation_groups_on_demand;
+
+	/* The number of threads used to read the allocation group inode information
+	 */
+	int number_of_read_threads;
+
+	/* The number of file IO handles used to read file entry data
+	 */
+	int number_of_file_io_handles;
+
+	/* The file IO handle pool
+	 */
+	libfsxfs_file_io_handle_pool_t *file_io_handle_pool;
+
+	/* The maximum readahead size used for sequential reads of file entry data
+	 */
+	size_t maximum_readahead_size;
+
+	/* Value to indicate if the volume should be memory mapped when opened by filename
+	 */
+	uint8_t use_memory_mapping;
+
+	/* The memory mapped file
+	 */
+	libfsxfs_memory_mapped_file_t *memory_mapped_file;
+
+	/* The number of asynchronous reads that are processed concurrently, 0 if asynchronous reads are disabled
+	 */
+	int read_queue_depth;
+
+	/* The read queue
+	 */
+	libfsxfs_read_queue_t *read_queue;
+
 	/* The file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
@@ -79,6 +135,26 @@ struct libfsxfs_internal_volume
 #endif
 };
 
+typedef struct libfsxfs_volume_iterate_inodes_context libfsxfs_volume_iterate_inodes_context_t;
+
+struct libfsxfs_volume_iterate_inodes_context
+{
+	/* The internal volume
+	 */
+	libfsxfs_internal_volume_t *internal_volume;
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       libfsxfs_file_entry_t *file_entry,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The callback data
+	 */
+	void *callback_data;
+};
+
 LIBFSXFS_EXTERN \
 int libfsxfs_volume_initialize(
      libfsxfs_volume_t **volume,
@@ -94,6 +170,54 @@ int libfsxfs_volume_signal_abort(
      libfsxfs_volume_t *volume,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_maximum_number_of_cached_inodes(
+     libfsxfs_volume_t *volume,
+     int maximum_number_of_cached_inodes,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_maximum_number_of_cached_directory_entries(
+     libfsxfs_volume_t *volume,
+     int maximum_number_of_cached_directory_entries,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_read_allocation_groups_on_demand(
+     libfsxfs_volume_t *volume,
+     uint8_t read_on_demand,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_number_of_read_threads(
+     libfsxfs_volume_t *volume,
+     int number_of_read_threads,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_number_of_file_io_handles(
+     libfsxfs_volume_t *volume,
+     int number_of_file_io_handles,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_maximum_readahead_size(
+     libfsxfs_volume_t *volume,
+     size_t maximum_readahead_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_use_memory_mapping(
+     libfsxfs_volume_t *volume,
+     uint8_t use_memory_mapping,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_read_queue_depth(
+     libfsxfs_volume_t *volume,
+     int read_queue_depth,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 int libfsxfs_volume_open(
      libfsxfs_volume_t *volume,
@@ -180,6 +304,21 @@ int libfsxfs_volume_get_file_entry_by_inode(
      libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int libfsxfs_internal_volume_get_file_entries_by_inodes(
+     libfsxfs_internal_volume_t *internal_volume,
+     const uint64_t *inode_numbers,
+     int number_of_inodes,
+     libfsxfs_file_entry_t **file_entries,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_file_entries_by_inodes(
+     libfsxfs_volume_t *volume,
+     const uint64_t *inode_numbers,
+     int number_of_inodes,
+     libfsxfs_file_entry_t **file_entries,
+     libcerror_error_t **error );
+
 int libfsxfs_internal_volume_get_file_entry_by_utf8_path(
      libfsxfs_internal_volume_t *internal_volume,
      const uint8_t *utf8_string,
@@ -210,6 +349,74 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
      libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int libfsxfs_internal_volume_get_completed_read(
+     libfsxfs_internal_volume_t *internal_volume,
+     uint8_t wait_for_completion,
+     intptr_t **user_value,
+     ssize_t *read_count,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_poll_read(
+     libfsxfs_volume_t *volume,
+     intptr_t **user_value,
+     ssize_t *read_count,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_wait_for_read(
+     libfsxfs_volume_t *volume,
+     intptr_t **user_value,
+     ssize_t *read_count,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_iterate_inodes_callback(
+     uint64_t inode_number,
+     libfsxfs_inode_t *inode,
+     libbfio_handle_t *file_io_handle,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_iterate_inodes(
+     libfsxfs_internal_volume_t *internal_volume,
+     int (*callback_function)(
+            libfsxfs_file_entry_t *file_entry,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_iterate_inodes(
+     libfsxfs_volume_t *volume,
+     int (*callback_function)(
+            libfsxfs_file_entry_t *file_entry,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_iterate_inodes_parallel(
+     libfsxfs_internal_volume_t *internal_volume,
+     int number_of_threads,
+     int (*callback_function)(
+            libfsxfs_file_entry_t *file_entry,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_iterate_inodes_parallel(
+     libfsxfs_volume_t *volume,
+     int number_of_threads,
+     int (*callback_function)(
+            libfsxfs_file_entry_t *file_entry,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
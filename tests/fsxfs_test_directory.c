@@ -0,0 +1,1472 @@
+/*
+ * Library directory type test program
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcdata.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_directory.h"
+#include "../libfsxfs/libfsxfs_directory_entry.h"
+#include "../libfsxfs/libfsxfs_extent.h"
+#include "../libfsxfs/libfsxfs_extent_map.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+
+/* The directory blocks consist of 2 blocks of 64 bytes:
+ * blocks 0 and 1 contain a single block directory (XD2B) with a hash index of 4 entries,
+ * blocks 2 and 3 contain a data block (XD2D) with the entries "a", "b", "c" and "d",
+ * blocks 4 and 5 contain a leaf (LEAF1) of the data block with a stale entry,
+ * blocks 6 and 7 contain a node that refers to the leafs (LEAFN) in blocks 8 and 9, and 10 and 11,
+ * where the entries with name hash 0x00000200 continue from the first into the second leaf
+ */
+uint8_t fsxfs_test_directory_data1[ 768 ] = {
+	0x58, 0x44, 0x32, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x01, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x58, 0x44, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x01, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x01, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xf1, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xbe, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+	0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0xd2, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_directory_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsxfs_directory_t *directory = NULL;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_free(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory = (libfsxfs_directory_t *) 0x12345678UL;
+
+	result = libfsxfs_directory_initialize(
+	          &directory,
+	          &error );
+
+	directory = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libfsxfs_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_directory_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_directory_get_entry_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_get_entry_by_utf8_name(
+     void )
+{
+	uint8_t name[ 8 ] = { 'e', 'n', 't', 'r', 'y', '0', '0', '0' };
+
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_directory_t *directory             = NULL;
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	int entry_index                             = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 300;
+	     entry_index++ )
+	{
+		name[ 5 ] = (uint8_t) ( '0' + ( ( entry_index / 100 ) % 10 ) );
+		name[ 6 ] = (uint8_t) ( '0' + ( ( entry_index / 10 ) % 10 ) );
+		name[ 7 ] = (uint8_t) ( '0' + ( entry_index % 10 ) );
+
+		result = libfsxfs_directory_append_entry_values(
+		          directory,
+		          (uint64_t) ( 1000 + entry_index ),
+		          name,
+		          8,
+		          1,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	for( entry_index = 0;
+	     entry_index < 300;
+	     entry_index++ )
+	{
+		name[ 5 ] = (uint8_t) ( '0' + ( ( entry_index / 100 ) % 10 ) );
+		name[ 6 ] = (uint8_t) ( '0' + ( ( entry_index / 10 ) % 10 ) );
+		name[ 7 ] = (uint8_t) ( '0' + ( entry_index % 10 ) );
+
+		result = libfsxfs_directory_get_entry_by_utf8_name(
+		          directory,
+		          name,
+		          8,
+		          directory_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "directory_entry->inode_number",
+		 directory_entry->inode_number,
+		 (uint64_t) ( 1000 + entry_index ) );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsxfs_directory_get_entry_by_utf8_name(
+	          directory,
+	          (uint8_t *) "entry300",
+	          8,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an appended entry is found after the hash index was built
+	 */
+	result = libfsxfs_directory_append_entry_values(
+	          directory,
+	          1300,
+	          (uint8_t *) "entry300",
+	          8,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_get_entry_by_utf8_name(
+	          directory,
+	          (uint8_t *) "entry300",
+	          8,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "directory_entry->inode_number",
+	 directory_entry->inode_number,
+	 (uint64_t) 1300 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an emptied directory has no entries
+	 */
+	result = libfsxfs_directory_empty(
+	          directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_get_entry_by_utf8_name(
+	          directory,
+	          (uint8_t *) "entry300",
+	          8,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_get_entry_by_utf8_name(
+	          NULL,
+	          name,
+	          8,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_free(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsxfs_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_directory_get_entry_by_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_get_entry_by_utf16_name(
+     void )
+{
+	uint16_t utf16_string[ 5 ] = { 'f', 'i', 'l', 'e', 0 };
+
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_directory_t *directory             = NULL;
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_append_entry_values(
+	          directory,
+	          131,
+	          (uint8_t *) "dir",
+	          3,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_append_entry_values(
+	          directory,
+	          132,
+	          (uint8_t *) "file",
+	          4,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_directory_get_entry_by_utf16_name(
+	          directory,
+	          utf16_string,
+	          4,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "directory_entry->inode_number",
+	 directory_entry->inode_number,
+	 (uint64_t) 132 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "directory_entry->file_type",
+	 directory_entry->file_type,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_get_entry_by_utf16_name(
+	          directory,
+	          utf16_string,
+	          3,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_get_entry_by_utf16_name(
+	          NULL,
+	          utf16_string,
+	          4,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_free(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsxfs_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Creates a directory inode with the data extents of the test data
+ * The extent values consist of the logical block number, physical block number and number of blocks of each extent
+ * The data extent map is created as it would be when the inode is read
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_directory_create_inode(
+     libfsxfs_inode_t **inode,
+     const uint64_t *extent_values,
+     int number_of_extents,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *extent = NULL;
+	int entry_index           = 0;
+	int extent_index          = 0;
+
+	if( libfsxfs_inode_initialize(
+	     inode,
+	     512,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Directory with data fork type extents
+	 */
+	( *inode )->file_mode = 0x41ed;
+	( *inode )->fork_type = 2;
+
+	if( libcdata_array_initialize(
+	     &( ( *inode )->data_extents_array ),
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libfsxfs_extent_initialize(
+		     &extent,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		extent->logical_block_number  = extent_values[ ( extent_index * 3 ) ];
+		extent->physical_block_number = extent_values[ ( extent_index * 3 ) + 1 ];
+		extent->number_of_blocks      = (uint32_t) extent_values[ ( extent_index * 3 ) + 2 ];
+
+		if( libcdata_array_append_entry(
+		     ( *inode )->data_extents_array,
+		     &entry_index,
+		     (intptr_t *) extent,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		extent = NULL;
+	}
+	( *inode )->number_of_data_extents = (uint32_t) number_of_extents;
+
+	if( libfsxfs_extent_map_initialize(
+	     &( ( *inode )->data_extent_map ),
+	     ( *inode )->data_extents_array,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( extent != NULL )
+	{
+		libfsxfs_extent_free(
+		 &extent,
+		 NULL );
+	}
+	if( *inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libfsxfs_directory_get_leaf_entry_index_by_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_get_leaf_entry_index_by_name_hash(
+     void )
+{
+	uint8_t entries_data[ 32 ] = {
+		0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04,
+		0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x08 };
+
+	libcerror_error_t *error = NULL;
+	uint16_t entry_index     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_directory_get_leaf_entry_index_by_name_hash(
+	          entries_data,
+	          4,
+	          0x00000200UL,
+	          &entry_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_get_leaf_entry_index_by_name_hash(
+	          entries_data,
+	          4,
+	          0x00000050UL,
+	          &entry_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_get_leaf_entry_index_by_name_hash(
+	          entries_data,
+	          4,
+	          0x00000250UL,
+	          &entry_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "entry_index",
+	 entry_index,
+	 3 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_get_leaf_entry_index_by_name_hash(
+	          entries_data,
+	          4,
+	          0x00000400UL,
+	          &entry_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "entry_index",
+	 entry_index,
+	 4 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_get_leaf_entry_index_by_name_hash(
+	          NULL,
+	          0,
+	          0x00000200UL,
+	          &entry_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_get_leaf_entry_index_by_name_hash(
+	          NULL,
+	          4,
+	          0x00000200UL,
+	          &entry_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_get_leaf_entry_index_by_name_hash(
+	          entries_data,
+	          4,
+	          0x00000200UL,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_directory_read_entries_by_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_read_entries_by_name_hash(
+     void )
+{
+	/* The single block directory is stored in blocks 0 and 1
+	 */
+	uint64_t block_extent_values[ 3 ] = {
+		0, 0, 2 };
+
+	/* The data block is stored in blocks 2 and 3 and the leaf in blocks 4 and 5
+	 */
+	uint64_t leaf_extent_values[ 6 ] = {
+		0, 2, 2,
+		0x20000000UL, 4, 2 };
+
+	/* The data block is stored in blocks 2 and 3 and the node and leafs in blocks 6 to 11
+	 */
+	uint64_t node_extent_values[ 6 ] = {
+		0, 2, 2,
+		0x20000000UL, 6, 6 };
+
+	/* Each test case consists of the directory type (0 = block, 1 = leaf, 2 = node), the name hash,
+	 * the expected number of entries and the expected inode numbers
+	 */
+	uint64_t test_values[ 13 ][ 5 ] = {
+		{ 0, 0x00000100UL, 1, 0x10, 0 },
+		{ 0, 0x00000200UL, 2, 0x11, 0x12 },
+		{ 0, 0x0000002eUL, 0, 0, 0 },
+		{ 0, 0x00000150UL, 0, 0, 0 },
+		{ 1, 0x00000100UL, 1, 0x20, 0 },
+		{ 1, 0x00000300UL, 1, 0x22, 0 },
+		{ 1, 0x00000250UL, 0, 0, 0 },
+		{ 1, 0x00000400UL, 0, 0, 0 },
+		{ 2, 0x00000200UL, 2, 0x21, 0x22 },
+		{ 2, 0x00000100UL, 1, 0x20, 0 },
+		{ 2, 0x00000400UL, 1, 0x23, 0 },
+		{ 2, 0x00000150UL, 0, 0, 0 },
+		{ 2, 0x00000500UL, 0, 0, 0 } };
+
+	libbfio_handle_t *file_io_handle            = NULL;
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_directory_t *directory             = NULL;
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	libfsxfs_inode_t *inodes[ 3 ]               = { NULL, NULL, NULL };
+	libfsxfs_io_handle_t *io_handle             = NULL;
+	int entry_index                             = 0;
+	int inode_index                             = 0;
+	int number_of_entries                       = 0;
+	int result                                  = 0;
+	int test_index                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version                       = 4;
+	io_handle->block_size                           = 64;
+	io_handle->directory_block_size                 = 128;
+	io_handle->allocation_group_size                = 256;
+	io_handle->number_of_relative_block_number_bits = 8;
+
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsxfs_test_directory_data1,
+	          768,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_directory_create_inode(
+	          &( inodes[ 0 ] ),
+	          block_extent_values,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_directory_create_inode(
+	          &( inodes[ 1 ] ),
+	          leaf_extent_values,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_directory_create_inode(
+	          &( inodes[ 2 ] ),
+	          node_extent_values,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 13;
+	     test_index++ )
+	{
+		result = libfsxfs_directory_read_entries_by_name_hash(
+		          directory,
+		          io_handle,
+		          file_io_handle,
+		          inodes[ test_values[ test_index ][ 0 ] ],
+		          (uint32_t) test_values[ test_index ][ 1 ],
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_directory_get_number_of_entries(
+		          directory,
+		          &number_of_entries,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_entries",
+		 number_of_entries,
+		 (int) test_values[ test_index ][ 2 ] );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			result = libfsxfs_directory_get_entry_by_index(
+			          directory,
+			          entry_index,
+			          directory_entry,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "directory_entry->inode_number",
+			 directory_entry->inode_number,
+			 test_values[ test_index ][ 3 + entry_index ] );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test a directory without a hash index
+	 */
+	inodes[ 0 ]->fork_type = 1;
+
+	result = libfsxfs_directory_read_entries_by_name_hash(
+	          directory,
+	          io_handle,
+	          file_io_handle,
+	          inodes[ 0 ],
+	          0x00000100UL,
+	          &error );
+
+	inodes[ 0 ]->fork_type = 2;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_read_entries_by_name_hash(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          inodes[ 0 ],
+	          0x00000100UL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_read_entries_by_name_hash(
+	          directory,
+	          NULL,
+	          file_io_handle,
+	          inodes[ 0 ],
+	          0x00000100UL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_read_entries_by_name_hash(
+	          directory,
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          0x00000100UL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_free(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( inode_index = 0;
+	     inode_index < 3;
+	     inode_index++ )
+	{
+		result = libfsxfs_inode_free(
+		          &( inodes[ inode_index ] ),
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsxfs_directory_free(
+		 &directory,
+		 NULL );
+	}
+	for( inode_index = 0;
+	     inode_index < 3;
+	     inode_index++ )
+	{
+		if( inodes[ inode_index ] != NULL )
+		{
+			libfsxfs_inode_free(
+			 &( inodes[ inode_index ] ),
+			 NULL );
+		}
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_initialize",
+	 fsxfs_test_directory_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_free",
+	 fsxfs_test_directory_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_get_leaf_entry_index_by_name_hash",
+	 fsxfs_test_directory_get_leaf_entry_index_by_name_hash );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_read_entries_by_name_hash",
+	 fsxfs_test_directory_read_entries_by_name_hash );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_get_entry_by_utf8_name",
+	 fsxfs_test_directory_get_entry_by_utf8_name );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_get_entry_by_utf16_name",
+	 fsxfs_test_directory_get_entry_by_utf16_name );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
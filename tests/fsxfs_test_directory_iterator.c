@@ -0,0 +1,1161 @@
+/*
+ * Library directory_iterator type test program
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcdata.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_directory_entry.h"
+#include "../libfsxfs/libfsxfs_directory_iterator.h"
+#include "../libfsxfs/libfsxfs_extent.h"
+#include "../libfsxfs/libfsxfs_extent_map.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+
+/* The directory data block consists of 2 blocks of 64 bytes:
+ * blocks 0 and 1 contain a data block (XD2D) with the entries "a", "b", "c" and "d"
+ * followed by an unused entry
+ */
+uint8_t fsxfs_test_directory_iterator_data1[ 128 ] = {
+	0x58, 0x44, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x01, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x01, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+	0xff, 0xff, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_directory_iterator_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_iterator_initialize(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libfsxfs_directory_iterator_t *directory_iterator = NULL;
+	libfsxfs_inode_t *inode                           = NULL;
+	libfsxfs_io_handle_t *io_handle                   = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_directory_iterator_initialize(
+	          &directory_iterator,
+	          io_handle,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_iterator",
+	 directory_iterator );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_iterator_free(
+	          &directory_iterator,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory_iterator",
+	 directory_iterator );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_iterator_initialize(
+	          NULL,
+	          io_handle,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_iterator = (libfsxfs_directory_iterator_t *) 0x12345678UL;
+
+	result = libfsxfs_directory_iterator_initialize(
+	          &directory_iterator,
+	          io_handle,
+	          inode,
+	          &error );
+
+	directory_iterator = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_iterator_initialize(
+	          &directory_iterator,
+	          NULL,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_iterator_initialize(
+	          &directory_iterator,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_iterator != NULL )
+	{
+		libfsxfs_directory_iterator_free(
+		 &directory_iterator,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_directory_iterator_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_iterator_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_iterator_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_directory_iterator_get_cookie and libfsxfs_directory_iterator_set_cookie functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_iterator_cookie(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libfsxfs_directory_entry_t *directory_entry       = NULL;
+	libfsxfs_directory_iterator_t *directory_iterator = NULL;
+	libfsxfs_inode_t *inode                           = NULL;
+	libfsxfs_io_handle_t *io_handle                   = NULL;
+	uint64_t cookie                                   = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_iterator_initialize(
+	          &directory_iterator,
+	          io_handle,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_directory_iterator_get_cookie(
+	          directory_iterator,
+	          &cookie,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cookie",
+	 cookie,
+	 (uint64_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_iterator_set_cookie(
+	          directory_iterator,
+	          0x0000000300000005UL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_iterator_next_entry(
+	          directory_iterator,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_iterator_get_cookie(
+	          directory_iterator,
+	          &cookie,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cookie",
+	 cookie,
+	 (uint64_t) 0x0000000300000006UL );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The inode is not a directory and has no entries
+	 */
+	result = libfsxfs_directory_iterator_set_cookie(
+	          directory_iterator,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_iterator_get_entry(
+	          directory_iterator,
+	          NULL,
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_iterator_get_cookie(
+	          NULL,
+	          &cookie,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_iterator_get_cookie(
+	          directory_iterator,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_iterator_set_cookie(
+	          NULL,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_iterator_set_cookie(
+	          directory_iterator,
+	          0x00000000ffffffffUL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_iterator_get_entry(
+	          directory_iterator,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_directory_iterator_free(
+	          &directory_iterator,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_iterator != NULL )
+	{
+		libfsxfs_directory_iterator_free(
+		 &directory_iterator,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_directory_iterator_get_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_iterator_get_entry(
+     void )
+{
+	/* The directory data blocks 0 and 2 are mapped to the same data block,
+	 * directory data block 1 is a hole
+	 */
+	uint64_t extent_values[ 2 ][ 3 ] = {
+		{ 0, 0, 2 },
+		{ 4, 0, 2 } };
+
+	uint64_t expected_inode_numbers[ 4 ] = {
+		0x20, 0x21, 0x22, 0x23 };
+
+	libbfio_handle_t *file_io_handle                  = NULL;
+	libcerror_error_t *error                          = NULL;
+	libfsxfs_directory_entry_t *directory_entry       = NULL;
+	libfsxfs_directory_iterator_t *directory_iterator = NULL;
+	libfsxfs_extent_t *extent                         = NULL;
+	libfsxfs_inode_t *inode                           = NULL;
+	libfsxfs_io_handle_t *io_handle                   = NULL;
+	uint64_t cookie                                   = 0;
+	int entry_index                                   = 0;
+	int extent_index                                  = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version                       = 4;
+	io_handle->block_size                           = 64;
+	io_handle->directory_block_size                 = 128;
+	io_handle->allocation_group_size                = 256;
+	io_handle->number_of_relative_block_number_bits = 8;
+
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsxfs_test_directory_iterator_data1,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Directory with data fork type extents
+	 */
+	inode->file_mode = 0x41ed;
+	inode->fork_type = 2;
+
+	result = libcdata_array_initialize(
+	          &( inode->data_extents_array ),
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( extent_index = 0;
+	     extent_index < 2;
+	     extent_index++ )
+	{
+		result = libfsxfs_extent_initialize(
+		          &extent,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		extent->logical_block_number  = extent_values[ extent_index ][ 0 ];
+		extent->physical_block_number = extent_values[ extent_index ][ 1 ];
+		extent->number_of_blocks      = (uint32_t) extent_values[ extent_index ][ 2 ];
+
+		result = libcdata_array_append_entry(
+		          inode->data_extents_array,
+		          &entry_index,
+		          (intptr_t *) extent,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		extent = NULL;
+	}
+	inode->number_of_data_extents = 2;
+
+	result = libfsxfs_extent_map_initialize(
+	          &( inode->data_extent_map ),
+	          inode->data_extents_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_iterator_initialize(
+	          &directory_iterator,
+	          io_handle,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( entry_index = 0;
+	     entry_index < 8;
+	     entry_index++ )
+	{
+		result = libfsxfs_directory_iterator_get_entry(
+		          directory_iterator,
+		          file_io_handle,
+		          &directory_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "directory_entry",
+		 directory_entry );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "directory_entry->inode_number",
+		 directory_entry->inode_number,
+		 expected_inode_numbers[ entry_index % 4 ] );
+
+		result = libfsxfs_directory_iterator_get_cookie(
+		          directory_iterator,
+		          &cookie,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* The entries of the second extent are in directory data block 2
+		 */
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "cookie",
+		 cookie,
+		 (uint64_t) ( ( (uint64_t) ( ( entry_index / 4 ) * 2 ) << 32 ) | (uint64_t) ( entry_index % 4 ) ) );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_directory_iterator_next_entry(
+		          directory_iterator,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsxfs_directory_iterator_get_entry(
+	          directory_iterator,
+	          file_io_handle,
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test resuming in the hole, which continues with directory data block 2
+	 */
+	result = libfsxfs_directory_iterator_set_cookie(
+	          directory_iterator,
+	          0x0000000100000000UL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_iterator_get_entry(
+	          directory_iterator,
+	          file_io_handle,
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "directory_entry->inode_number",
+	 directory_entry->inode_number,
+	 (uint64_t) 0x20 );
+
+	result = libfsxfs_directory_iterator_get_cookie(
+	          directory_iterator,
+	          &cookie,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cookie",
+	 cookie,
+	 (uint64_t) 0x0000000200000000UL );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test resuming backwards in directory data block 0
+	 */
+	result = libfsxfs_directory_iterator_set_cookie(
+	          directory_iterator,
+	          0x0000000000000003UL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_iterator_get_entry(
+	          directory_iterator,
+	          file_io_handle,
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "directory_entry->inode_number",
+	 directory_entry->inode_number,
+	 (uint64_t) 0x23 );
+
+	/* Test resuming past the last directory data block
+	 */
+	result = libfsxfs_directory_iterator_set_cookie(
+	          directory_iterator,
+	          0x0000000300000000UL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_iterator_get_entry(
+	          directory_iterator,
+	          file_io_handle,
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_directory_iterator_free(
+	          &directory_iterator,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_iterator != NULL )
+	{
+		libfsxfs_directory_iterator_free(
+		 &directory_iterator,
+		 NULL );
+	}
+	if( extent != NULL )
+	{
+		libfsxfs_extent_free(
+		 &extent,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_iterator_initialize",
+	 fsxfs_test_directory_iterator_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_iterator_free",
+	 fsxfs_test_directory_iterator_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_iterator_cookie",
+	 fsxfs_test_directory_iterator_cookie );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_iterator_get_entry",
+	 fsxfs_test_directory_iterator_get_entry );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
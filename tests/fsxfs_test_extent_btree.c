@@ -0,0 +1,1173 @@
+/*
+ * Library extent_btree type test program
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_extent_btree.h"
+#include "../libfsxfs/libfsxfs_extent_map.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+
+/* The root node refers to leaf node block 0, which contains the extents of logical blocks 0 and 2,
+ * and leaf node block 1, which contains the extent of logical block 8
+ */
+uint8_t fsxfs_test_extent_btree_root_node_data1[ 36 ] = {
+	0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01 };
+
+/* The leaf nodes are stored in blocks 0 and 1, the data in blocks 3, 4 and 5
+ */
+uint8_t fsxfs_test_extent_btree_data1[ 384 ] = {
+	0x42, 0x4d, 0x41, 0x50, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x42, 0x4d, 0x41, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_extent_btree_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_btree_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_btree_t *extent_btree = NULL;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_btree_initialize(
+	          &extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_btree",
+	 extent_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_btree_free(
+	          &extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent_btree",
+	 extent_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_btree_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_btree = (libfsxfs_extent_btree_t *) 0x12345678UL;
+
+	result = libfsxfs_extent_btree_initialize(
+	          &extent_btree,
+	          &error );
+
+	extent_btree = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_btree != NULL )
+	{
+		libfsxfs_extent_btree_free(
+		 &extent_btree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_btree_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_btree_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_btree_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_btree_read_root_node function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_btree_read_root_node(
+     void )
+{
+	uint8_t leaf_root_node_data[ 4 ] = {
+		0x00, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_btree_t *extent_btree = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_extent_btree_initialize(
+	          &extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_btree",
+	 extent_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_btree_read_root_node(
+	          NULL,
+	          fsxfs_test_extent_btree_root_node_data1,
+	          36,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_btree_read_root_node(
+	          extent_btree,
+	          NULL,
+	          36,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_btree_read_root_node(
+	          extent_btree,
+	          fsxfs_test_extent_btree_root_node_data1,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the root node is a leaf node
+	 */
+	result = libfsxfs_extent_btree_read_root_node(
+	          extent_btree,
+	          leaf_root_node_data,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the number of records exceeds the data
+	 */
+	result = libfsxfs_extent_btree_read_root_node(
+	          extent_btree,
+	          fsxfs_test_extent_btree_root_node_data1,
+	          20,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_btree_read_root_node(
+	          extent_btree,
+	          fsxfs_test_extent_btree_root_node_data1,
+	          36,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "extent_btree->root_node_level",
+	 extent_btree->root_node_level,
+	 (uint16_t) 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "extent_btree->number_of_root_node_records",
+	 extent_btree->number_of_root_node_records,
+	 (uint16_t) 2 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_btree->root_node_keys[ 1 ]",
+	 extent_btree->root_node_keys[ 1 ],
+	 (uint64_t) 8 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_btree->root_node_sub_block_numbers[ 1 ]",
+	 extent_btree->root_node_sub_block_numbers[ 1 ],
+	 (uint64_t) 1 );
+
+	/* Test error case where the root node was already read
+	 */
+	result = libfsxfs_extent_btree_read_root_node(
+	          extent_btree,
+	          fsxfs_test_extent_btree_root_node_data1,
+	          36,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_btree_free(
+	          &extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_btree != NULL )
+	{
+		libfsxfs_extent_btree_free(
+		 &extent_btree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_btree_get_leaf_node_by_logical_block_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_btree_get_leaf_node_by_logical_block_number(
+     void )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_btree_t *extent_btree = NULL;
+	libfsxfs_extent_map_t *extent_map     = NULL;
+	libfsxfs_io_handle_t *io_handle       = NULL;
+	uint64_t next_logical_block_number    = 0;
+	int number_of_extents                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version                       = 4;
+	io_handle->block_size                           = 64;
+	io_handle->allocation_group_size                = 256;
+	io_handle->number_of_relative_block_number_bits = 8;
+
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsxfs_test_extent_btree_data1,
+	          384,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_btree_initialize(
+	          &extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_btree_read_root_node(
+	          extent_btree,
+	          fsxfs_test_extent_btree_root_node_data1,
+	          36,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_btree_get_leaf_node_by_logical_block_number(
+	          extent_btree,
+	          io_handle,
+	          file_io_handle,
+	          2,
+	          &extent_map,
+	          &next_logical_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "next_logical_block_number",
+	 next_logical_block_number,
+	 (uint64_t) 8 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_number_of_extents(
+	          extent_map,
+	          &number_of_extents,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 2 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_btree_get_leaf_node_by_logical_block_number(
+	          extent_btree,
+	          io_handle,
+	          file_io_handle,
+	          9,
+	          &extent_map,
+	          &next_logical_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "next_logical_block_number",
+	 next_logical_block_number,
+	 (uint64_t) UINT64_MAX );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_number_of_extents(
+	          extent_map,
+	          &number_of_extents,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving a leaf node that is stored in the leaf node cache
+	 */
+	result = libfsxfs_extent_btree_get_leaf_node_by_logical_block_number(
+	          extent_btree,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &extent_map,
+	          &next_logical_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "next_logical_block_number",
+	 next_logical_block_number,
+	 (uint64_t) 8 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_btree_get_leaf_node_by_logical_block_number(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &extent_map,
+	          &next_logical_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_btree_get_leaf_node_by_logical_block_number(
+	          extent_btree,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          NULL,
+	          &next_logical_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_btree_get_leaf_node_by_logical_block_number(
+	          extent_btree,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &extent_map,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_btree_free(
+	          &extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_btree != NULL )
+	{
+		libfsxfs_extent_btree_free(
+		 &extent_btree,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_btree_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_btree_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 640 ];
+
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_btree_t *extent_btree = NULL;
+	libfsxfs_io_handle_t *io_handle       = NULL;
+	ssize_t read_count                    = 0;
+	size_t buffer_offset                  = 0;
+	uint8_t expected_byte_value           = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version                       = 4;
+	io_handle->block_size                           = 64;
+	io_handle->allocation_group_size                = 256;
+	io_handle->number_of_relative_block_number_bits = 8;
+
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsxfs_test_extent_btree_data1,
+	          384,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_btree_initialize(
+	          &extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_btree_read_root_node(
+	          extent_btree,
+	          fsxfs_test_extent_btree_root_node_data1,
+	          36,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libfsxfs_extent_btree_read_buffer_at_offset(
+	              extent_btree,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              640,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 640 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Logical blocks 0, 2 and 8 are stored in physical blocks 3, 4 and 5, the other blocks are sparse
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 640;
+	     buffer_offset++ )
+	{
+		switch( buffer_offset / 64 )
+		{
+			case 0:
+				expected_byte_value = 0x33;
+				break;
+
+			case 2:
+				expected_byte_value = 0x44;
+				break;
+
+			case 8:
+				expected_byte_value = 0x55;
+				break;
+
+			default:
+				expected_byte_value = 0;
+				break;
+		}
+		FSXFS_TEST_ASSERT_EQUAL_UINT8(
+		 "buffer[ buffer_offset ]",
+		 buffer[ buffer_offset ],
+		 expected_byte_value );
+	}
+	read_count = libfsxfs_extent_btree_read_buffer_at_offset(
+	              extent_btree,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              64,
+	              480,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 31 ]",
+	 buffer[ 31 ],
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 32 ]",
+	 buffer[ 32 ],
+	 0x55 );
+
+	/* Test error cases
+	 */
+	read_count = libfsxfs_extent_btree_read_buffer_at_offset(
+	              NULL,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              64,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_extent_btree_read_buffer_at_offset(
+	              extent_btree,
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              64,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_extent_btree_read_buffer_at_offset(
+	              extent_btree,
+	              io_handle,
+	              file_io_handle,
+	              NULL,
+	              64,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_extent_btree_read_buffer_at_offset(
+	              extent_btree,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_extent_btree_read_buffer_at_offset(
+	              extent_btree,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              64,
+	              -1,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_btree_free(
+	          &extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_btree != NULL )
+	{
+		libfsxfs_extent_btree_free(
+		 &extent_btree,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_btree_initialize",
+	 fsxfs_test_extent_btree_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_btree_free",
+	 fsxfs_test_extent_btree_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_btree_read_root_node",
+	 fsxfs_test_extent_btree_read_root_node );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_btree_get_leaf_node_by_logical_block_number",
+	 fsxfs_test_extent_btree_get_leaf_node_by_logical_block_number );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_btree_read_buffer_at_offset",
+	 fsxfs_test_extent_btree_read_buffer_at_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
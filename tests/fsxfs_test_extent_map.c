@@ -0,0 +1,1397 @@
+/*
+ * Library extent_map type test program
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcdata.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_extent.h"
+#include "../libfsxfs/libfsxfs_extent_map.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+
+uint8_t fsxfs_test_extent_map_data1[ 48 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f };
+
+/* The test extents: logical block number, physical block number, number of blocks
+ */
+uint64_t fsxfs_test_extent_map_extents1[ 3 ][ 3 ] = {
+	{ 0, 2, 1 },
+	{ 2, 0, 2 },
+	{ 8, 1, 1 } };
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Creates an extents array with the test extents
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_extent_map_create_extents_array(
+     libcdata_array_t **extents_array,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *extent = NULL;
+	int entry_index           = 0;
+	int extent_index          = 0;
+
+	if( libcdata_array_initialize(
+	     extents_array,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( extent_index = 0;
+	     extent_index < 3;
+	     extent_index++ )
+	{
+		if( libfsxfs_extent_initialize(
+		     &extent,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		extent->logical_block_number  = fsxfs_test_extent_map_extents1[ extent_index ][ 0 ];
+		extent->physical_block_number = fsxfs_test_extent_map_extents1[ extent_index ][ 1 ];
+		extent->number_of_blocks      = (uint32_t) fsxfs_test_extent_map_extents1[ extent_index ][ 2 ];
+
+		if( libcdata_array_append_entry(
+		     *extents_array,
+		     &entry_index,
+		     (intptr_t *) extent,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		extent = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( extent != NULL )
+	{
+		libfsxfs_extent_free(
+		 &extent,
+		 NULL );
+	}
+	if( *extents_array != NULL )
+	{
+		libcdata_array_free(
+		 extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libfsxfs_extent_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_map_initialize(
+     void )
+{
+	libcdata_array_t *extents_array   = NULL;
+	libcerror_error_t *error          = NULL;
+	libfsxfs_extent_map_t *extent_map = NULL;
+	libfsxfs_extent_t *extent         = NULL;
+	int number_of_extents             = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = fsxfs_test_extent_map_create_extents_array(
+	          &extents_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extents_array",
+	 extents_array );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          extents_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_number_of_extents(
+	          extent_map,
+	          &number_of_extents,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 3 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where logically and physically contiguous extents are merged
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          extents_array,
+	          1,
+	          (intptr_t **) &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	extent->logical_block_number  = 1;
+	extent->physical_block_number = 3;
+
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          extents_array,
+	          &error );
+
+	extent->logical_block_number  = 2;
+	extent->physical_block_number = 0;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_number_of_extents(
+	          extent_map,
+	          &number_of_extents,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 2 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_map->numbers_of_blocks[ 0 ]",
+	 extent_map->numbers_of_blocks[ 0 ],
+	 (uint64_t) 3 );
+
+	result = libfsxfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_map_initialize(
+	          NULL,
+	          extents_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_map = (libfsxfs_extent_map_t *) 0x12345678UL;
+
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          extents_array,
+	          &error );
+
+	extent_map = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfsxfs_extent_map_initialize with extents that are not sorted
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          extents_array,
+	          2,
+	          (intptr_t **) &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	extent->logical_block_number = 1;
+
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          extents_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &extents_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extents_array",
+	 extents_array );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsxfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	if( extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_map_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_map_get_extent_index_by_logical_block_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_map_get_extent_index_by_logical_block_number(
+     void )
+{
+	libcdata_array_t *extents_array   = NULL;
+	libcerror_error_t *error          = NULL;
+	libfsxfs_extent_map_t *extent_map = NULL;
+	int extent_index                  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = fsxfs_test_extent_map_create_extents_array(
+	          &extents_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          extents_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_map_get_extent_index_by_logical_block_number(
+	          extent_map,
+	          3,
+	          &extent_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_extent_index_by_logical_block_number(
+	          extent_map,
+	          5,
+	          &extent_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 2 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_extent_index_by_logical_block_number(
+	          extent_map,
+	          9,
+	          &extent_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 3 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_map_get_extent_index_by_logical_block_number(
+	          NULL,
+	          3,
+	          &extent_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_map_get_extent_index_by_logical_block_number(
+	          extent_map,
+	          3,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &extents_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsxfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	if( extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_map_get_file_offset_by_extent_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_map_get_file_offset_by_extent_index(
+     void )
+{
+	libcdata_array_t *extents_array   = NULL;
+	libcerror_error_t *error          = NULL;
+	libfsxfs_extent_map_t *extent_map = NULL;
+	libfsxfs_io_handle_t *io_handle   = NULL;
+	off64_t file_offset               = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size                           = 16;
+	io_handle->allocation_group_size                = 256;
+	io_handle->number_of_relative_block_number_bits = 8;
+
+	result = fsxfs_test_extent_map_create_extents_array(
+	          &extents_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          extents_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_map_get_file_offset_by_extent_index(
+	          extent_map,
+	          io_handle,
+	          1,
+	          2,
+	          2,
+	          &file_offset,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 (int64_t) file_offset,
+	 (int64_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_file_offset_by_extent_index(
+	          extent_map,
+	          io_handle,
+	          1,
+	          3,
+	          1,
+	          &file_offset,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 (int64_t) file_offset,
+	 (int64_t) 16 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a range that is not contiguously mapped by the extent
+	 */
+	result = libfsxfs_extent_map_get_file_offset_by_extent_index(
+	          extent_map,
+	          io_handle,
+	          1,
+	          3,
+	          2,
+	          &file_offset,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a range outside the extent
+	 */
+	result = libfsxfs_extent_map_get_file_offset_by_extent_index(
+	          extent_map,
+	          io_handle,
+	          0,
+	          1,
+	          1,
+	          &file_offset,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_file_offset_by_extent_index(
+	          extent_map,
+	          io_handle,
+	          2,
+	          7,
+	          1,
+	          &file_offset,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_map_get_file_offset_by_extent_index(
+	          NULL,
+	          io_handle,
+	          1,
+	          3,
+	          1,
+	          &file_offset,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_map_get_file_offset_by_extent_index(
+	          extent_map,
+	          NULL,
+	          1,
+	          3,
+	          1,
+	          &file_offset,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_map_get_file_offset_by_extent_index(
+	          extent_map,
+	          io_handle,
+	          -1,
+	          3,
+	          1,
+	          &file_offset,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_map_get_file_offset_by_extent_index(
+	          extent_map,
+	          io_handle,
+	          3,
+	          3,
+	          1,
+	          &file_offset,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_map_get_file_offset_by_extent_index(
+	          extent_map,
+	          io_handle,
+	          1,
+	          3,
+	          1,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &extents_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsxfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	if( extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_map_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_map_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 64 ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcdata_array_t *extents_array   = NULL;
+	libcerror_error_t *error          = NULL;
+	libfsxfs_extent_map_t *extent_map = NULL;
+	libfsxfs_io_handle_t *io_handle   = NULL;
+	ssize_t read_count                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size                           = 16;
+	io_handle->allocation_group_size                = 256;
+	io_handle->number_of_relative_block_number_bits = 8;
+
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsxfs_test_extent_map_data1,
+	          48,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_extent_map_create_extents_array(
+	          &extents_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          extents_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libfsxfs_extent_map_read_buffer_at_offset(
+	              extent_map,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              64,
+	              8,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Logical block 0 is stored in physical block 2
+	 */
+	result = memory_compare(
+	          buffer,
+	          &( fsxfs_test_extent_map_data1[ 40 ] ),
+	          8 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Logical block 1 is sparse
+	 */
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 8 ]",
+	 buffer[ 8 ],
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 23 ]",
+	 buffer[ 23 ],
+	 0 );
+
+	/* Logical blocks 2 and 3 are stored in physical blocks 0 and 1
+	 */
+	result = memory_compare(
+	          &( buffer[ 24 ] ),
+	          fsxfs_test_extent_map_data1,
+	          32 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Logical block 4 is sparse
+	 */
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 63 ]",
+	 buffer[ 63 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libfsxfs_extent_map_read_buffer_at_offset(
+	              NULL,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              64,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_extent_map_read_buffer_at_offset(
+	              extent_map,
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              64,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_extent_map_read_buffer_at_offset(
+	              extent_map,
+	              io_handle,
+	              file_io_handle,
+	              NULL,
+	              64,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_extent_map_read_buffer_at_offset(
+	              extent_map,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              64,
+	              -1,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &extents_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsxfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	if( extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_map_initialize",
+	 fsxfs_test_extent_map_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_map_free",
+	 fsxfs_test_extent_map_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_map_get_extent_index_by_logical_block_number",
+	 fsxfs_test_extent_map_get_extent_index_by_logical_block_number );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_map_get_file_offset_by_extent_index",
+	 fsxfs_test_extent_map_get_file_offset_by_extent_index );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_map_read_buffer_at_offset",
+	 fsxfs_test_extent_map_read_buffer_at_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
@@ -21,12 +21,17 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_getopt.h"
+#include "fsxfs_test_libbfio.h"
 #include "fsxfs_test_libcerror.h"
 #include "fsxfs_test_libfsxfs.h"
 #include "fsxfs_test_macros.h"
@@ -35,32 +40,2106 @@
 
 #include "../libfsxfs/libfsxfs_file_entry.h"
 
+#if !defined( LIBFSXFS_HAVE_BFIO )
+
+LIBFSXFS_EXTERN \
+int libfsxfs_check_volume_signature_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_open_file_io_handle(
+     libfsxfs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfsxfs_error_t **error );
+
+#endif /* !defined( LIBFSXFS_HAVE_BFIO ) */
+
+/* The maximum depth of the directory hierarchy that is searched for a file with data
+ */
+#define FSXFS_TEST_FILE_ENTRY_MAXIMUM_SEARCH_DEPTH	4
+
+/* Creates and opens a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_volume_open_source(
+     libfsxfs_volume_t **volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_volume_open_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsxfs_volume_open_file_io_handle(
+	          *volume,
+	          file_io_handle,
+	          LIBFSXFS_OPEN_READ,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_volume_close_source(
+     libfsxfs_volume_t **volume,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_volume_close_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_close(
+	     *volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libfsxfs_volume_free(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Searches a directory hierarchy for a regular file that contains data
+ * Returns 1 if successful, 0 if no such file was found or -1 on error
+ */
+int fsxfs_test_file_entry_get_file_with_data(
+     libfsxfs_file_entry_t *directory_file_entry,
+     int depth,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_entry_t *sub_file_entry = NULL;
+	static char *function                 = "fsxfs_test_file_entry_get_file_with_data";
+	size64_t size                         = 0;
+	uint16_t file_mode                    = 0;
+	int number_of_sub_file_entries        = 0;
+	int result                            = 0;
+	int sub_file_entry_index              = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( depth > FSXFS_TEST_FILE_ENTRY_MAXIMUM_SEARCH_DEPTH )
+	{
+		return( 0 );
+	}
+	if( libfsxfs_file_entry_get_number_of_sub_file_entries(
+	     directory_file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( libfsxfs_file_entry_get_sub_file_entry_by_index(
+		     directory_file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( libfsxfs_file_entry_get_file_mode(
+		     sub_file_entry,
+		     &file_mode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file mode.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( file_mode & 0xf000 ) == 0x8000 )
+		{
+			if( libfsxfs_file_entry_get_size(
+			     sub_file_entry,
+			     &size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size.",
+				 function );
+
+				goto on_error;
+			}
+			if( size > 0 )
+			{
+				*file_entry = sub_file_entry;
+
+				return( 1 );
+			}
+		}
+		else if( ( file_mode & 0xf000 ) == 0x4000 )
+		{
+			result = fsxfs_test_file_entry_get_file_with_data(
+			          sub_file_entry,
+			          depth + 1,
+			          file_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				libfsxfs_file_entry_free(
+				 &sub_file_entry,
+				 NULL );
+
+				return( 1 );
+			}
+		}
+		if( libfsxfs_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Searches the directory entries of a directory for an UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such entry was found or -1 on error
+ */
+int fsxfs_test_file_entry_find_directory_entry_by_utf8_name(
+     libfsxfs_file_entry_t *directory_file_entry,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t *inode_number,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_names_buffer[ 8 * 256 ];
+	uint8_t *utf8_names[ 8 ];
+	size_t utf8_name_sizes[ 8 ];
+	uint64_t inode_numbers[ 8 ];
+	uint16_t file_types[ 8 ];
+
+	static char *function = "fsxfs_test_file_entry_find_directory_entry_by_utf8_name";
+	int entry_index       = 0;
+	int first_entry_index = 0;
+	int number_of_entries = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( libfsxfs_file_entry_get_directory_entries(
+		     directory_file_entry,
+		     first_entry_index,
+		     utf8_names_buffer,
+		     8 * 256,
+		     utf8_names,
+		     utf8_name_sizes,
+		     inode_numbers,
+		     file_types,
+		     8,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entries.",
+			 function );
+
+			return( -1 );
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( ( utf8_name_sizes[ entry_index ] == ( utf8_string_length + 1 ) )
+			 && ( memory_compare(
+			       utf8_names[ entry_index ],
+			       utf8_string,
+			       utf8_string_length ) == 0 ) )
+			{
+				*inode_number = inode_numbers[ entry_index ];
+
+				return( 1 );
+			}
+		}
+		first_entry_index += number_of_entries;
+	}
+	while( number_of_entries > 0 );
+
+	return( 0 );
+}
+
 /* Tests the libfsxfs_file_entry_free function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_file_entry_free(
-     void )
+int fsxfs_test_file_entry_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_file_entry_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_pread_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_pread_buffer(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+
+	/* Test error cases
+	 */
+	read_count = libfsxfs_file_entry_pread_buffer(
+	              NULL,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_read_ranges function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_read_ranges(
+     void )
+{
+	uint8_t buffer[ 16 ];
+	void *buffers[ 1 ];
+	size_t buffer_sizes[ 1 ];
+	off64_t offsets[ 1 ];
+	ssize_t read_counts[ 1 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	buffers[ 0 ]      = buffer;
+	buffer_sizes[ 0 ] = 16;
+	offsets[ 0 ]      = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_file_entry_read_ranges(
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_get_directory_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_get_directory_entries(
+     void )
+{
+	uint8_t utf8_names_buffer[ 64 ];
+	uint8_t *utf8_names[ 1 ];
+	size_t utf8_name_sizes[ 1 ];
+	uint64_t inode_numbers[ 1 ];
+	uint16_t file_types[ 1 ];
+
+	libcerror_error_t *error = NULL;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_file_entry_get_directory_entries(
+	          NULL,
+	          0,
+	          utf8_names_buffer,
+	          64,
+	          utf8_names,
+	          utf8_name_sizes,
+	          inode_numbers,
+	          file_types,
+	          1,
+	          &number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_read_directory_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_read_directory_entries(
+     void )
+{
+	uint8_t utf8_names_buffer[ 64 ];
+	uint8_t *utf8_names[ 1 ];
+	size_t utf8_name_sizes[ 1 ];
+	uint64_t inode_numbers[ 1 ];
+	uint16_t file_types[ 1 ];
+
+	libcerror_error_t *error = NULL;
+	uint64_t cookie          = 0;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_file_entry_read_directory_entries(
+	          NULL,
+	          &cookie,
+	          utf8_names_buffer,
+	          64,
+	          utf8_names,
+	          utf8_name_sizes,
+	          inode_numbers,
+	          file_types,
+	          1,
+	          &number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_get_sub_file_entry_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_get_sub_file_entry_by_utf8_name(
+     void )
+{
+	uint8_t utf8_string[ 5 ] = { 'f', 'i', 'l', 'e', 0 };
+
+	libcerror_error_t *error              = NULL;
+	libfsxfs_file_entry_t *sub_file_entry = NULL;
+	int result                            = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
+	          NULL,
+	          utf8_string,
+	          4,
+	          &sub_file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_get_sub_file_entry_by_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_get_sub_file_entry_by_utf16_name(
+     void )
+{
+	uint16_t utf16_string[ 5 ] = { 'f', 'i', 'l', 'e', 0 };
+
+	libcerror_error_t *error              = NULL;
+	libfsxfs_file_entry_t *sub_file_entry = NULL;
+	int result                            = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
+	          NULL,
+	          utf16_string,
+	          4,
+	          &sub_file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_read_buffer and libfsxfs_file_entry_pread_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_read_buffer(
+     libfsxfs_file_entry_t *file_entry )
+{
+	uint8_t pread_buffer[ 4096 ];
+	uint8_t read_buffer[ 4096 ];
+	off64_t read_offsets[ 6 ];
+
+	libcerror_error_t *error = NULL;
+	size64_t remaining_size  = 0;
+	size64_t size            = 0;
+	ssize_t expected_count   = 0;
+	ssize_t pread_count      = 0;
+	ssize_t read_count       = 0;
+	off64_t current_offset   = 0;
+	off64_t offset           = 0;
+	int offset_index         = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_file_entry_get_size(
+	          file_entry,
+	          &size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read at the start, in the middle, over the end, at the end and past the end of the data
+	 */
+	read_offsets[ 0 ] = 0;
+	read_offsets[ 1 ] = (off64_t) ( size / 2 );
+	read_offsets[ 2 ] = (off64_t) ( size - 1 );
+	read_offsets[ 3 ] = ( size > 4096 ) ? (off64_t) ( size - 2048 ) : 0;
+	read_offsets[ 4 ] = (off64_t) size;
+	read_offsets[ 5 ] = (off64_t) ( size + 4096 );
+
+	/* Test regular cases
+	 */
+	for( offset_index = 0;
+	     offset_index < 6;
+	     offset_index++ )
+	{
+		offset = read_offsets[ offset_index ];
+
+		if( (size64_t) offset >= size )
+		{
+			expected_count = 0;
+		}
+		else
+		{
+			remaining_size = size - (size64_t) offset;
+
+			if( remaining_size > 4096 )
+			{
+				expected_count = 4096;
+			}
+			else
+			{
+				expected_count = (ssize_t) remaining_size;
+			}
+		}
+		current_offset = libfsxfs_file_entry_seek_offset(
+		                  file_entry,
+		                  offset,
+		                  SEEK_SET,
+		                  &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT64(
+		 "current_offset",
+		 (int64_t) current_offset,
+		 (int64_t) offset );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libfsxfs_file_entry_read_buffer(
+		              file_entry,
+		              read_buffer,
+		              4096,
+		              &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 expected_count );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		pread_count = libfsxfs_file_entry_pread_buffer(
+		               file_entry,
+		               pread_buffer,
+		               4096,
+		               offset,
+		               &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "pread_count",
+		 pread_count,
+		 expected_count );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( expected_count > 0 )
+		{
+			result = memory_compare(
+			          pread_buffer,
+			          read_buffer,
+			          (size_t) expected_count );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		/* A positional read does not change the current offset
+		 */
+		result = libfsxfs_file_entry_get_offset(
+		          file_entry,
+		          &current_offset,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT64(
+		 "current_offset",
+		 (int64_t) current_offset,
+		 (int64_t) ( offset + read_count ) );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	pread_count = libfsxfs_file_entry_pread_buffer(
+	               file_entry,
+	               NULL,
+	               4096,
+	               0,
+	               &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "pread_count",
+	 pread_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	pread_count = libfsxfs_file_entry_pread_buffer(
+	               file_entry,
+	               pread_buffer,
+	               4096,
+	               -1,
+	               &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "pread_count",
+	 pread_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_get_directory_entries function
+ * The directory entries are compared with the corresponding sub file entries
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_get_directory_entries_of_directory(
+     libfsxfs_file_entry_t *directory_file_entry )
+{
+	uint8_t utf8_names_buffer[ 8 * 256 ];
+	uint8_t utf8_name[ 256 ];
+	uint8_t *utf8_names[ 8 ];
+	size_t utf8_name_sizes[ 8 ];
+	uint64_t inode_numbers[ 8 ];
+	uint16_t file_types[ 8 ];
+
+	libcerror_error_t *error              = NULL;
+	libfsxfs_file_entry_t *sub_file_entry = NULL;
+	size_t utf8_name_size                 = 0;
+	uint64_t inode_number                 = 0;
+	uint16_t file_mode                    = 0;
+	int entry_index                       = 0;
+	int first_entry_index                 = 0;
+	int number_of_entries                 = 0;
+	int number_of_sub_file_entries        = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_file_entry_get_number_of_sub_file_entries(
+	          directory_file_entry,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	do
+	{
+		result = libfsxfs_file_entry_get_directory_entries(
+		          directory_file_entry,
+		          first_entry_index,
+		          utf8_names_buffer,
+		          8 * 256,
+		          utf8_names,
+		          utf8_name_sizes,
+		          inode_numbers,
+		          file_types,
+		          8,
+		          &number_of_entries,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The names buffer can hold 8 names of maximum size
+		 */
+		if( first_entry_index < ( number_of_sub_file_entries - 8 ) )
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "number_of_entries",
+			 number_of_entries,
+			 8 );
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "number_of_entries",
+			 number_of_entries,
+			 number_of_sub_file_entries - first_entry_index );
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			result = libfsxfs_file_entry_get_sub_file_entry_by_index(
+			          directory_file_entry,
+			          first_entry_index + entry_index,
+			          &sub_file_entry,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "sub_file_entry",
+			 sub_file_entry );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfsxfs_file_entry_get_inode_number(
+			          sub_file_entry,
+			          &inode_number,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "inode_numbers[ entry_index ]",
+			 inode_numbers[ entry_index ],
+			 inode_number );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfsxfs_file_entry_get_utf8_name_size(
+			          sub_file_entry,
+			          &utf8_name_size,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_EQUAL_SIZE(
+			 "utf8_name_sizes[ entry_index ]",
+			 utf8_name_sizes[ entry_index ],
+			 utf8_name_size );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfsxfs_file_entry_get_utf8_name(
+			          sub_file_entry,
+			          utf8_name,
+			          256,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          utf8_names[ entry_index ],
+			          utf8_name,
+			          utf8_name_size );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			/* The file type is 0 if the directory entry does not store it
+			 */
+			if( file_types[ entry_index ] != 0 )
+			{
+				result = libfsxfs_file_entry_get_file_mode(
+				          sub_file_entry,
+				          &file_mode,
+				          &error );
+
+				FSXFS_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				FSXFS_TEST_ASSERT_EQUAL_UINT16(
+				 "file_types[ entry_index ]",
+				 file_types[ entry_index ],
+				 (uint16_t) ( file_mode & 0xf000 ) );
+
+				FSXFS_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+			result = libfsxfs_file_entry_free(
+			          &sub_file_entry,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		first_entry_index += number_of_entries;
+	}
+	while( number_of_entries > 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "first_entry_index",
+	 first_entry_index,
+	 number_of_sub_file_entries );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_read_directory_entries function
+ * The directory is read in small batches, resuming from the cookie, and compared with
+ * a listing in large batches and with the sub file entries
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_read_directory_entries_of_directory(
+     libfsxfs_file_entry_t *directory_file_entry )
+{
+	uint8_t full_utf8_names_buffer[ 64 * 256 ];
+	uint8_t utf8_names_buffer[ 256 ];
+	uint8_t *full_utf8_names[ 64 ];
+	uint8_t *utf8_names[ 2 ];
+	size_t full_utf8_name_sizes[ 64 ];
+	size_t utf8_name_sizes[ 2 ];
+	uint64_t full_inode_numbers[ 64 ];
+	uint64_t inode_numbers[ 2 ];
+	uint16_t full_file_types[ 64 ];
+	uint16_t file_types[ 2 ];
+
+	libcerror_error_t *error              = NULL;
+	libfsxfs_file_entry_t *sub_file_entry = NULL;
+	uint64_t full_cookie                  = 0;
+	uint64_t cookie                       = 0;
+	uint64_t inode_number                 = 0;
+	uint64_t resume_cookie                = 0;
+	uint64_t resume_inode_number          = 0;
+	int entry_index                       = 0;
+	int full_entry_index                  = 0;
+	int full_number_of_entries            = 0;
+	int number_of_entries                 = 0;
+	int number_of_read_entries            = 0;
+	int number_of_sub_file_entries        = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_file_entry_get_number_of_sub_file_entries(
+	          directory_file_entry,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	do
+	{
+		/* The names buffer can hold a single name of maximum size,
+		 * hence reading can also stop before 2 entries have been read
+		 */
+		result = libfsxfs_file_entry_read_directory_entries(
+		          directory_file_entry,
+		          &cookie,
+		          utf8_names_buffer,
+		          256,
+		          utf8_names,
+		          utf8_name_sizes,
+		          inode_numbers,
+		          file_types,
+		          2,
+		          &number_of_entries,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( number_of_read_entries == 0 )
+		 && ( resume_cookie == 0 ) )
+		{
+			resume_cookie = cookie;
+		}
+		else if( ( number_of_entries > 0 )
+		      && ( resume_inode_number == 0 ) )
+		{
+			resume_inode_number = inode_numbers[ 0 ];
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( full_entry_index >= full_number_of_entries )
+			{
+				result = libfsxfs_file_entry_read_directory_entries(
+				          directory_file_entry,
+				          &full_cookie,
+				          full_utf8_names_buffer,
+				          64 * 256,
+				          full_utf8_names,
+				          full_utf8_name_sizes,
+				          full_inode_numbers,
+				          full_file_types,
+				          64,
+				          &full_number_of_entries,
+				          &error );
+
+				FSXFS_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+				 "full_number_of_entries",
+				 full_number_of_entries,
+				 0 );
+
+				FSXFS_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				full_entry_index = 0;
+			}
+			FSXFS_TEST_ASSERT_EQUAL_SIZE(
+			 "utf8_name_sizes[ entry_index ]",
+			 utf8_name_sizes[ entry_index ],
+			 full_utf8_name_sizes[ full_entry_index ] );
+
+			result = memory_compare(
+			          utf8_names[ entry_index ],
+			          full_utf8_names[ full_entry_index ],
+			          utf8_name_sizes[ entry_index ] );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "inode_numbers[ entry_index ]",
+			 inode_numbers[ entry_index ],
+			 full_inode_numbers[ full_entry_index ] );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT16(
+			 "file_types[ entry_index ]",
+			 file_types[ entry_index ],
+			 full_file_types[ full_entry_index ] );
+
+			/* The sub file entry with the name refers to the same inode
+			 */
+			result = libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
+			          directory_file_entry,
+			          utf8_names[ entry_index ],
+			          utf8_name_sizes[ entry_index ] - 1,
+			          &sub_file_entry,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "sub_file_entry",
+			 sub_file_entry );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfsxfs_file_entry_get_inode_number(
+			          sub_file_entry,
+			          &inode_number,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "inode_number",
+			 inode_number,
+			 inode_numbers[ entry_index ] );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfsxfs_file_entry_free(
+			          &sub_file_entry,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			full_entry_index++;
+		}
+		number_of_read_entries += number_of_entries;
+	}
+	while( number_of_entries > 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_read_entries",
+	 number_of_read_entries,
+	 number_of_sub_file_entries );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "full_entry_index",
+	 full_entry_index,
+	 full_number_of_entries );
+
+	/* The large batch listing has no remaining entries
+	 */
+	result = libfsxfs_file_entry_read_directory_entries(
+	          directory_file_entry,
+	          &full_cookie,
+	          full_utf8_names_buffer,
+	          64 * 256,
+	          full_utf8_names,
+	          full_utf8_name_sizes,
+	          full_inode_numbers,
+	          full_file_types,
+	          64,
+	          &full_number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "full_number_of_entries",
+	 full_number_of_entries,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Resuming from an earlier cookie returns the same entry again
+	 */
+	if( resume_inode_number != 0 )
+	{
+		result = libfsxfs_file_entry_read_directory_entries(
+		          directory_file_entry,
+		          &resume_cookie,
+		          utf8_names_buffer,
+		          256,
+		          utf8_names,
+		          utf8_name_sizes,
+		          inode_numbers,
+		          file_types,
+		          1,
+		          &number_of_entries,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_entries",
+		 number_of_entries,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "inode_numbers[ 0 ]",
+		 inode_numbers[ 0 ],
+		 resume_inode_number );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Compares the sub file entry retrieved by an UTF-8 and UTF-16 encoded name with the directory entries
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_compare_sub_file_entry_by_name(
+     libfsxfs_file_entry_t *directory_file_entry,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length )
+{
+	uint16_t utf16_string[ 256 ];
+
+	libcerror_error_t *error              = NULL;
+	libfsxfs_file_entry_t *sub_file_entry = NULL;
+	size_t string_index                   = 0;
+	uint64_t expected_inode_number        = 0;
+	uint64_t inode_number                 = 0;
+	int expected_result                   = 0;
+	int is_ascii                          = 1;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	expected_result = fsxfs_test_file_entry_find_directory_entry_by_utf8_name(
+	                   directory_file_entry,
+	                   utf8_string,
+	                   utf8_string_length,
+	                   &expected_inode_number,
+	                   &error );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "expected_result",
+	 expected_result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
+	          directory_file_entry,
+	          utf8_string,
+	          utf8_string_length,
+	          &sub_file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( expected_result == 0 )
+	{
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "sub_file_entry",
+		 sub_file_entry );
+	}
+	else
+	{
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "sub_file_entry",
+		 sub_file_entry );
+
+		result = libfsxfs_file_entry_get_inode_number(
+		          sub_file_entry,
+		          &inode_number,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "inode_number",
+		 inode_number,
+		 expected_inode_number );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_file_entry_free(
+		          &sub_file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The UTF-16 encoded name is only compared for ASCII names
+	 */
+	for( string_index = 0;
+	     string_index < utf8_string_length;
+	     string_index++ )
+	{
+		if( utf8_string[ string_index ] >= 0x80 )
+		{
+			is_ascii = 0;
+
+			break;
+		}
+		utf16_string[ string_index ] = (uint16_t) utf8_string[ string_index ];
+	}
+	if( ( is_ascii == 0 )
+	 || ( utf8_string_length >= 256 ) )
+	{
+		return( 1 );
+	}
+	result = libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
+	          directory_file_entry,
+	          utf16_string,
+	          utf8_string_length,
+	          &sub_file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( expected_result == 0 )
+	{
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "sub_file_entry",
+		 sub_file_entry );
+	}
+	else
+	{
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "sub_file_entry",
+		 sub_file_entry );
+
+		result = libfsxfs_file_entry_get_inode_number(
+		          sub_file_entry,
+		          &inode_number,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "inode_number",
+		 inode_number,
+		 expected_inode_number );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_file_entry_free(
+		          &sub_file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_get_sub_file_entry_by_utf8_name and
+ * libfsxfs_file_entry_get_sub_file_entry_by_utf16_name functions
+ * The names of the first sub file entries are looked up as is, truncated and
+ * with the case of the ASCII letters changed, which names are compared case sensitive
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_get_sub_file_entry_by_name_of_directory(
+     libfsxfs_file_entry_t *directory_file_entry )
+{
+	uint8_t missing_utf8_string[ 24 ] = {
+		'f', 's', 'x', 'f', 's', '_', 't', 'e', 's', 't', '_', 'm', 'i', 's', 's', 'i', 'n', 'g', '_', 'n', 'a', 'm', 'e', 0 };
+
+	uint8_t case_utf8_string[ 256 ];
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error              = NULL;
+	libfsxfs_file_entry_t *sub_file_entry = NULL;
+	size_t string_index                   = 0;
+	size_t utf8_string_size               = 0;
+	int case_changed                      = 0;
+	int number_of_sub_file_entries        = 0;
+	int result                            = 0;
+	int sub_file_entry_index              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_file_entry_get_number_of_sub_file_entries(
+	          directory_file_entry,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_sub_file_entries > 16 )
+	{
+		number_of_sub_file_entries = 16;
+	}
+	/* Test regular cases
+	 */
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		result = libfsxfs_file_entry_get_sub_file_entry_by_index(
+		          directory_file_entry,
+		          sub_file_entry_index,
+		          &sub_file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_file_entry_get_utf8_name_size(
+		          sub_file_entry,
+		          &utf8_string_size,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+		 "utf8_string_size",
+		 (int) utf8_string_size,
+		 1 );
+
+		FSXFS_TEST_ASSERT_LESS_THAN_INT(
+		 "utf8_string_size",
+		 (int) utf8_string_size,
+		 257 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_file_entry_get_utf8_name(
+		          sub_file_entry,
+		          utf8_string,
+		          256,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_file_entry_free(
+		          &sub_file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The name itself is found
+		 */
+		result = fsxfs_test_file_entry_compare_sub_file_entry_by_name(
+		          directory_file_entry,
+		          utf8_string,
+		          utf8_string_size - 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* A prefix of the name only matches an entry with that exact name
+		 */
+		if( utf8_string_size > 2 )
+		{
+			result = fsxfs_test_file_entry_compare_sub_file_entry_by_name(
+			          directory_file_entry,
+			          utf8_string,
+			          utf8_string_size - 2 );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		/* A name with the case of the ASCII letters changed only matches an entry with that exact name
+		 */
+		case_changed = 0;
+
+		for( string_index = 0;
+		     string_index < ( utf8_string_size - 1 );
+		     string_index++ )
+		{
+			case_utf8_string[ string_index ] = utf8_string[ string_index ];
+
+			if( ( utf8_string[ string_index ] >= (uint8_t) 'a' )
+			 && ( utf8_string[ string_index ] <= (uint8_t) 'z' ) )
+			{
+				case_utf8_string[ string_index ] -= (uint8_t) 'a' - (uint8_t) 'A';
+
+				case_changed = 1;
+			}
+			else if( ( utf8_string[ string_index ] >= (uint8_t) 'A' )
+			      && ( utf8_string[ string_index ] <= (uint8_t) 'Z' ) )
+			{
+				case_utf8_string[ string_index ] += (uint8_t) 'a' - (uint8_t) 'A';
+
+				case_changed = 1;
+			}
+		}
+		if( case_changed != 0 )
+		{
+			result = fsxfs_test_file_entry_compare_sub_file_entry_by_name(
+			          directory_file_entry,
+			          case_utf8_string,
+			          utf8_string_size - 1 );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	/* A name that is not in the directory is not found
+	 */
+	result = fsxfs_test_file_entry_compare_sub_file_entry_by_name(
+	          directory_file_entry,
+	          missing_utf8_string,
+	          23 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Reads ranges using libfsxfs_file_entry_read_ranges and compares them with positional reads
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_read_ranges_and_compare(
+     libfsxfs_file_entry_t *file_entry,
+     off64_t *offsets,
+     size_t *buffer_sizes,
+     int number_of_ranges )
+{
+	void *buffers[ 8 ];
+	ssize_t read_counts[ 8 ];
+
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	uint8_t *pread_data      = NULL;
+	size_t data_offset       = 0;
+	size_t data_size         = 0;
+	size_t maximum_size      = 0;
+	ssize_t pread_count      = 0;
+	int range_index          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	FSXFS_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 9 );
+
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		data_size += buffer_sizes[ range_index ];
+
+		if( buffer_sizes[ range_index ] > maximum_size )
+		{
+			maximum_size = buffer_sizes[ range_index ];
+		}
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	pread_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * maximum_size );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "pread_data",
+	 pread_data );
+
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		buffers[ range_index ]     = &( data[ data_offset ] );
+		read_counts[ range_index ] = -1;
+
+		data_offset += buffer_sizes[ range_index ];
+	}
+	/* Test regular cases
+	 */
+	result = libfsxfs_file_entry_read_ranges(
+	          file_entry,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          number_of_ranges,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every range must contain the same data as a read of the range by itself
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		pread_count = libfsxfs_file_entry_pread_buffer(
+		               file_entry,
+		               pread_data,
+		               buffer_sizes[ range_index ],
+		               offsets[ range_index ],
+		               &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_counts[ range_index ]",
+		 read_counts[ range_index ],
+		 pread_count );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( pread_count > 0 )
+		{
+			result = memory_compare(
+			          buffers[ range_index ],
+			          pread_data,
+			          (size_t) pread_count );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 pread_data );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pread_data != NULL )
+	{
+		memory_free(
+		 pread_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_read_ranges function with ranges that are merged
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_read_merged_ranges(
+     libfsxfs_file_entry_t *file_entry )
 {
+	off64_t offsets[ 8 ];
+	size_t buffer_sizes[ 8 ];
+
 	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	int range_index          = 0;
 	int result               = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libfsxfs_file_entry_free(
-	          NULL,
+	result = libfsxfs_file_entry_get_size(
+	          file_entry,
+	          &size,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* Test unsorted ranges that overlap, are identical, are less than a block apart
+	 * and that end at or start past the end of the data
+	 */
+	offsets[ 0 ]      = (off64_t) ( size / 2 );
+	buffer_sizes[ 0 ] = 64;
+	offsets[ 1 ]      = 64;
+	buffer_sizes[ 1 ] = 128;
+	offsets[ 2 ]      = 0;
+	buffer_sizes[ 2 ] = 128;
+	offsets[ 3 ]      = ( size > 16 ) ? (off64_t) ( size - 16 ) : 0;
+	buffer_sizes[ 3 ] = 64;
+	offsets[ 4 ]      = 448;
+	buffer_sizes[ 4 ] = 64;
+	offsets[ 5 ]      = (off64_t) ( size + 100 );
+	buffer_sizes[ 5 ] = 32;
+	offsets[ 6 ]      = 0;
+	buffer_sizes[ 6 ] = 128;
+	offsets[ 7 ]      = 32;
+	buffer_sizes[ 7 ] = 16;
+
+	result = fsxfs_test_file_entry_read_ranges_and_compare(
+	          file_entry,
+	          offsets,
+	          buffer_sizes,
+	          8 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test adjacent ranges in reverse order that exceed the maximum merged range size of 1 MiB
+	 */
+	for( range_index = 0;
+	     range_index < 6;
+	     range_index++ )
+	{
+		offsets[ range_index ]      = (off64_t) ( 5 - range_index ) * 262144;
+		buffer_sizes[ range_index ] = 262144;
+	}
+	result = fsxfs_test_file_entry_read_ranges_and_compare(
+	          file_entry,
+	          offsets,
+	          buffer_sizes,
+	          6 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a range that is larger than the maximum merged range size and a range it contains
+	 */
+	offsets[ 0 ]      = 100;
+	buffer_sizes[ 0 ] = 16;
+	offsets[ 1 ]      = 0;
+	buffer_sizes[ 1 ] = 1310720;
+
+	result = fsxfs_test_file_entry_read_ranges_and_compare(
+	          file_entry,
+	          offsets,
+	          buffer_sizes,
+	          2 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	return( 1 );
 
@@ -73,25 +2152,368 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+/* Tests the libfsxfs_file_entry_read_async function
+ * The reads are processed concurrently by the threads of the read queue of a volume
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_read_async(
+     libfsxfs_file_entry_t *file_entry,
+     libbfio_handle_t *file_io_handle )
+{
+	uint8_t read_buffers[ 16 ][ 4096 ];
+	uint8_t pread_buffer[ 4096 ];
+	off64_t read_offsets[ 16 ];
+	int read_indexes[ 16 ];
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+	libcerror_error_t *error                = NULL;
+	libfsxfs_file_entry_t *async_file_entry = NULL;
+	libfsxfs_volume_t *volume               = NULL;
+	intptr_t *user_value                    = NULL;
+	size64_t size                           = 0;
+	ssize_t pread_count                     = 0;
+	ssize_t read_count                      = 0;
+	uint64_t inode_number                   = 0;
+	int number_of_pending_reads             = 0;
+	int number_of_reads                     = 0;
+	int read_index                          = 0;
+	int read_number                         = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_file_entry_get_inode_number(
+	          file_entry,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_entry_get_size(
+	          file_entry,
+	          &size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_read_queue_depth(
+	          volume,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_get_file_entry_by_inode(
+	          volume,
+	          inode_number,
+	          &async_file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "async_file_entry",
+	 async_file_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read the data in blocks of 4096 bytes, up to 4 MiB, followed by a read at the end of the data
+	 */
+	number_of_reads = (int) ( size / 4096 ) + 1;
+
+	if( number_of_reads > 1024 )
+	{
+		number_of_reads = 1024;
+	}
+	number_of_reads += 1;
+
+	/* Test regular cases
+	 */
+	while( read_number < number_of_reads )
+	{
+		for( number_of_pending_reads = 0;
+		     ( number_of_pending_reads < 16 ) && ( read_number < number_of_reads );
+		     number_of_pending_reads++ )
+		{
+			if( read_number == ( number_of_reads - 1 ) )
+			{
+				read_offsets[ number_of_pending_reads ] = (off64_t) size;
+			}
+			else
+			{
+				read_offsets[ number_of_pending_reads ] = (off64_t) read_number * 4096;
+			}
+			read_indexes[ number_of_pending_reads ] = number_of_pending_reads;
+
+			result = libfsxfs_file_entry_read_async(
+			          async_file_entry,
+			          read_buffers[ number_of_pending_reads ],
+			          4096,
+			          read_offsets[ number_of_pending_reads ],
+			          (intptr_t *) &( read_indexes[ number_of_pending_reads ] ),
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			read_number++;
+		}
+		/* The reads can complete in any order
+		 */
+		while( number_of_pending_reads > 0 )
+		{
+			result = libfsxfs_volume_wait_for_read(
+			          volume,
+			          &user_value,
+			          &read_count,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			read_index = *( (int *) user_value );
+
+			pread_count = libfsxfs_file_entry_pread_buffer(
+			               file_entry,
+			               pread_buffer,
+			               4096,
+			               read_offsets[ read_index ],
+			               &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 pread_count );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( read_count > 0 )
+			{
+				result = memory_compare(
+				          read_buffers[ read_index ],
+				          pread_buffer,
+				          (size_t) read_count );
+
+				FSXFS_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+			}
+			number_of_pending_reads--;
+		}
+	}
+	/* All reads have been retrieved
+	 */
+	result = libfsxfs_volume_wait_for_read(
+	          volume,
+	          &user_value,
+	          &read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_file_entry_free(
+	          &async_file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_volume_close_source(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	/* The volume is freed first so that the threads of the read queue have stopped
+	 * before the file entry is freed and the buffers go out of scope
+	 */
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( async_file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &async_file_entry,
+		 NULL );
+	}
+	return( 0 );
+}
 
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
-	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcerror_error_t *error                  = NULL;
+	libfsxfs_file_entry_t *file_entry         = NULL;
+	libfsxfs_file_entry_t *root_directory     = NULL;
+	libfsxfs_volume_t *volume                 = NULL;
+	system_character_t *option_offset         = NULL;
+	system_character_t *source                = NULL;
+	system_integer_t option                   = 0;
+	size_t string_length                      = 0;
+	off64_t volume_offset                     = 0;
+	int result                                = 0;
+
+	while( ( option = fsxfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "o:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
 
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	if( option_offset != NULL )
+	{
+		string_length = system_string_length(
+		                 option_offset );
+
+		result = fsxfs_test_system_string_copy_from_64_bit_in_decimal(
+		          option_offset,
+		          string_length + 1,
+		          (uint64_t *) &volume_offset,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 #if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
 
 	/* TODO: add tests for libfsxfs_file_entry_initialize */
@@ -102,6 +2524,30 @@ int main(
 	 "libfsxfs_file_entry_free",
 	 fsxfs_test_file_entry_free );
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_file_entry_pread_buffer",
+	 fsxfs_test_file_entry_pread_buffer );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_file_entry_read_ranges",
+	 fsxfs_test_file_entry_read_ranges );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_file_entry_get_directory_entries",
+	 fsxfs_test_file_entry_get_directory_entries );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_file_entry_read_directory_entries",
+	 fsxfs_test_file_entry_read_directory_entries );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_file_entry_get_sub_file_entry_by_utf8_name",
+	 fsxfs_test_file_entry_get_sub_file_entry_by_utf8_name );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_file_entry_get_sub_file_entry_by_utf16_name",
+	 fsxfs_test_file_entry_get_sub_file_entry_by_utf16_name );
+
 #if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
 
 	/* TODO: add tests for libfsxfs_file_entry_is_empty */
@@ -132,18 +2578,8 @@ int main(
 
 	/* TODO: add tests for libfsxfs_file_entry_get_sub_file_entry_by_index */
 
-	/* TODO: add tests for libfsxfs_file_entry_get_sub_file_entry_by_utf8_name */
-
-	/* TODO: add tests for libfsxfs_file_entry_get_sub_file_entry_by_utf16_name */
-
-	/* TODO: add tests for libfsxfs_file_entry_read_buffer */
-
 	/* TODO: add tests for libfsxfs_file_entry_read_buffer_at_offset */
 
-	/* TODO: add tests for libfsxfs_file_entry_seek_offset */
-
-	/* TODO: add tests for libfsxfs_file_entry_get_offset */
-
 	/* TODO: add tests for libfsxfs_file_entry_get_size */
 
 	/* TODO: add tests for libfsxfs_file_entry_get_number_of_extents */
@@ -152,9 +2588,265 @@ int main(
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_range_initialize(
+		          &file_io_handle,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_range_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_range_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_range_set(
+		          file_io_handle,
+		          volume_offset,
+		          0,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_check_volume_signature_file_io_handle(
+		          file_io_handle,
+		          &error );
+
+		FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result != 0 )
+	{
+		/* Initialize volume and file entries for tests
+		 */
+		result = fsxfs_test_volume_open_source(
+		          &volume,
+		          file_io_handle,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_volume_get_root_directory(
+		          volume,
+		          &root_directory,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "root_directory",
+		 root_directory );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_file_entry_get_directory_entries",
+		 fsxfs_test_file_entry_get_directory_entries_of_directory,
+		 root_directory );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_file_entry_read_directory_entries",
+		 fsxfs_test_file_entry_read_directory_entries_of_directory,
+		 root_directory );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_file_entry_get_sub_file_entry_by_name",
+		 fsxfs_test_file_entry_get_sub_file_entry_by_name_of_directory,
+		 root_directory );
+
+		result = fsxfs_test_file_entry_get_file_with_data(
+		          root_directory,
+		          0,
+		          &file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( file_entry != NULL )
+		{
+			FSXFS_TEST_RUN_WITH_ARGS(
+			 "libfsxfs_file_entry_read_buffer",
+			 fsxfs_test_file_entry_read_buffer,
+			 file_entry );
+
+			FSXFS_TEST_RUN_WITH_ARGS(
+			 "libfsxfs_file_entry_read_ranges",
+			 fsxfs_test_file_entry_read_merged_ranges,
+			 file_entry );
+
+			FSXFS_TEST_RUN_WITH_ARGS(
+			 "libfsxfs_file_entry_read_async",
+			 fsxfs_test_file_entry_read_async,
+			 file_entry,
+			 file_io_handle );
+
+			result = libfsxfs_file_entry_free(
+			          &file_entry,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Clean up
+		 */
+		result = libfsxfs_file_entry_free(
+		          &root_directory,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = fsxfs_test_volume_close_source(
+		          &volume,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file_io_handle != NULL )
+	{
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( root_directory != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
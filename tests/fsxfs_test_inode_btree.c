@@ -35,6 +35,11 @@
 
 #include "../libfsxfs/libfsxfs_inode_btree.h"
 
+uint8_t fsxfs_test_inode_btree_leaf_node_records_data1[ 48 ] = {
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe };
+
 #if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
 
 /* Tests the libfsxfs_inode_btree_initialize function
@@ -270,6 +275,411 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsxfs_inode_btree_set_number_of_allocation_groups function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_btree_set_number_of_allocation_groups(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsxfs_inode_btree_t *inode_btree = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_btree_initialize(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          NULL,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          inode_btree,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          inode_btree,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          inode_btree,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_btree_free(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_btree != NULL )
+	{
+		libfsxfs_inode_btree_free(
+		 &inode_btree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_btree_get_inode_from_leaf_node function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_btree_get_inode_from_leaf_node(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsxfs_inode_btree_t *inode_btree = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_btree_initialize(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_leaf_node_records_data1,
+	          48,
+	          64,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_leaf_node_records_data1,
+	          48,
+	          191,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_leaf_node_records_data1,
+	          48,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inode numbers that are marked as free
+	 */
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_leaf_node_records_data1,
+	          48,
+	          70,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_leaf_node_records_data1,
+	          48,
+	          319,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inode numbers that are not covered by a record
+	 */
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_leaf_node_records_data1,
+	          48,
+	          63,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_leaf_node_records_data1,
+	          48,
+	          192,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_leaf_node_records_data1,
+	          48,
+	          320,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          NULL,
+	          3,
+	          fsxfs_test_inode_btree_leaf_node_records_data1,
+	          48,
+	          64,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          NULL,
+	          48,
+	          64,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          4,
+	          fsxfs_test_inode_btree_leaf_node_records_data1,
+	          48,
+	          64,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_btree_free(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_btree != NULL )
+	{
+		libfsxfs_inode_btree_free(
+		 &inode_btree,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 /* The main program
@@ -297,6 +707,14 @@ int main(
 	 "libfsxfs_inode_btree_free",
 	 fsxfs_test_inode_btree_free );
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_btree_set_number_of_allocation_groups",
+	 fsxfs_test_inode_btree_set_number_of_allocation_groups );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_btree_get_inode_from_leaf_node",
+	 fsxfs_test_inode_btree_get_inode_from_leaf_node );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
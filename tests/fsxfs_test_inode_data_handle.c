@@ -0,0 +1,874 @@
+/*
+ * Library inode_data_handle type test program
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcdata.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_extent.h"
+#include "../libfsxfs/libfsxfs_extent_map.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+#include "../libfsxfs/libfsxfs_inode_data_handle.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+
+uint8_t fsxfs_test_inode_data_handle_data1[ 64 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f };
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Creates an inode with a data extent map that maps the test data
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_inode_data_handle_create_inode(
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *extents_array = NULL;
+	libfsxfs_extent_t *extent       = NULL;
+	int entry_index                 = 0;
+
+	if( libfsxfs_inode_initialize(
+	     inode,
+	     512,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &extents_array,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsxfs_extent_initialize(
+	     &extent,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	extent->logical_block_number  = 0;
+	extent->physical_block_number = 0;
+	extent->number_of_blocks      = 4;
+
+	if( libcdata_array_append_entry(
+	     extents_array,
+	     &entry_index,
+	     (intptr_t *) extent,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	extent = NULL;
+
+	if( libfsxfs_extent_map_initialize(
+	     &( ( *inode )->data_extent_map ),
+	     extents_array,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_array_free(
+	     &extents_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( extent != NULL )
+	{
+		libfsxfs_extent_free(
+		 &extent,
+		 NULL );
+	}
+	if( extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+		 NULL );
+	}
+	if( *inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libfsxfs_inode_data_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_data_handle_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsxfs_inode_data_handle_t *data_handle = NULL;
+	libfsxfs_inode_t *inode                   = NULL;
+	libfsxfs_io_handle_t *io_handle           = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_inode_data_handle_create_inode(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_data_handle_initialize(
+	          &data_handle,
+	          io_handle,
+	          inode,
+	          64,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_data_handle_initialize(
+	          NULL,
+	          io_handle,
+	          inode,
+	          64,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_handle = (libfsxfs_inode_data_handle_t *) 0x12345678UL;
+
+	result = libfsxfs_inode_data_handle_initialize(
+	          &data_handle,
+	          io_handle,
+	          inode,
+	          64,
+	          &error );
+
+	data_handle = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_data_handle_initialize(
+	          &data_handle,
+	          NULL,
+	          inode,
+	          64,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_data_handle_initialize(
+	          &data_handle,
+	          io_handle,
+	          NULL,
+	          64,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_handle != NULL )
+	{
+		libfsxfs_inode_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_data_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_data_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_data_handle_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_data_handle_read_segment_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_data_handle_read_segment_data(
+     void )
+{
+	uint8_t segment_data[ 16 ];
+
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfsxfs_inode_data_handle_t *data_handle = NULL;
+	libfsxfs_inode_t *inode                   = NULL;
+	libfsxfs_io_handle_t *io_handle           = NULL;
+	ssize_t read_count                        = 0;
+	off64_t offset                            = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size                           = 16;
+	io_handle->allocation_group_size                = 256;
+	io_handle->number_of_relative_block_number_bits = 8;
+	io_handle->maximum_readahead_size               = 32;
+
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsxfs_test_inode_data_handle_data1,
+	          64,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_inode_data_handle_create_inode(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_data_handle_initialize(
+	          &data_handle,
+	          io_handle,
+	          inode,
+	          64,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+
+	/* A sequential read fills the readahead buffer
+	 */
+	read_count = libfsxfs_inode_data_handle_read_segment_data(
+	              data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              8,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          fsxfs_test_inode_data_handle_data1,
+	          8 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_handle->readahead_buffer_data_size",
+	 data_handle->readahead_buffer_data_size,
+	 (size_t) 32 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_handle->readahead_buffer_size",
+	 data_handle->readahead_buffer_size,
+	 (size_t) 32 );
+
+	/* A read that spans the end of the readahead buffer refills it
+	 */
+	read_count = libfsxfs_inode_data_handle_read_segment_data(
+	              data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              16,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          &( fsxfs_test_inode_data_handle_data1[ 8 ] ),
+	          16 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libfsxfs_inode_data_handle_read_segment_data(
+	              data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              16,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          &( fsxfs_test_inode_data_handle_data1[ 24 ] ),
+	          16 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "data_handle->readahead_buffer_offset",
+	 (int64_t) data_handle->readahead_buffer_offset,
+	 (int64_t) 32 );
+
+	/* A non-sequential read outside the readahead buffer resets the readahead window
+	 */
+	offset = libfsxfs_inode_data_handle_seek_segment_offset(
+	          data_handle,
+	          file_io_handle,
+	          0,
+	          0,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 4 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsxfs_inode_data_handle_read_segment_data(
+	              data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              8,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          &( fsxfs_test_inode_data_handle_data1[ 4 ] ),
+	          8 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_handle->readahead_size",
+	 data_handle->readahead_size,
+	 (size_t) 0 );
+
+	/* A read at the end of the data returns 0
+	 */
+	offset = libfsxfs_inode_data_handle_seek_segment_offset(
+	          data_handle,
+	          file_io_handle,
+	          0,
+	          0,
+	          64,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 64 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsxfs_inode_data_handle_read_segment_data(
+	              data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              16,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsxfs_inode_data_handle_read_segment_data(
+	              NULL,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              16,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_inode_data_handle_read_segment_data(
+	              data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              NULL,
+	              16,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_handle != NULL )
+	{
+		libfsxfs_inode_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_data_handle_initialize",
+	 fsxfs_test_inode_data_handle_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_data_handle_free",
+	 fsxfs_test_inode_data_handle_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_data_handle_read_segment_data",
+	 fsxfs_test_inode_data_handle_read_segment_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
@@ -0,0 +1,991 @@
+/*
+ * Library inode_scanner type test program
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_file_system.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+#include "../libfsxfs/libfsxfs_inode_scanner.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Callback function of the inode scanner tests
+ * Returns 1 to continue or -1 on error
+ */
+int fsxfs_test_inode_scanner_callback(
+     uint64_t inode_number FSXFS_TEST_ATTRIBUTE_UNUSED,
+     libfsxfs_inode_t *inode,
+     libbfio_handle_t *file_io_handle FSXFS_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data FSXFS_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( inode_number )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( file_io_handle )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( callback_data )
+
+	if( libfsxfs_inode_free(
+	     &inode,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libfsxfs_inode_scanner_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_scanner_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfsxfs_file_system_t *file_system     = NULL;
+	libfsxfs_inode_scanner_t *inode_scanner = NULL;
+	libfsxfs_io_handle_t *io_handle         = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_system_initialize(
+	          &file_system,
+	          128,
+	          16,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system",
+	 file_system );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          file_system,
+	          io_handle,
+	          &fsxfs_test_inode_scanner_callback,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_scanner_free(
+	          &inode_scanner,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_scanner_initialize(
+	          NULL,
+	          file_system,
+	          io_handle,
+	          &fsxfs_test_inode_scanner_callback,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inode_scanner = (libfsxfs_inode_scanner_t *) 0x12345678UL;
+
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          file_system,
+	          io_handle,
+	          &fsxfs_test_inode_scanner_callback,
+	          NULL,
+	          &error );
+
+	inode_scanner = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          NULL,
+	          io_handle,
+	          &fsxfs_test_inode_scanner_callback,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          file_system,
+	          NULL,
+	          &fsxfs_test_inode_scanner_callback,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          file_system,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_file_system_free(
+	          &file_system,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "file_system",
+	 file_system );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_scanner != NULL )
+	{
+		libfsxfs_inode_scanner_free(
+		 &inode_scanner,
+		 NULL );
+	}
+	if( file_system != NULL )
+	{
+		libfsxfs_file_system_free(
+		 &file_system,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_scanner_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_scanner_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_scanner_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_scanner_push_task, libfsxfs_inode_scanner_pop_task
+ * and libfsxfs_inode_scanner_complete_task functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_scanner_tasks(
+     void )
+{
+	libfsxfs_inode_scan_task_t task;
+
+	libcerror_error_t *error                = NULL;
+	libfsxfs_file_system_t *file_system     = NULL;
+	libfsxfs_inode_scanner_t *inode_scanner = NULL;
+	libfsxfs_io_handle_t *io_handle         = NULL;
+	int result                              = 0;
+	int task_index                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_system_initialize(
+	          &file_system,
+	          128,
+	          16,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system",
+	 file_system );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          file_system,
+	          io_handle,
+	          &fsxfs_test_inode_scanner_callback,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Push more tasks than are initially allocated to test resizing the tasks
+	 */
+	for( task_index = 0;
+	     task_index < 100;
+	     task_index++ )
+	{
+		result = libfsxfs_inode_scanner_push_task(
+		          inode_scanner,
+		          (uint32_t) task_index,
+		          NULL,
+		          0,
+		          0,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "inode_scanner->number_of_tasks",
+	 inode_scanner->number_of_tasks,
+	 100 );
+
+	/* The most recently pushed task is popped first
+	 */
+	result = libfsxfs_inode_scanner_pop_task(
+	          inode_scanner,
+	          &task,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "task.allocation_group_index",
+	 task.allocation_group_index,
+	 (uint32_t) 99 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "inode_scanner->number_of_busy_tasks",
+	 inode_scanner->number_of_busy_tasks,
+	 1 );
+
+	/* Completing a task that was stopped stops the scan
+	 */
+	result = libfsxfs_inode_scanner_complete_task(
+	          inode_scanner,
+	          &task,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "inode_scanner->number_of_busy_tasks",
+	 inode_scanner->number_of_busy_tasks,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "inode_scanner->result",
+	 inode_scanner->result,
+	 0 );
+
+	result = libfsxfs_inode_scanner_pop_task(
+	          inode_scanner,
+	          &task,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_scanner_push_task(
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_push_task(
+	          inode_scanner,
+	          0,
+	          NULL,
+	          -1,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_pop_task(
+	          NULL,
+	          &task,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_pop_task(
+	          inode_scanner,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_complete_task(
+	          NULL,
+	          &task,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_complete_task(
+	          inode_scanner,
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_scanner_free(
+	          &inode_scanner,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_system_free(
+	          &file_system,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "file_system",
+	 file_system );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_scanner != NULL )
+	{
+		libfsxfs_inode_scanner_free(
+		 &inode_scanner,
+		 NULL );
+	}
+	if( file_system != NULL )
+	{
+		libfsxfs_file_system_free(
+		 &file_system,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_scanner_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_scanner_scan(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfsxfs_file_system_t *file_system     = NULL;
+	libfsxfs_inode_scanner_t *inode_scanner = NULL;
+	libfsxfs_io_handle_t *io_handle         = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_system_initialize(
+	          &file_system,
+	          128,
+	          16,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system",
+	 file_system );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          file_system,
+	          io_handle,
+	          &fsxfs_test_inode_scanner_callback,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_scanner_scan(
+	          inode_scanner,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_scanner_scan(
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_scan(
+	          inode_scanner,
+	          NULL,
+	          0,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_scanner_free(
+	          &inode_scanner,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_system_free(
+	          &file_system,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "file_system",
+	 file_system );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_scanner != NULL )
+	{
+		libfsxfs_inode_scanner_free(
+		 &inode_scanner,
+		 NULL );
+	}
+	if( file_system != NULL )
+	{
+		libfsxfs_file_system_free(
+		 &file_system,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_scanner_initialize",
+	 fsxfs_test_inode_scanner_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_scanner_free",
+	 fsxfs_test_inode_scanner_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_scanner_tasks",
+	 fsxfs_test_inode_scanner_tasks );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_scanner_scan",
+	 fsxfs_test_inode_scanner_scan );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
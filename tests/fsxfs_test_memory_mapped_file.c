@@ -0,0 +1,971 @@
+/*
+ * Library memory_mapped_file type test program
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_memory_mapped_file.h"
+
+#if defined( HAVE_ERRNO_H ) && defined( HAVE_FCNTL_H ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && !defined( WINAPI )
+#define FSXFS_TEST_HAVE_MEMORY_MAPPED_FILE_SUPPORT
+#endif
+
+uint8_t fsxfs_test_memory_mapped_file_data1[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_memory_mapped_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_memory_mapped_file_initialize(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libfsxfs_memory_mapped_file_t *memory_mapped_file = NULL;
+	int result                                        = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                   = 1;
+	int number_of_memset_fail_tests                   = 1;
+	int test_number                                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_memory_mapped_file_initialize(
+	          &memory_mapped_file,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_mapped_file",
+	 memory_mapped_file );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_memory_mapped_file_free(
+	          &memory_mapped_file,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "memory_mapped_file",
+	 memory_mapped_file );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_memory_mapped_file_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_mapped_file = (libfsxfs_memory_mapped_file_t *) 0x12345678UL;
+
+	result = libfsxfs_memory_mapped_file_initialize(
+	          &memory_mapped_file,
+	          &error );
+
+	memory_mapped_file = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_memory_mapped_file_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_memory_mapped_file_initialize(
+		          &memory_mapped_file,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( memory_mapped_file != NULL )
+			{
+				libfsxfs_memory_mapped_file_free(
+				 &memory_mapped_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "memory_mapped_file",
+			 memory_mapped_file );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_memory_mapped_file_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_memory_mapped_file_initialize(
+		          &memory_mapped_file,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( memory_mapped_file != NULL )
+			{
+				libfsxfs_memory_mapped_file_free(
+				 &memory_mapped_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "memory_mapped_file",
+			 memory_mapped_file );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_mapped_file != NULL )
+	{
+		libfsxfs_memory_mapped_file_free(
+		 &memory_mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_memory_mapped_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_memory_mapped_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_memory_mapped_file_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_memory_mapped_file_open function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_memory_mapped_file_open(
+     void )
+{
+#if defined( FSXFS_TEST_HAVE_MEMORY_MAPPED_FILE_SUPPORT )
+	char temporary_filename[ 24 ] = "fsxfs_test_mmap_XXXXXX";
+	uint8_t buffer[ 8 ];
+
+	ssize_t read_count                                = 0;
+	ssize_t write_count                               = 0;
+	int file_descriptor                               = -1;
+	int temporary_file_exists                         = 0;
+#endif
+	libcerror_error_t *error                          = NULL;
+	libfsxfs_memory_mapped_file_t *memory_mapped_file = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_memory_mapped_file_initialize(
+	          &memory_mapped_file,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_mapped_file",
+	 memory_mapped_file );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( FSXFS_TEST_HAVE_MEMORY_MAPPED_FILE_SUPPORT )
+
+	/* Test regular cases
+	 */
+	file_descriptor = mkstemp(
+	                   temporary_filename );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "file_descriptor",
+	 file_descriptor,
+	 -1 );
+
+	temporary_file_exists = 1;
+
+	write_count = write(
+	               file_descriptor,
+	               fsxfs_test_memory_mapped_file_data1,
+	               16 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 16 );
+
+	result = close(
+	          file_descriptor );
+
+	file_descriptor = -1;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsxfs_memory_mapped_file_open(
+	          memory_mapped_file,
+	          temporary_filename,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_mapped_file->data_size",
+	 (uint64_t) memory_mapped_file->data_size,
+	 (uint64_t) 16 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsxfs_memory_mapped_file_read_buffer_at_offset(
+	              memory_mapped_file,
+	              buffer,
+	              8,
+	              4,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( fsxfs_test_memory_mapped_file_data1[ 4 ] ),
+	          8 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error case where the file is already mapped
+	 */
+	result = libfsxfs_memory_mapped_file_open(
+	          memory_mapped_file,
+	          temporary_filename,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_memory_mapped_file_close(
+	          memory_mapped_file,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "memory_mapped_file->data",
+	 memory_mapped_file->data );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = unlink(
+	          temporary_filename );
+
+	temporary_file_exists = 0;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#endif /* defined( FSXFS_TEST_HAVE_MEMORY_MAPPED_FILE_SUPPORT ) */
+
+	/* Test error cases
+	 */
+	result = libfsxfs_memory_mapped_file_open(
+	          NULL,
+	          "test",
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_memory_mapped_file_open(
+	          memory_mapped_file,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_memory_mapped_file_free(
+	          &memory_mapped_file,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_mapped_file != NULL )
+	{
+		libfsxfs_memory_mapped_file_free(
+		 &memory_mapped_file,
+		 NULL );
+	}
+#if defined( FSXFS_TEST_HAVE_MEMORY_MAPPED_FILE_SUPPORT )
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	if( temporary_file_exists != 0 )
+	{
+		unlink(
+		 temporary_filename );
+	}
+#endif
+	return( 0 );
+}
+
+/* Tests the libfsxfs_memory_mapped_file_get_data_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_memory_mapped_file_get_data_at_offset(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libfsxfs_memory_mapped_file_t *memory_mapped_file = NULL;
+	const uint8_t *data                               = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_memory_mapped_file_initialize(
+	          &memory_mapped_file,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_mapped_file",
+	 memory_mapped_file );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases on an unmapped file
+	 */
+	result = libfsxfs_memory_mapped_file_get_data_at_offset(
+	          memory_mapped_file,
+	          0,
+	          8,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The test data is used as mapped data
+	 */
+	memory_mapped_file->data      = fsxfs_test_memory_mapped_file_data1;
+	memory_mapped_file->data_size = 16;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_memory_mapped_file_get_data_at_offset(
+	          memory_mapped_file,
+	          8,
+	          8,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "data == &( fsxfs_test_memory_mapped_file_data1[ 8 ] )",
+	 (int) ( data == &( fsxfs_test_memory_mapped_file_data1[ 8 ] ) ),
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_memory_mapped_file_get_data_at_offset(
+	          NULL,
+	          0,
+	          8,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_memory_mapped_file_get_data_at_offset(
+	          memory_mapped_file,
+	          -1,
+	          8,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_memory_mapped_file_get_data_at_offset(
+	          memory_mapped_file,
+	          12,
+	          8,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_memory_mapped_file_get_data_at_offset(
+	          memory_mapped_file,
+	          0,
+	          8,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_mapped_file->data      = NULL;
+	memory_mapped_file->data_size = 0;
+
+	result = libfsxfs_memory_mapped_file_free(
+	          &memory_mapped_file,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_mapped_file != NULL )
+	{
+		memory_mapped_file->data      = NULL;
+		memory_mapped_file->data_size = 0;
+
+		libfsxfs_memory_mapped_file_free(
+		 &memory_mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_memory_mapped_file_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_memory_mapped_file_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error                          = NULL;
+	libfsxfs_memory_mapped_file_t *memory_mapped_file = NULL;
+	ssize_t read_count                                = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_memory_mapped_file_initialize(
+	          &memory_mapped_file,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_mapped_file",
+	 memory_mapped_file );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The test data is used as mapped data
+	 */
+	memory_mapped_file->data      = fsxfs_test_memory_mapped_file_data1;
+	memory_mapped_file->data_size = 16;
+
+	/* Test regular cases
+	 */
+	read_count = libfsxfs_memory_mapped_file_read_buffer_at_offset(
+	              memory_mapped_file,
+	              buffer,
+	              16,
+	              4,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 12 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( fsxfs_test_memory_mapped_file_data1[ 4 ] ),
+	          12 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libfsxfs_memory_mapped_file_read_buffer_at_offset(
+	              memory_mapped_file,
+	              buffer,
+	              16,
+	              16,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsxfs_memory_mapped_file_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_memory_mapped_file_read_buffer_at_offset(
+	              memory_mapped_file,
+	              NULL,
+	              16,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_memory_mapped_file_read_buffer_at_offset(
+	              memory_mapped_file,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_memory_mapped_file_read_buffer_at_offset(
+	              memory_mapped_file,
+	              buffer,
+	              16,
+	              -1,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_mapped_file->data      = NULL;
+	memory_mapped_file->data_size = 0;
+
+	result = libfsxfs_memory_mapped_file_free(
+	          &memory_mapped_file,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_mapped_file != NULL )
+	{
+		memory_mapped_file->data      = NULL;
+		memory_mapped_file->data_size = 0;
+
+		libfsxfs_memory_mapped_file_free(
+		 &memory_mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_memory_mapped_file_initialize",
+	 fsxfs_test_memory_mapped_file_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_memory_mapped_file_free",
+	 fsxfs_test_memory_mapped_file_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_memory_mapped_file_open",
+	 fsxfs_test_memory_mapped_file_open );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_memory_mapped_file_get_data_at_offset",
+	 fsxfs_test_memory_mapped_file_get_data_at_offset );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_memory_mapped_file_read_buffer_at_offset",
+	 fsxfs_test_memory_mapped_file_read_buffer_at_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
@@ -0,0 +1,1302 @@
+/*
+ * Library read_queue type test program
+ *
+ * Copyright (C) 2020-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcdata.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_extent.h"
+#include "../libfsxfs/libfsxfs_extent_map.h"
+#include "../libfsxfs/libfsxfs_file_entry.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+#include "../libfsxfs/libfsxfs_read_queue.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_read_request_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_request_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_read_request_t *read_request = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_read_request_initialize(
+	          &read_request,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_request_free(
+	          &read_request,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "read_request",
+	 read_request );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_request_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_request = (libfsxfs_read_request_t *) 0x12345678UL;
+
+	result = libfsxfs_read_request_initialize(
+	          &read_request,
+	          &error );
+
+	read_request = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_read_request_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_read_request_initialize(
+		          &read_request,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( read_request != NULL )
+			{
+				libfsxfs_read_request_free(
+				 &read_request,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "read_request",
+			 read_request );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_read_request_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_read_request_initialize(
+		          &read_request,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( read_request != NULL )
+			{
+				libfsxfs_read_request_free(
+				 &read_request,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "read_request",
+			 read_request );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_request != NULL )
+	{
+		libfsxfs_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_request_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_request_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_request_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_queue_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfsxfs_read_queue_t *read_queue = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_queue_initialize(
+	          NULL,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_queue = (libfsxfs_read_queue_t *) 0x12345678UL;
+
+	result = libfsxfs_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          &error );
+
+	read_queue = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfsxfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_queue_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_queue_push_request function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_queue_push_request(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error          = NULL;
+	libfsxfs_read_queue_t *read_queue = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_read_queue_initialize(
+	          &read_queue,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_queue_push_request(
+	          NULL,
+	          (libfsxfs_file_entry_t *) 0x12345678UL,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_push_request(
+	          read_queue,
+	          NULL,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_push_request(
+	          read_queue,
+	          (libfsxfs_file_entry_t *) 0x12345678UL,
+	          NULL,
+	          NULL,
+	          16,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_push_request(
+	          read_queue,
+	          (libfsxfs_file_entry_t *) 0x12345678UL,
+	          NULL,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_push_request(
+	          read_queue,
+	          (libfsxfs_file_entry_t *) 0x12345678UL,
+	          NULL,
+	          buffer,
+	          16,
+	          -1,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfsxfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_queue_pop_completed_request function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_queue_pop_completed_request(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_read_queue_t *read_queue     = NULL;
+	libfsxfs_read_request_t *read_request = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_read_queue_initialize(
+	          &read_queue,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_read_queue_pop_completed_request(
+	          read_queue,
+	          0,
+	          &read_request,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "read_request",
+	 read_request );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Waiting does not block when no requests are pending
+	 */
+	result = libfsxfs_read_queue_pop_completed_request(
+	          read_queue,
+	          1,
+	          &read_request,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "read_request",
+	 read_request );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_queue_pop_completed_request(
+	          NULL,
+	          0,
+	          &read_request,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_pop_completed_request(
+	          read_queue,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfsxfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests reading data using the read queue
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_queue_read(
+     void )
+{
+	uint8_t buffers[ 5 ][ 16 ];
+	uint8_t data[ 48 ];
+
+	/* Logical block 0 is stored in physical block 2, logical blocks 1 and 2
+	 * in physical blocks 0 and 1 and logical block 3 is sparse
+	 */
+	uint64_t extent_values[ 6 ] = {
+		0, 2, 1,
+		1, 0, 2 };
+
+	off64_t read_offsets[ 5 ] = {
+		0, 16, 40, 48, 64 };
+
+	ssize_t expected_read_counts[ 5 ] = {
+		16, 16, 16, 16, 0 };
+
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_t *extent             = NULL;
+	libfsxfs_file_entry_t *file_entry     = NULL;
+	libfsxfs_inode_t *inode               = NULL;
+	libfsxfs_io_handle_t *io_handle       = NULL;
+	libfsxfs_read_queue_t *read_queue     = NULL;
+	libfsxfs_read_request_t *read_request = NULL;
+	size_t data_offset                    = 0;
+	size_t expected_offset                = 0;
+	off64_t logical_offset                = 0;
+	int completed_requests[ 5 ]           = { 0, 0, 0, 0, 0 };
+	int entry_index                       = 0;
+	int extent_index                      = 0;
+	int number_of_completed_requests      = 0;
+	int request_index                     = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 48;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset + 1 );
+	}
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size                           = 16;
+	io_handle->allocation_group_size                = 256;
+	io_handle->number_of_relative_block_number_bits = 8;
+
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          48,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          512,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Regular file with data fork type extents
+	 */
+	inode->file_mode = 0x81a4;
+	inode->fork_type = 2;
+	inode->size      = 64;
+
+	result = libcdata_array_initialize(
+	          &( inode->data_extents_array ),
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( extent_index = 0;
+	     extent_index < 2;
+	     extent_index++ )
+	{
+		result = libfsxfs_extent_initialize(
+		          &extent,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		extent->logical_block_number  = extent_values[ ( extent_index * 3 ) ];
+		extent->physical_block_number = extent_values[ ( extent_index * 3 ) + 1 ];
+		extent->number_of_blocks      = (uint32_t) extent_values[ ( extent_index * 3 ) + 2 ];
+
+		result = libcdata_array_append_entry(
+		          inode->data_extents_array,
+		          &entry_index,
+		          (intptr_t *) extent,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		extent = NULL;
+	}
+	inode->number_of_data_extents = 2;
+
+	result = libfsxfs_extent_map_initialize(
+	          &( inode->data_extent_map ),
+	          inode->data_extents_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file entry takes over management of the inode
+	 */
+	result = libfsxfs_file_entry_initialize(
+	          &file_entry,
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          5,
+	          inode,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	inode = NULL;
+
+	result = libfsxfs_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( request_index = 0;
+	     request_index < 5;
+	     request_index++ )
+	{
+		memory_set(
+		 buffers[ request_index ],
+		 0xff,
+		 16 );
+
+		result = libfsxfs_read_queue_push_request(
+		          read_queue,
+		          file_entry,
+		          file_io_handle,
+		          buffers[ request_index ],
+		          16,
+		          read_offsets[ request_index ],
+		          (intptr_t *) &( completed_requests[ request_index ] ),
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Every pushed request is returned exactly once
+	 */
+	while( number_of_completed_requests < 5 )
+	{
+		result = libfsxfs_read_queue_pop_completed_request(
+		          read_queue,
+		          1,
+		          &read_request,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "read_request",
+		 read_request );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		request_index = (int) ( (int *) read_request->user_value - completed_requests );
+
+		FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+		 "request_index",
+		 request_index,
+		 -1 );
+
+		FSXFS_TEST_ASSERT_LESS_THAN_INT(
+		 "request_index",
+		 request_index,
+		 5 );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "completed_requests[ request_index ]",
+		 completed_requests[ request_index ],
+		 0 );
+
+		completed_requests[ request_index ] = 1;
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "read_request->read_error",
+		 read_request->read_error );
+
+		FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_request->read_count",
+		 read_request->read_count,
+		 expected_read_counts[ request_index ] );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT64(
+		 "read_request->offset",
+		 (int64_t) read_request->offset,
+		 (int64_t) read_offsets[ request_index ] );
+
+		for( data_offset = 0;
+		     data_offset < (size_t) expected_read_counts[ request_index ];
+		     data_offset++ )
+		{
+			logical_offset = read_offsets[ request_index ] + (off64_t) data_offset;
+
+			if( logical_offset < 16 )
+			{
+				expected_offset = (size_t) ( logical_offset + 32 );
+			}
+			else if( logical_offset < 48 )
+			{
+				expected_offset = (size_t) ( logical_offset - 16 );
+			}
+			else
+			{
+				/* Sparse data is read as zero bytes
+				 */
+				FSXFS_TEST_ASSERT_EQUAL_UINT8(
+				 "buffer",
+				 buffers[ request_index ][ data_offset ],
+				 0 );
+
+				continue;
+			}
+			FSXFS_TEST_ASSERT_EQUAL_UINT8(
+			 "buffer",
+			 buffers[ request_index ][ data_offset ],
+			 data[ expected_offset ] );
+		}
+		result = libfsxfs_read_request_free(
+		          &read_request,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_completed_requests++;
+	}
+	/* No requests are left after all completions were returned
+	 */
+	result = libfsxfs_read_queue_pop_completed_request(
+	          read_queue,
+	          1,
+	          &read_request,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "read_request",
+	 read_request );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_request != NULL )
+	{
+		libfsxfs_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	if( read_queue != NULL )
+	{
+		libfsxfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( extent != NULL )
+	{
+		libfsxfs_extent_free(
+		 &extent,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_request_initialize",
+	 fsxfs_test_read_request_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_request_free",
+	 fsxfs_test_read_request_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_queue_initialize",
+	 fsxfs_test_read_queue_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_queue_free",
+	 fsxfs_test_read_queue_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_queue_push_request",
+	 fsxfs_test_read_queue_push_request );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_queue_pop_completed_request",
+	 fsxfs_test_read_queue_pop_completed_request );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_queue_read",
+	 fsxfs_test_read_queue_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -65,6 +66,35 @@ int libfsxfs_volume_open_file_io_handle(
 #define FSXFS_TEST_VOLUME_VERBOSE
  */
 
+typedef struct fsxfs_test_volume_inodes fsxfs_test_volume_inodes_t;
+
+struct fsxfs_test_volume_inodes
+{
+	/* The inode numbers
+	 */
+	uint64_t *inode_numbers;
+
+	/* The file modes
+	 */
+	uint16_t *file_modes;
+
+	/* The sizes
+	 */
+	size64_t *sizes;
+
+	/* The number of times each inode was visited
+	 */
+	uint8_t *visit_counts;
+
+	/* The number of inodes
+	 */
+	int number_of_inodes;
+
+	/* The maximum number of inodes
+	 */
+	int maximum_number_of_inodes;
+};
+
 /* Creates and opens a source volume
  * Returns 1 if successful or -1 on error
  */
@@ -178,35 +208,4034 @@ int fsxfs_test_volume_close_source(
 	     volume,
 	     error ) != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free volume.",
-		 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Compares the inode values of two file entries
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int fsxfs_test_volume_compare_file_entries(
+     libfsxfs_file_entry_t *first_file_entry,
+     libfsxfs_file_entry_t *second_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function              = "fsxfs_test_volume_compare_file_entries";
+	size64_t first_size                = 0;
+	size64_t second_size               = 0;
+	uint64_t first_inode_number        = 0;
+	uint64_t second_inode_number       = 0;
+	int64_t first_modification_time    = 0;
+	int64_t second_modification_time   = 0;
+	uint32_t first_number_of_links     = 0;
+	uint32_t second_number_of_links    = 0;
+	uint16_t first_file_mode           = 0;
+	uint16_t second_file_mode          = 0;
+	int first_number_of_extents        = 0;
+	int second_number_of_extents       = 0;
+
+	if( ( libfsxfs_file_entry_get_inode_number(
+	       first_file_entry,
+	       &first_inode_number,
+	       error ) != 1 )
+	 || ( libfsxfs_file_entry_get_inode_number(
+	       second_file_entry,
+	       &second_inode_number,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode number.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libfsxfs_file_entry_get_file_mode(
+	       first_file_entry,
+	       &first_file_mode,
+	       error ) != 1 )
+	 || ( libfsxfs_file_entry_get_file_mode(
+	       second_file_entry,
+	       &second_file_mode,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libfsxfs_file_entry_get_number_of_links(
+	       first_file_entry,
+	       &first_number_of_links,
+	       error ) != 1 )
+	 || ( libfsxfs_file_entry_get_number_of_links(
+	       second_file_entry,
+	       &second_number_of_links,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of links.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libfsxfs_file_entry_get_modification_time(
+	       first_file_entry,
+	       &first_modification_time,
+	       error ) != 1 )
+	 || ( libfsxfs_file_entry_get_modification_time(
+	       second_file_entry,
+	       &second_modification_time,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libfsxfs_file_entry_get_size(
+	       first_file_entry,
+	       &first_size,
+	       error ) != 1 )
+	 || ( libfsxfs_file_entry_get_size(
+	       second_file_entry,
+	       &second_size,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libfsxfs_file_entry_get_number_of_extents(
+	       first_file_entry,
+	       &first_number_of_extents,
+	       error ) != 1 )
+	 || ( libfsxfs_file_entry_get_number_of_extents(
+	       second_file_entry,
+	       &second_number_of_extents,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_inode_number != second_inode_number )
+	 || ( first_file_mode != second_file_mode )
+	 || ( first_number_of_links != second_number_of_links )
+	 || ( first_modification_time != second_modification_time )
+	 || ( first_size != second_size )
+	 || ( first_number_of_extents != second_number_of_extents ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the inode numbers of the root directory and its directory entries
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_volume_get_inode_numbers(
+     libfsxfs_volume_t *volume,
+     uint64_t *inode_numbers,
+     int maximum_number_of_inodes,
+     int *number_of_inodes,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_names_buffer[ 8 * 256 ];
+	uint8_t *utf8_names[ 8 ];
+	size_t utf8_name_sizes[ 8 ];
+	uint64_t entry_inode_numbers[ 8 ];
+	uint16_t file_types[ 8 ];
+
+	libfsxfs_file_entry_t *root_directory = NULL;
+	static char *function                 = "fsxfs_test_volume_get_inode_numbers";
+	int entry_index                       = 0;
+	int first_entry_index                 = 0;
+	int number_of_entries                 = 0;
+	int safe_number_of_inodes             = 0;
+
+	if( inode_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_inodes <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of inodes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_get_root_directory(
+	     volume,
+	     &root_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_file_entry_get_inode_number(
+	     root_directory,
+	     &( inode_numbers[ 0 ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory inode number.",
+		 function );
+
+		goto on_error;
+	}
+	safe_number_of_inodes = 1;
+
+	do
+	{
+		if( libfsxfs_file_entry_get_directory_entries(
+		     root_directory,
+		     first_entry_index,
+		     utf8_names_buffer,
+		     8 * 256,
+		     utf8_names,
+		     utf8_name_sizes,
+		     entry_inode_numbers,
+		     file_types,
+		     8,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entries.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( safe_number_of_inodes >= maximum_number_of_inodes )
+			{
+				break;
+			}
+			inode_numbers[ safe_number_of_inodes++ ] = entry_inode_numbers[ entry_index ];
+		}
+		first_entry_index += number_of_entries;
+	}
+	while( ( number_of_entries > 0 )
+	    && ( safe_number_of_inodes < maximum_number_of_inodes ) );
+
+	if( libfsxfs_file_entry_free(
+	     &root_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root directory.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_inodes = safe_number_of_inodes;
+
+	return( 1 );
+
+on_error:
+	if( root_directory != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares the file entries and data of a volume with those of a plain volume
+ * The plain volume is opened with the same file IO handle and reads without readahead.
+ * The data of the regular files in the root directory is read with libfsxfs_file_entry_read_buffer
+ * in blocks of 4096 bytes, where the reads of the different files are interleaved,
+ * and compared with the data read from the plain volume with libfsxfs_file_entry_pread_buffer
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_compare_with_plain_source(
+     libfsxfs_volume_t *volume,
+     libbfio_handle_t *file_io_handle )
+{
+	uint8_t plain_buffer[ 4096 ];
+	uint8_t read_buffer[ 4096 ];
+	libfsxfs_file_entry_t *file_entries[ 32 ];
+	libfsxfs_file_entry_t *plain_file_entries[ 32 ];
+	uint64_t inode_numbers[ 32 ];
+	uint64_t plain_inode_numbers[ 32 ];
+
+	libcerror_error_t *error        = NULL;
+	libfsxfs_volume_t *plain_volume = NULL;
+	size64_t size                   = 0;
+	size_t read_size                = 0;
+	ssize_t plain_read_count        = 0;
+	ssize_t read_count              = 0;
+	off64_t read_offset             = 0;
+	uint16_t file_mode              = 0;
+	int inode_index                 = 0;
+	int number_of_inodes            = 0;
+	int number_of_plain_inodes      = 0;
+	int result                      = 0;
+
+	for( inode_index = 0;
+	     inode_index < 32;
+	     inode_index++ )
+	{
+		file_entries[ inode_index ]       = NULL;
+		plain_file_entries[ inode_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &plain_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_maximum_readahead_size(
+	          plain_volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_open_file_io_handle(
+	          plain_volume,
+	          file_io_handle,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the root directory listing
+	 */
+	result = fsxfs_test_volume_get_inode_numbers(
+	          plain_volume,
+	          plain_inode_numbers,
+	          32,
+	          &number_of_plain_inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_volume_get_inode_numbers(
+	          volume,
+	          inode_numbers,
+	          32,
+	          &number_of_inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_inodes",
+	 number_of_inodes,
+	 number_of_plain_inodes );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the inode lookups
+	 */
+	for( inode_index = 0;
+	     inode_index < number_of_inodes;
+	     inode_index++ )
+	{
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "inode_numbers[ inode_index ]",
+		 inode_numbers[ inode_index ],
+		 plain_inode_numbers[ inode_index ] );
+
+		result = libfsxfs_volume_get_file_entry_by_inode(
+		          plain_volume,
+		          plain_inode_numbers[ inode_index ],
+		          &( plain_file_entries[ inode_index ] ),
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_volume_get_file_entry_by_inode(
+		          volume,
+		          inode_numbers[ inode_index ],
+		          &( file_entries[ inode_index ] ),
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = fsxfs_test_volume_compare_file_entries(
+		          file_entries[ inode_index ],
+		          plain_file_entries[ inode_index ],
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test reading the data of the regular files, at most 1 MiB per file
+	 */
+	for( read_offset = 0;
+	     read_offset < (off64_t) ( 1024 * 1024 );
+	     read_offset += 4096 )
+	{
+		for( inode_index = 0;
+		     inode_index < number_of_inodes;
+		     inode_index++ )
+		{
+			result = libfsxfs_file_entry_get_file_mode(
+			          file_entries[ inode_index ],
+			          &file_mode,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( ( file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+			{
+				continue;
+			}
+			result = libfsxfs_file_entry_get_size(
+			          file_entries[ inode_index ],
+			          &size,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( (size64_t) read_offset >= size )
+			{
+				continue;
+			}
+			read_size = 4096;
+
+			if( ( size - (size64_t) read_offset ) < (size64_t) read_size )
+			{
+				read_size = (size_t) ( size - read_offset );
+			}
+			read_count = libfsxfs_file_entry_read_buffer(
+			              file_entries[ inode_index ],
+			              read_buffer,
+			              4096,
+			              &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) read_size );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			plain_read_count = libfsxfs_file_entry_pread_buffer(
+			                    plain_file_entries[ inode_index ],
+			                    plain_buffer,
+			                    4096,
+			                    read_offset,
+			                    &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+			 "plain_read_count",
+			 plain_read_count,
+			 (ssize_t) read_size );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          read_buffer,
+			          plain_buffer,
+			          read_size );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Clean up
+	 */
+	for( inode_index = 0;
+	     inode_index < number_of_inodes;
+	     inode_index++ )
+	{
+		result = libfsxfs_file_entry_free(
+		          &( file_entries[ inode_index ] ),
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_file_entry_free(
+		          &( plain_file_entries[ inode_index ] ),
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = fsxfs_test_volume_close_source(
+	          &plain_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( inode_index = 0;
+	     inode_index < 32;
+	     inode_index++ )
+	{
+		if( file_entries[ inode_index ] != NULL )
+		{
+			libfsxfs_file_entry_free(
+			 &( file_entries[ inode_index ] ),
+			 NULL );
+		}
+		if( plain_file_entries[ inode_index ] != NULL )
+		{
+			libfsxfs_file_entry_free(
+			 &( plain_file_entries[ inode_index ] ),
+			 NULL );
+		}
+	}
+	if( plain_volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &plain_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsxfs_volume_t *volume       = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	volume = (libfsxfs_volume_t *) 0x12345678UL;
+
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	volume = NULL;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_volume_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_volume_initialize(
+		          &volume,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( volume != NULL )
+			{
+				libfsxfs_volume_free(
+				 &volume,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "volume",
+			 volume );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_volume_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_volume_initialize(
+		          &volume,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( volume != NULL )
+			{
+				libfsxfs_volume_free(
+				 &volume,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "volume",
+			 volume );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_maximum_number_of_cached_inodes function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_maximum_number_of_cached_inodes(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_maximum_number_of_cached_inodes(
+	          volume,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_maximum_number_of_cached_inodes(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_maximum_number_of_cached_inodes(
+	          NULL,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_maximum_number_of_cached_inodes(
+	          volume,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_maximum_number_of_cached_directory_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_maximum_number_of_cached_directory_entries(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_maximum_number_of_cached_directory_entries(
+	          volume,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_maximum_number_of_cached_directory_entries(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_maximum_number_of_cached_directory_entries(
+	          NULL,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_maximum_number_of_cached_directory_entries(
+	          volume,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_read_allocation_groups_on_demand function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_read_allocation_groups_on_demand(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_read_allocation_groups_on_demand(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_read_allocation_groups_on_demand(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_read_allocation_groups_on_demand(
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests reading a source volume with the allocation group inode information read on demand
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_read_allocation_groups_on_demand_on_source(
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_read_allocation_groups_on_demand(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = fsxfs_test_volume_compare_with_plain_source(
+	          volume,
+	          file_io_handle );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = fsxfs_test_volume_close_source(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_number_of_read_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_number_of_read_threads(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_number_of_read_threads(
+	          volume,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_number_of_read_threads(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_number_of_read_threads(
+	          NULL,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_number_of_read_threads(
+	          volume,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_number_of_read_threads(
+	          volume,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests reading a source volume with the allocation group inode information read by multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_number_of_read_threads_on_source(
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_number_of_read_threads(
+	          volume,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = fsxfs_test_volume_compare_with_plain_source(
+	          volume,
+	          file_io_handle );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = fsxfs_test_volume_close_source(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_number_of_file_io_handles function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_number_of_file_io_handles(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_number_of_file_io_handles(
+	          volume,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_number_of_file_io_handles(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_number_of_file_io_handles(
+	          NULL,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_number_of_file_io_handles(
+	          volume,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_number_of_file_io_handles(
+	          volume,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests reading a source volume with file entry data read using multiple file IO handles
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_number_of_file_io_handles_on_source(
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_number_of_file_io_handles(
+	          volume,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = fsxfs_test_volume_compare_with_plain_source(
+	          volume,
+	          file_io_handle );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = fsxfs_test_volume_close_source(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_maximum_readahead_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_maximum_readahead_size(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_maximum_readahead_size(
+	          volume,
+	          256 * 1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_maximum_readahead_size(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_maximum_readahead_size(
+	          NULL,
+	          256 * 1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_maximum_readahead_size(
+	          volume,
+	          (size_t) ( 128 * 1024 * 1024 ),
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests sequentially reading a source volume with a readahead window of at most 256 KiB
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_maximum_readahead_size_on_source(
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_maximum_readahead_size(
+	          volume,
+	          256 * 1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = fsxfs_test_volume_compare_with_plain_source(
+	          volume,
+	          file_io_handle );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = fsxfs_test_volume_close_source(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_use_memory_mapping function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_use_memory_mapping(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_use_memory_mapping(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_use_memory_mapping(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_use_memory_mapping(
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests sequentially reading a memory mapped source volume
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_use_memory_mapping_on_source(
+     const system_character_t *source,
+     libbfio_handle_t *file_io_handle )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = fsxfs_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_use_memory_mapping(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Memory mapping is only used when the volume is opened by filename
+	 */
+	result = libfsxfs_volume_open(
+	          volume,
+	          narrow_source,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = fsxfs_test_volume_compare_with_plain_source(
+	          volume,
+	          file_io_handle );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = fsxfs_test_volume_close_source(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_read_queue_depth function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_read_queue_depth(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_read_queue_depth(
+	          volume,
+	          8,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_read_queue_depth(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_read_queue_depth(
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_read_queue_depth(
+	          volume,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_read_queue_depth(
+	          volume,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_poll_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_poll_read(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	intptr_t *user_value      = NULL;
+	ssize_t read_count        = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_poll_read(
+	          NULL,
+	          &user_value,
+	          &read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the volume has no read queue
+	 */
+	result = libfsxfs_volume_poll_read(
+	          volume,
+	          &user_value,
+	          &read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Retrieves a file entry by an UTF-8 encoded path and compares its inode number
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_compare_file_entry_by_utf8_path(
+     libfsxfs_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int expected_result,
+     uint64_t expected_inode_number )
+{
+	libcerror_error_t *error          = NULL;
+	libfsxfs_file_entry_t *file_entry = NULL;
+	uint64_t inode_number             = 0;
+	int result                        = 0;
+
+	result = libfsxfs_volume_get_file_entry_by_utf8_path(
+	          volume,
+	          utf8_string,
+	          utf8_string_length,
+	          &file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( expected_result == 0 )
+	{
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "file_entry",
+		 file_entry );
+
+		return( 1 );
+	}
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	result = libfsxfs_file_entry_get_inode_number(
+	          file_entry,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_number",
+	 inode_number,
+	 expected_inode_number );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_get_file_entry_by_utf8_path function on a source volume
+ * The paths are resolved twice, so that the second lookup can be answered by the
+ * directory entry cache, and compared with a volume without directory entry cache
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_get_file_entry_by_utf8_path_on_source(
+     libfsxfs_volume_t *volume,
+     libbfio_handle_t *file_io_handle )
+{
+	uint8_t missing_utf8_string[ 25 ] = {
+		'/', 'f', 's', 'x', 'f', 's', '_', 't', 'e', 's', 't', '_', 'm', 'i', 's', 's', 'i', 'n', 'g', '_', 'n', 'a', 'm', 'e', 0 };
+
+	uint8_t utf8_names_buffer[ 8 * 256 ];
+	uint8_t utf8_string[ 257 ];
+	uint8_t *utf8_names[ 8 ];
+	size_t utf8_name_sizes[ 8 ];
+	uint64_t inode_numbers[ 8 ];
+	uint16_t file_types[ 8 ];
+
+	libfsxfs_file_entry_t *root_directory = NULL;
+	libcerror_error_t *error              = NULL;
+	libfsxfs_volume_t *uncached_volume    = NULL;
+	int entry_index                       = 0;
+	int lookup_iteration                  = 0;
+	int number_of_entries                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &uncached_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_maximum_number_of_cached_directory_entries(
+	          uncached_volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_open_file_io_handle(
+	          uncached_volume,
+	          file_io_handle,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_entry_get_directory_entries(
+	          root_directory,
+	          0,
+	          utf8_names_buffer,
+	          8 * 256,
+	          utf8_names,
+	          utf8_name_sizes,
+	          inode_numbers,
+	          file_types,
+	          8,
+	          &number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( lookup_iteration = 0;
+	     lookup_iteration < 2;
+	     lookup_iteration++ )
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			utf8_string[ 0 ] = (uint8_t) '/';
+
+			if( memory_copy(
+			     &( utf8_string[ 1 ] ),
+			     utf8_names[ entry_index ],
+			     utf8_name_sizes[ entry_index ] ) == NULL )
+			{
+				goto on_error;
+			}
+
+			result = fsxfs_test_volume_compare_file_entry_by_utf8_path(
+			          volume,
+			          utf8_string,
+			          utf8_name_sizes[ entry_index ],
+			          1,
+			          inode_numbers[ entry_index ] );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = fsxfs_test_volume_compare_file_entry_by_utf8_path(
+			          uncached_volume,
+			          utf8_string,
+			          utf8_name_sizes[ entry_index ],
+			          1,
+			          inode_numbers[ entry_index ] );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		/* A path that does not exist is not found, also when cached as a negative entry
+		 */
+		result = fsxfs_test_volume_compare_file_entry_by_utf8_path(
+		          volume,
+		          missing_utf8_string,
+		          24,
+		          0,
+		          0 );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = fsxfs_test_volume_compare_file_entry_by_utf8_path(
+		          uncached_volume,
+		          missing_utf8_string,
+		          24,
+		          0,
+		          0 );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Clean up
+	 */
+	result = fsxfs_test_volume_close_source(
+	          &uncached_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_directory != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( uncached_volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &uncached_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_get_file_entries_by_inodes function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_get_file_entries_by_inodes(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsxfs_file_entry_t *file_entries[ 2 ] = { NULL, NULL };
+	libfsxfs_volume_t *volume                = NULL;
+	uint64_t inode_numbers[ 2 ]              = { 128, 131 };
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving no file entries
+	 */
+	result = libfsxfs_volume_get_file_entries_by_inodes(
+	          volume,
+	          inode_numbers,
+	          0,
+	          file_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_get_file_entries_by_inodes(
+	          NULL,
+	          inode_numbers,
+	          2,
+	          file_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_file_entries_by_inodes(
+	          volume,
+	          NULL,
+	          2,
+	          file_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_file_entries_by_inodes(
+	          volume,
+	          inode_numbers,
+	          -1,
+	          file_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_file_entries_by_inodes(
+	          volume,
+	          inode_numbers,
+	          2,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_entries[ 1 ] = (libfsxfs_file_entry_t *) 0x12345678UL;
+
+	result = libfsxfs_volume_get_file_entries_by_inodes(
+	          volume,
+	          inode_numbers,
+	          2,
+	          file_entries,
+	          &error );
+
+	file_entries[ 1 ] = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_get_file_entries_by_inodes function on a source volume
+ * The inode numbers are requested in reverse order and more than once and the
+ * file entries are compared with those retrieved by libfsxfs_volume_get_file_entry_by_inode
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_get_file_entries_by_inodes_on_source(
+     libfsxfs_volume_t *volume,
+     libbfio_handle_t *file_io_handle )
+{
+	libfsxfs_file_entry_t *file_entries[ 65 ];
+	uint64_t inode_numbers[ 32 ];
+	uint64_t requested_inode_numbers[ 65 ];
+
+	libcerror_error_t *error           = NULL;
+	libfsxfs_file_entry_t *file_entry  = NULL;
+	libfsxfs_volume_t *batch_volume    = NULL;
+	int inode_index                    = 0;
+	int number_of_inodes               = 0;
+	int number_of_requested_inodes     = 0;
+	int result                         = 0;
+
+	for( inode_index = 0;
+	     inode_index < 65;
+	     inode_index++ )
+	{
+		file_entries[ inode_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = fsxfs_test_volume_get_inode_numbers(
+	          volume,
+	          inode_numbers,
+	          32,
+	          &number_of_inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_inodes",
+	 number_of_inodes,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The inode numbers are requested in reverse order, then again in order
+	 * and the first inode number a third time
+	 */
+	for( inode_index = number_of_inodes - 1;
+	     inode_index >= 0;
+	     inode_index-- )
+	{
+		requested_inode_numbers[ number_of_requested_inodes++ ] = inode_numbers[ inode_index ];
+	}
+	for( inode_index = 0;
+	     inode_index < number_of_inodes;
+	     inode_index++ )
+	{
+		requested_inode_numbers[ number_of_requested_inodes++ ] = inode_numbers[ inode_index ];
+	}
+	requested_inode_numbers[ number_of_requested_inodes++ ] = inode_numbers[ 0 ];
+
+	/* A separate volume is used so that the inodes are not cached
+	 */
+	result = fsxfs_test_volume_open_source(
+	          &batch_volume,
+	          file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_get_file_entries_by_inodes(
+	          batch_volume,
+	          requested_inode_numbers,
+	          number_of_requested_inodes,
+	          file_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( inode_index = 0;
+	     inode_index < number_of_requested_inodes;
+	     inode_index++ )
+	{
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "file_entries[ inode_index ]",
+		 file_entries[ inode_index ] );
+
+		result = libfsxfs_volume_get_file_entry_by_inode(
+		          volume,
+		          requested_inode_numbers[ inode_index ],
+		          &file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = fsxfs_test_volume_compare_file_entries(
+		          file_entries[ inode_index ],
+		          file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_file_entry_free(
+		          &file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_file_entry_free(
+		          &( file_entries[ inode_index ] ),
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = fsxfs_test_volume_close_source(
+	          &batch_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	for( inode_index = 0;
+	     inode_index < 65;
+	     inode_index++ )
+	{
+		if( file_entries[ inode_index ] != NULL )
+		{
+			libfsxfs_file_entry_free(
+			 &( file_entries[ inode_index ] ),
+			 NULL );
+		}
+	}
+	if( batch_volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &batch_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Callback function for the libfsxfs_volume_iterate_inodes tests
+ * Returns 1 to continue
+ */
+int fsxfs_test_volume_iterate_inodes_callback(
+     libfsxfs_file_entry_t *file_entry FSXFS_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data FSXFS_TEST_ATTRIBUTE_UNUSED,
+     libfsxfs_error_t **error FSXFS_TEST_ATTRIBUTE_UNUSED )
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( file_entry )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( callback_data )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 1 );
+}
+
+/* Tests the libfsxfs_volume_iterate_inodes function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_iterate_inodes(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_iterate_inodes(
+	          NULL,
+	          &fsxfs_test_volume_iterate_inodes_callback,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_iterate_inodes(
+	          volume,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the volume is not opened
+	 */
+	result = libfsxfs_volume_iterate_inodes(
+	          volume,
+	          &fsxfs_test_volume_iterate_inodes_callback,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Frees the values of the inodes
+ */
+void fsxfs_test_volume_inodes_free_values(
+      fsxfs_test_volume_inodes_t *inodes )
+{
+	if( inodes->inode_numbers != NULL )
+	{
+		memory_free(
+		 inodes->inode_numbers );
+
+		inodes->inode_numbers = NULL;
+	}
+	if( inodes->file_modes != NULL )
+	{
+		memory_free(
+		 inodes->file_modes );
+
+		inodes->file_modes = NULL;
+	}
+	if( inodes->sizes != NULL )
+	{
+		memory_free(
+		 inodes->sizes );
+
+		inodes->sizes = NULL;
+	}
+	if( inodes->visit_counts != NULL )
+	{
+		memory_free(
+		 inodes->visit_counts );
+
+		inodes->visit_counts = NULL;
+	}
+	inodes->number_of_inodes         = 0;
+	inodes->maximum_number_of_inodes = 0;
+}
+
+/* Callback function that collects the inode number, file mode and size of the file entries
+ * Returns 1 to continue or -1 on error
+ */
+int fsxfs_test_volume_collect_inodes_callback(
+     libfsxfs_file_entry_t *file_entry,
+     void *callback_data,
+     libfsxfs_error_t **error )
+{
+	fsxfs_test_volume_inodes_t *inodes = NULL;
+	static char *function              = "fsxfs_test_volume_collect_inodes_callback";
+	void *reallocation                 = NULL;
+	int maximum_number_of_inodes       = 0;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 (libcerror_error_t **) error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	inodes = (fsxfs_test_volume_inodes_t *) callback_data;
+
+	if( inodes->number_of_inodes >= inodes->maximum_number_of_inodes )
+	{
+		maximum_number_of_inodes = inodes->maximum_number_of_inodes * 2;
+
+		if( maximum_number_of_inodes == 0 )
+		{
+			maximum_number_of_inodes = 1024;
+		}
+		reallocation = memory_reallocate(
+		                inodes->inode_numbers,
+		                sizeof( uint64_t ) * maximum_number_of_inodes );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 (libcerror_error_t **) error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize inode numbers.",
+			 function );
+
+			return( -1 );
+		}
+		inodes->inode_numbers = (uint64_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                inodes->file_modes,
+		                sizeof( uint16_t ) * maximum_number_of_inodes );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 (libcerror_error_t **) error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize file modes.",
+			 function );
+
+			return( -1 );
+		}
+		inodes->file_modes = (uint16_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                inodes->sizes,
+		                sizeof( size64_t ) * maximum_number_of_inodes );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 (libcerror_error_t **) error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize sizes.",
+			 function );
+
+			return( -1 );
+		}
+		inodes->sizes = (size64_t *) reallocation;
+
+		inodes->maximum_number_of_inodes = maximum_number_of_inodes;
+	}
+	if( libfsxfs_file_entry_get_inode_number(
+	     file_entry,
+	     &( inodes->inode_numbers[ inodes->number_of_inodes ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 (libcerror_error_t **) error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_file_entry_get_file_mode(
+	     file_entry,
+	     &( inodes->file_modes[ inodes->number_of_inodes ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 (libcerror_error_t **) error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_file_entry_get_size(
+	     file_entry,
+	     &( inodes->sizes[ inodes->number_of_inodes ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 (libcerror_error_t **) error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	inodes->number_of_inodes += 1;
+
+	return( 1 );
+}
+
+/* Searches the sorted inode numbers of the inodes
+ * Returns the index of the inode number or -1 if not found
+ */
+int fsxfs_test_volume_inodes_find_inode_number(
+     fsxfs_test_volume_inodes_t *inodes,
+     uint64_t inode_number )
+{
+	int first_index  = 0;
+	int last_index   = 0;
+	int middle_index = 0;
+
+	first_index = 0;
+	last_index  = inodes->number_of_inodes - 1;
+
+	while( first_index <= last_index )
+	{
+		middle_index = first_index + ( ( last_index - first_index ) / 2 );
+
+		if( inodes->inode_numbers[ middle_index ] == inode_number )
+		{
+			return( middle_index );
+		}
+		else if( inodes->inode_numbers[ middle_index ] < inode_number )
+		{
+			first_index = middle_index + 1;
+		}
+		else
+		{
+			last_index = middle_index - 1;
+		}
+	}
+	return( -1 );
+}
+
+/* Tests the libfsxfs_volume_iterate_inodes function on a source volume
+ * The inodes are visited in order of inode number and include the inodes
+ * of the root directory listing
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_iterate_inodes_on_source(
+     libfsxfs_volume_t *volume )
+{
+	fsxfs_test_volume_inodes_t inodes;
+	uint64_t inode_numbers[ 32 ];
+
+	libcerror_error_t *error          = NULL;
+	libfsxfs_file_entry_t *file_entry = NULL;
+	size64_t size                     = 0;
+	uint16_t file_mode                = 0;
+	int inode_index                   = 0;
+	int number_of_inodes              = 0;
+	int result                        = 0;
+
+	inodes.inode_numbers            = NULL;
+	inodes.file_modes               = NULL;
+	inodes.sizes                    = NULL;
+	inodes.visit_counts             = NULL;
+	inodes.number_of_inodes         = 0;
+	inodes.maximum_number_of_inodes = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_iterate_inodes(
+	          volume,
+	          &fsxfs_test_volume_collect_inodes_callback,
+	          (void *) &inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "inodes.number_of_inodes",
+	 inodes.number_of_inodes,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The inodes are visited once in order of inode number
+	 */
+	for( inode_index = 1;
+	     inode_index < inodes.number_of_inodes;
+	     inode_index++ )
+	{
+		FSXFS_TEST_ASSERT_LESS_THAN_UINT64(
+		 "inodes.inode_numbers[ inode_index - 1 ]",
+		 inodes.inode_numbers[ inode_index - 1 ],
+		 inodes.inode_numbers[ inode_index ] );
+	}
+	/* The inodes of the root directory listing are visited
+	 */
+	result = fsxfs_test_volume_get_inode_numbers(
+	          volume,
+	          inode_numbers,
+	          32,
+	          &number_of_inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( inode_index = 0;
+	     inode_index < number_of_inodes;
+	     inode_index++ )
+	{
+		result = fsxfs_test_volume_inodes_find_inode_number(
+		          &inodes,
+		          inode_numbers[ inode_index ] );
+
+		FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+	}
+	/* The visited inodes match the file entries retrieved by inode number
+	 */
+	for( inode_index = 0;
+	     inode_index < inodes.number_of_inodes;
+	     inode_index++ )
+	{
+		if( inode_index >= 64 )
+		{
+			break;
+		}
+		result = libfsxfs_volume_get_file_entry_by_inode(
+		          volume,
+		          inodes.inode_numbers[ inode_index ],
+		          &file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_file_entry_get_file_mode(
+		          file_entry,
+		          &file_mode,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT16(
+		 "file_mode",
+		 file_mode,
+		 inodes.file_modes[ inode_index ] );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_file_entry_get_size(
+		          file_entry,
+		          &size,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "size",
+		 (uint64_t) size,
+		 (uint64_t) inodes.sizes[ inode_index ] );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_file_entry_free(
+		          &file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	fsxfs_test_volume_inodes_free_values(
+	 &inodes );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	fsxfs_test_volume_inodes_free_values(
+	 &inodes );
+
+	return( 0 );
+}
+
+/* Callback function that marks the file entries as visited in the inodes collected before
+ * The inodes are only read and each file entry updates its own visit count,
+ * hence the callback function can be called concurrently
+ * Returns 1 to continue or -1 on error
+ */
+int fsxfs_test_volume_mark_inodes_callback(
+     libfsxfs_file_entry_t *file_entry,
+     void *callback_data,
+     libfsxfs_error_t **error )
+{
+	fsxfs_test_volume_inodes_t *inodes = NULL;
+	static char *function              = "fsxfs_test_volume_mark_inodes_callback";
+	size64_t size                      = 0;
+	uint64_t inode_number              = 0;
+	uint16_t file_mode                 = 0;
+	int inode_index                    = 0;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 (libcerror_error_t **) error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	inodes = (fsxfs_test_volume_inodes_t *) callback_data;
+
+	if( ( libfsxfs_file_entry_get_inode_number(
+	       file_entry,
+	       &inode_number,
+	       error ) != 1 )
+	 || ( libfsxfs_file_entry_get_file_mode(
+	       file_entry,
+	       &file_mode,
+	       error ) != 1 )
+	 || ( libfsxfs_file_entry_get_size(
+	       file_entry,
+	       &size,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 (libcerror_error_t **) error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry values.",
+		 function );
+
+		return( -1 );
+	}
+	inode_index = fsxfs_test_volume_inodes_find_inode_number(
+	               inodes,
+	               inode_number );
+
+	if( inode_index == -1 )
+	{
+		libcerror_error_set(
+		 (libcerror_error_t **) error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: unexpected inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		return( -1 );
+	}
+	if( ( file_mode != inodes->file_modes[ inode_index ] )
+	 || ( size != inodes->sizes[ inode_index ] ) )
+	{
+		libcerror_error_set(
+		 (libcerror_error_t **) error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in values of inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		return( -1 );
+	}
+	inodes->visit_counts[ inode_index ] += 1;
+
+	return( 1 );
+}
+
+/* Tests the libfsxfs_volume_iterate_inodes_parallel function on a source volume
+ * The inodes visited by multiple threads are compared with those visited by libfsxfs_volume_iterate_inodes
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_iterate_inodes_parallel_on_source(
+     libfsxfs_volume_t *volume )
+{
+	fsxfs_test_volume_inodes_t inodes;
+
+	libcerror_error_t *error = NULL;
+	int inode_index          = 0;
+	int result               = 0;
+
+	inodes.inode_numbers            = NULL;
+	inodes.file_modes               = NULL;
+	inodes.sizes                    = NULL;
+	inodes.visit_counts             = NULL;
+	inodes.number_of_inodes         = 0;
+	inodes.maximum_number_of_inodes = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_iterate_inodes(
+	          volume,
+	          &fsxfs_test_volume_collect_inodes_callback,
+	          (void *) &inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "inodes.number_of_inodes",
+	 inodes.number_of_inodes,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The inode numbers must be sorted to be searched
+	 */
+	for( inode_index = 1;
+	     inode_index < inodes.number_of_inodes;
+	     inode_index++ )
+	{
+		FSXFS_TEST_ASSERT_LESS_THAN_UINT64(
+		 "inodes.inode_numbers[ inode_index - 1 ]",
+		 inodes.inode_numbers[ inode_index - 1 ],
+		 inodes.inode_numbers[ inode_index ] );
+	}
+	inodes.visit_counts = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * inodes.number_of_inodes );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inodes.visit_counts",
+	 inodes.visit_counts );
+
+	memory_set(
+	 inodes.visit_counts,
+	 0,
+	 sizeof( uint8_t ) * inodes.number_of_inodes );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_iterate_inodes_parallel(
+	          volume,
+	          4,
+	          &fsxfs_test_volume_mark_inodes_callback,
+	          (void *) &inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every inode is visited once
+	 */
+	for( inode_index = 0;
+	     inode_index < inodes.number_of_inodes;
+	     inode_index++ )
+	{
+		FSXFS_TEST_ASSERT_EQUAL_UINT8(
+		 "inodes.visit_counts[ inode_index ]",
+		 inodes.visit_counts[ inode_index ],
+		 1 );
+	}
+	/* Clean up
+	 */
+	fsxfs_test_volume_inodes_free_values(
+	 &inodes );
 
-		result = -1;
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
 	}
-	return( result );
+	fsxfs_test_volume_inodes_free_values(
+	 &inodes );
+
+	return( 0 );
 }
 
-/* Tests the libfsxfs_volume_initialize function
+/* Tests the libfsxfs_volume_iterate_inodes_parallel function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_volume_initialize(
+int fsxfs_test_volume_iterate_inodes_parallel(
      void )
 {
-	libcerror_error_t *error        = NULL;
-	libfsxfs_volume_t *volume       = NULL;
-	int result                      = 0;
-
-#if defined( HAVE_FSXFS_TEST_MEMORY )
-	int number_of_malloc_fail_tests = 1;
-	int number_of_memset_fail_tests = 1;
-	int test_number                 = 0;
-#endif
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
 	result = libfsxfs_volume_initialize(
 	          &volume,
@@ -225,26 +4254,31 @@ int fsxfs_test_volume_initialize(
 	 "error",
 	 error );
 
-	result = libfsxfs_volume_free(
-	          &volume,
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_iterate_inodes_parallel(
+	          NULL,
+	          2,
+	          &fsxfs_test_volume_iterate_inodes_callback,
+	          NULL,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FSXFS_TEST_ASSERT_IS_NULL(
-	 "volume",
-	 volume );
+	 -1 );
 
-	FSXFS_TEST_ASSERT_IS_NULL(
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfsxfs_volume_initialize(
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_iterate_inodes_parallel(
+	          volume,
+	          -1,
+	          &fsxfs_test_volume_iterate_inodes_callback,
 	          NULL,
 	          &error );
 
@@ -260,10 +4294,11 @@ int fsxfs_test_volume_initialize(
 	libcerror_error_free(
 	 &error );
 
-	volume = (libfsxfs_volume_t *) 0x12345678UL;
-
-	result = libfsxfs_volume_initialize(
-	          &volume,
+	result = libfsxfs_volume_iterate_inodes_parallel(
+	          volume,
+	          2,
+	          NULL,
+	          NULL,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -278,125 +4313,12 @@ int fsxfs_test_volume_initialize(
 	libcerror_error_free(
 	 &error );
 
-	volume = NULL;
-
-#if defined( HAVE_FSXFS_TEST_MEMORY )
-
-	for( test_number = 0;
-	     test_number < number_of_malloc_fail_tests;
-	     test_number++ )
-	{
-		/* Test libfsxfs_volume_initialize with malloc failing
-		 */
-		fsxfs_test_malloc_attempts_before_fail = test_number;
-
-		result = libfsxfs_volume_initialize(
-		          &volume,
-		          &error );
-
-		if( fsxfs_test_malloc_attempts_before_fail != -1 )
-		{
-			fsxfs_test_malloc_attempts_before_fail = -1;
-
-			if( volume != NULL )
-			{
-				libfsxfs_volume_free(
-				 &volume,
-				 NULL );
-			}
-		}
-		else
-		{
-			FSXFS_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 -1 );
-
-			FSXFS_TEST_ASSERT_IS_NULL(
-			 "volume",
-			 volume );
-
-			FSXFS_TEST_ASSERT_IS_NOT_NULL(
-			 "error",
-			 error );
-
-			libcerror_error_free(
-			 &error );
-		}
-	}
-	for( test_number = 0;
-	     test_number < number_of_memset_fail_tests;
-	     test_number++ )
-	{
-		/* Test libfsxfs_volume_initialize with memset failing
-		 */
-		fsxfs_test_memset_attempts_before_fail = test_number;
-
-		result = libfsxfs_volume_initialize(
-		          &volume,
-		          &error );
-
-		if( fsxfs_test_memset_attempts_before_fail != -1 )
-		{
-			fsxfs_test_memset_attempts_before_fail = -1;
-
-			if( volume != NULL )
-			{
-				libfsxfs_volume_free(
-				 &volume,
-				 NULL );
-			}
-		}
-		else
-		{
-			FSXFS_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 -1 );
-
-			FSXFS_TEST_ASSERT_IS_NULL(
-			 "volume",
-			 volume );
-
-			FSXFS_TEST_ASSERT_IS_NOT_NULL(
-			 "error",
-			 error );
-
-			libcerror_error_free(
-			 &error );
-		}
-	}
-#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( volume != NULL )
-	{
-		libfsxfs_volume_free(
-		 &volume,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libfsxfs_volume_free function
- * Returns 1 if successful or 0 if not
- */
-int fsxfs_test_volume_free(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test error cases
+	/* Test error case where the volume is not opened
 	 */
-	result = libfsxfs_volume_free(
+	result = libfsxfs_volume_iterate_inodes_parallel(
+	          volume,
+	          2,
+	          &fsxfs_test_volume_iterate_inodes_callback,
 	          NULL,
 	          &error );
 
@@ -412,6 +4334,25 @@ int fsxfs_test_volume_free(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -420,6 +4361,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -1318,6 +5265,54 @@ int main(
 	 "libfsxfs_volume_free",
 	 fsxfs_test_volume_free );
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_maximum_number_of_cached_inodes",
+	 fsxfs_test_volume_set_maximum_number_of_cached_inodes );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_maximum_number_of_cached_directory_entries",
+	 fsxfs_test_volume_set_maximum_number_of_cached_directory_entries );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_read_allocation_groups_on_demand",
+	 fsxfs_test_volume_set_read_allocation_groups_on_demand );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_number_of_read_threads",
+	 fsxfs_test_volume_set_number_of_read_threads );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_number_of_file_io_handles",
+	 fsxfs_test_volume_set_number_of_file_io_handles );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_maximum_readahead_size",
+	 fsxfs_test_volume_set_maximum_readahead_size );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_use_memory_mapping",
+	 fsxfs_test_volume_set_use_memory_mapping );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_read_queue_depth",
+	 fsxfs_test_volume_set_read_queue_depth );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_poll_read",
+	 fsxfs_test_volume_poll_read );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_get_file_entries_by_inodes",
+	 fsxfs_test_volume_get_file_entries_by_inodes );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_iterate_inodes",
+	 fsxfs_test_volume_iterate_inodes );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_iterate_inodes_parallel",
+	 fsxfs_test_volume_iterate_inodes_parallel );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -1421,6 +5416,12 @@ int main(
 		 "libfsxfs_volume_open_close",
 		 fsxfs_test_volume_open_close,
 		 source );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_set_use_memory_mapping",
+		 fsxfs_test_volume_use_memory_mapping_on_source,
+		 source,
+		 file_io_handle );
 	}
 	if( result != 0 )
 	{
@@ -1444,6 +5445,48 @@ int main(
 		 "error",
 		 error );
 
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_get_file_entry_by_utf8_path",
+		 fsxfs_test_volume_get_file_entry_by_utf8_path_on_source,
+		 volume,
+		 file_io_handle );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_get_file_entries_by_inodes",
+		 fsxfs_test_volume_get_file_entries_by_inodes_on_source,
+		 volume,
+		 file_io_handle );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_set_read_allocation_groups_on_demand",
+		 fsxfs_test_volume_read_allocation_groups_on_demand_on_source,
+		 file_io_handle );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_set_number_of_read_threads",
+		 fsxfs_test_volume_number_of_read_threads_on_source,
+		 file_io_handle );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_set_number_of_file_io_handles",
+		 fsxfs_test_volume_number_of_file_io_handles_on_source,
+		 file_io_handle );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_set_maximum_readahead_size",
+		 fsxfs_test_volume_maximum_readahead_size_on_source,
+		 file_io_handle );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_iterate_inodes",
+		 fsxfs_test_volume_iterate_inodes_on_source,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_iterate_inodes_parallel",
+		 fsxfs_test_volume_iterate_inodes_parallel_on_source,
+		 volume );
+
 		FSXFS_TEST_RUN_WITH_ARGS(
 		 "libfsxfs_volume_signal_abort",
 		 fsxfs_test_volume_signal_abort,
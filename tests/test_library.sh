@@ -7,8 +7,8 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="attribute_values attributes_leaf_block_header attributes_table attributes_table_header block_directory_footer block_directory_header btree_block btree_header buffer_data_handle directory_entry directory_table_header error extent file_system_block_header inode_btree inode_btree_record inode_information io_handle notify superblock";
-LIBRARY_TESTS_WITH_INPUT="support volume";
+LIBRARY_TESTS="attribute_values attributes_leaf_block_header attributes_table attributes_table_header block_cache block_directory_footer block_directory_header btree_block btree_header buffer_data_handle directory directory_entry directory_entry_cache directory_iterator directory_table_header error extent extent_btree extent_map file_io_handle_pool file_system_block_header inode_btree inode_btree_record inode_chunk_index inode_data_handle inode_information inode_scanner io_handle memory_mapped_file name_hash notify read_queue superblock";
+LIBRARY_TESTS_WITH_INPUT="file_entry support volume";
 OPTION_SETS=("offset");
 
 INPUT_GLOB="*";